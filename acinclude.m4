@@ -6,6 +6,14 @@ dnl Function to detect if libwrc dependencies are available
 AC_DEFUN([AX_LIBWRC_CHECK_LOCAL],
   [dnl Check for internationalization functions in libwrc/libwrc_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapped file functions in libwrc/libwrc_stream.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([mmap munmap])
+
+  dnl Check for monotonic clock functions in libwrc/libwrc_io_handle.c
+  AC_CHECK_HEADERS([sys/time.h])
+  AC_CHECK_FUNCS([clock_gettime])
   ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,321 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwrc_arena.h"
+#include "libwrc_libcerror.h"
+
+/* The size of the block header, the data follows the header
+ */
+#define LIBWRC_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( libwrc_arena_block_t ) + ( LIBWRC_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBWRC_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_arena_initialize(
+     libwrc_arena_t **arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libwrc_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libwrc_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All the memory allocated from the arena is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_arena_free(
+     libwrc_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libwrc_arena_block_t *arena_block = NULL;
+	libwrc_arena_block_t *next_block  = NULL;
+	static char *function             = "libwrc_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		arena_block = ( *arena )->first_block;
+
+		while( arena_block != NULL )
+		{
+			next_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets an arena
+ * All the memory allocated from the arena is released but the blocks are
+ * retained, so that they can be reused without allocating them again
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_arena_reset(
+     libwrc_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libwrc_arena_block_t *arena_block = NULL;
+	static char *function             = "libwrc_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	for( arena_block = arena->first_block;
+	     arena_block != NULL;
+	     arena_block = arena_block->next_block )
+	{
+		arena_block->used_data_size = 0;
+	}
+	arena->current_block         = arena->first_block;
+	arena->number_of_allocations = 0;
+
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * The memory is aligned, cleared and remains valid until the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_arena_allocate(
+     libwrc_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error )
+{
+	libwrc_arena_block_t *arena_block = NULL;
+	static char *function             = "libwrc_arena_allocate";
+	size_t aligned_size               = 0;
+	size_t block_size                 = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBWRC_ARENA_BLOCK_HEADER_SIZE - LIBWRC_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + ( LIBWRC_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBWRC_ARENA_ALIGNMENT - 1 );
+
+	/* Blocks that follow the current block are empty after a reset
+	 */
+	for( arena_block = arena->current_block;
+	     arena_block != NULL;
+	     arena_block = arena_block->next_block )
+	{
+		if( aligned_size <= ( arena_block->data_size - arena_block->used_data_size ) )
+		{
+			break;
+		}
+	}
+	if( arena_block == NULL )
+	{
+		if( arena->last_block == NULL )
+		{
+			block_size = LIBWRC_ARENA_MINIMUM_BLOCK_SIZE;
+		}
+		else if( arena->last_block->data_size < LIBWRC_ARENA_MAXIMUM_BLOCK_SIZE )
+		{
+			block_size = arena->last_block->data_size * 2;
+		}
+		else
+		{
+			block_size = LIBWRC_ARENA_MAXIMUM_BLOCK_SIZE;
+		}
+		if( block_size < aligned_size )
+		{
+			block_size = aligned_size;
+		}
+		arena_block = (libwrc_arena_block_t *) memory_allocate(
+		                                        LIBWRC_ARENA_BLOCK_HEADER_SIZE + block_size );
+
+		if( arena_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create arena block.",
+			 function );
+
+			return( -1 );
+		}
+		arena_block->next_block     = NULL;
+		arena_block->data           = &( ( (uint8_t *) arena_block )[ LIBWRC_ARENA_BLOCK_HEADER_SIZE ] );
+		arena_block->data_size      = block_size;
+		arena_block->used_data_size = 0;
+
+		if( arena->last_block == NULL )
+		{
+			arena->first_block = arena_block;
+		}
+		else
+		{
+			arena->last_block->next_block = arena_block;
+		}
+		arena->last_block             = arena_block;
+		arena->allocated_size        += block_size;
+		arena->number_of_allocations += 1;
+	}
+	arena->current_block = arena_block;
+
+	*data = &( arena_block->data[ arena_block->used_data_size ] );
+
+	arena_block->used_data_size += aligned_size;
+
+	if( memory_set(
+	     *data,
+	     0,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		*data = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,115 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWRC_ARENA_H )
+#define _LIBWRC_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the memory allocated from an arena
+ */
+#define LIBWRC_ARENA_ALIGNMENT			8
+
+/* The size of the first block, subsequent blocks double in size
+ * up to the maximum block size
+ */
+#define LIBWRC_ARENA_MINIMUM_BLOCK_SIZE		4096
+#define LIBWRC_ARENA_MAXIMUM_BLOCK_SIZE		( 1024 * 1024 )
+
+typedef struct libwrc_arena_block libwrc_arena_block_t;
+
+struct libwrc_arena_block
+{
+	/* The next block
+	 */
+	libwrc_arena_block_t *next_block;
+
+	/* The data
+	 * The data directly follows the block
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+};
+
+typedef struct libwrc_arena libwrc_arena_t;
+
+struct libwrc_arena
+{
+	/* The first block
+	 */
+	libwrc_arena_block_t *first_block;
+
+	/* The current block
+	 * Memory is allocated from this block or the blocks that follow it
+	 */
+	libwrc_arena_block_t *current_block;
+
+	/* The last block
+	 */
+	libwrc_arena_block_t *last_block;
+
+	/* The total data size of the blocks
+	 */
+	size64_t allocated_size;
+
+	/* The number of blocks allocated since the arena was created or last reset
+	 */
+	uint64_t number_of_allocations;
+};
+
+int libwrc_arena_initialize(
+     libwrc_arena_t **arena,
+     libcerror_error_t **error );
+
+int libwrc_arena_free(
+     libwrc_arena_t **arena,
+     libcerror_error_t **error );
+
+int libwrc_arena_reset(
+     libwrc_arena_t *arena,
+     libcerror_error_t **error );
+
+int libwrc_arena_allocate(
+     libwrc_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWRC_ARENA_H ) */
+
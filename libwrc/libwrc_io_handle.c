@@ -23,9 +23,22 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#include "libwrc_arena.h"
 #include "libwrc_codepage.h"
+#include "libwrc_data_descriptor.h"
+#include "libwrc_definitions.h"
 #include "libwrc_io_handle.h"
+#include "libwrc_libbfio.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_libcthreads.h"
+#include "libwrc_node_offset_table.h"
+#include "libwrc_types.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -94,6 +107,12 @@ int libwrc_io_handle_initialize(
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->node_offset_table != NULL )
+		{
+			libwrc_node_offset_table_free(
+			 &( ( *io_handle )->node_offset_table ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -124,6 +143,12 @@ int libwrc_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->node_offset_table != NULL )
+		{
+			libwrc_node_offset_table_free(
+			 &( ( *io_handle )->node_offset_table ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -152,6 +177,22 @@ int libwrc_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->node_offset_table != NULL )
+	{
+		if( libwrc_node_offset_table_free(
+		     &( io_handle->node_offset_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free node offset table.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -171,3 +212,739 @@ int libwrc_io_handle_clear(
 	return( 1 );
 }
 
+
+/* Retrieves the stream data at a specific offset
+ * The data is not copied and remains owned by the stream
+ * Returns 1 if successful, 0 if the stream is not available in memory or -1 on error
+ */
+int libwrc_io_handle_get_stream_data_at_offset(
+     libwrc_io_handle_t *io_handle,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_io_handle_get_stream_data_at_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->stream_data == NULL )
+	{
+		return( 0 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= io_handle->stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = &( io_handle->stream_data[ offset ] );
+	*data_size = (size_t) ( io_handle->stream_size - (size64_t) offset );
+
+	return( 1 );
+}
+
+/* Reads the resource data of a data descriptor
+ * If the stream is available in memory the resource data references the stream data
+ * and resource_data_buffer is set to NULL, otherwise the resource data is read into
+ * resource_data_buffer, which the caller must free
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_io_handle_read_resource_data(
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libwrc_data_descriptor_t *data_descriptor,
+     const uint8_t **resource_data,
+     uint8_t **resource_data_buffer,
+     libcerror_error_t **error )
+{
+	const uint8_t *stream_data = NULL;
+	static char *function      = "libwrc_io_handle_read_resource_data";
+	off64_t file_offset        = 0;
+	size_t resource_data_size  = 0;
+	size_t stream_data_size    = 0;
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource data.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_data_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource data buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	resource_data_size = (size_t) data_descriptor->size;
+
+	if( ( resource_data_size == 0 )
+	 || ( resource_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_descriptor->virtual_address < io_handle->virtual_address )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data descriptor - virtual address value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset = (off64_t) ( data_descriptor->virtual_address - io_handle->virtual_address );
+
+	result = libwrc_io_handle_get_stream_data_at_offset(
+	          io_handle,
+	          file_offset,
+	          &stream_data,
+	          &stream_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( resource_data_size > stream_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid resource data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		*resource_data = stream_data;
+
+		return( 1 );
+	}
+	*resource_data_buffer = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * resource_data_size );
+
+	if( *resource_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_io_handle_update_statistics(
+	     io_handle,
+	     LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+	     (uint64_t) resource_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update statistics.",
+		 function );
+
+		memory_free(
+		 *resource_data_buffer );
+
+		*resource_data_buffer = NULL;
+
+		return( -1 );
+	}
+	read_count = libwrc_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              *resource_data_buffer,
+	              resource_data_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) resource_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resource data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	*resource_data = *resource_data_buffer;
+
+	return( 1 );
+
+on_error:
+	if( *resource_data_buffer != NULL )
+	{
+		libwrc_io_handle_free_resource_data(
+		 io_handle,
+		 data_descriptor,
+		 resource_data_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees resource data read by libwrc_io_handle_read_resource_data
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_io_handle_free_resource_data(
+     libwrc_io_handle_t *io_handle,
+     libwrc_data_descriptor_t *data_descriptor,
+     uint8_t **resource_data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_io_handle_free_resource_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_data_buffer != NULL )
+	{
+		memory_free(
+		 *resource_data_buffer );
+
+		*resource_data_buffer = NULL;
+
+		if( libwrc_io_handle_update_statistics(
+		     io_handle,
+		     LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		     (uint64_t) data_descriptor->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset from the file IO handle
+ * The number of reads and bytes read are added to the statistics
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libwrc_io_handle_read_buffer_at_offset(
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	if( libwrc_io_handle_update_statistics(
+	     io_handle,
+	     LIBWRC_STATISTICS_VALUE_TYPE_READ,
+	     (uint64_t) read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Updates the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_io_handle_update_statistics(
+     libwrc_io_handle_t *io_handle,
+     int value_type,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	static char *function   = "libwrc_io_handle_update_statistics";
+	size64_t allocated_size = 0;
+	int result              = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( io_handle->statistics_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     io_handle->statistics_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab statistics mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	switch( value_type )
+	{
+		case LIBWRC_STATISTICS_VALUE_TYPE_READ:
+			io_handle->statistics.number_of_reads += 1;
+			io_handle->statistics.read_size       += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE:
+			io_handle->statistics.number_of_allocations += 1;
+			io_handle->allocated_size                   += value;
+
+			allocated_size = io_handle->allocated_size;
+
+			if( io_handle->arena != NULL )
+			{
+				allocated_size += io_handle->arena->allocated_size;
+			}
+			if( allocated_size > io_handle->statistics.maximum_allocated_size )
+			{
+				io_handle->statistics.maximum_allocated_size = allocated_size;
+			}
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_FREE:
+			if( value > io_handle->allocated_size )
+			{
+				io_handle->allocated_size = 0;
+			}
+			else
+			{
+				io_handle->allocated_size -= value;
+			}
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_NODE:
+			io_handle->statistics.number_of_nodes        += 1;
+			io_handle->statistics.number_of_node_entries += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_DATA_DESCRIPTORS:
+			io_handle->statistics.number_of_data_descriptors += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_NODE_TREE_READ_TIME:
+			io_handle->statistics.node_tree_read_time += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_STRING_VALUES_READ_TIME:
+			io_handle->statistics.string_values_read_time += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_MESSAGE_TABLE_VALUES_READ_TIME:
+			io_handle->statistics.message_table_values_read_time += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_MANIFEST_VALUES_READ_TIME:
+			io_handle->statistics.manifest_values_read_time += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_MUI_VALUES_READ_TIME:
+			io_handle->statistics.mui_values_read_time += value;
+			break;
+
+		case LIBWRC_STATISTICS_VALUE_TYPE_VERSION_VALUES_READ_TIME:
+			io_handle->statistics.version_values_read_time += value;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type: %d.",
+			 function,
+			 value_type );
+
+			result = -1;
+			break;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( io_handle->statistics_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     io_handle->statistics_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release statistics mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_io_handle_get_statistics(
+     libwrc_io_handle_t *io_handle,
+     libwrc_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_io_handle_get_statistics";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( io_handle->statistics_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     io_handle->statistics_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab statistics mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( memory_copy(
+	     statistics,
+	     &( io_handle->statistics ),
+	     sizeof( libwrc_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy statistics.",
+		 function );
+
+		goto on_error;
+	}
+	/* The blocks of the arena are allocated when the resource node tree is read
+	 * and remain allocated until the stream is freed
+	 */
+	if( io_handle->arena != NULL )
+	{
+		statistics->number_of_allocations += io_handle->arena->number_of_allocations;
+
+		if( io_handle->arena->allocated_size > statistics->maximum_allocated_size )
+		{
+			statistics->maximum_allocated_size = io_handle->arena->allocated_size;
+		}
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( io_handle->statistics_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     io_handle->statistics_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release statistics mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( io_handle->statistics_mutex != NULL )
+	{
+		libcthreads_mutex_release(
+		 io_handle->statistics_mutex,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the current time of a monotonic clock
+ * The current time is in nanoseconds and is only meaningful relative to another current time
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_io_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_structure;
+
+#endif
+	static char *function = "libwrc_io_handle_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	              + ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL / (uint64_t) frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_structure.tv_sec * 1000000000UL )
+	              + (uint64_t) time_structure.tv_nsec;
+
+#else
+	*current_time = (uint64_t) time( NULL ) * 1000000000UL;
+
+#endif
+	return( 1 );
+}
@@ -25,7 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libwrc_data_descriptor.h"
+#include "libwrc_libbfio.h"
+#include "libwrc_arena.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_libcthreads.h"
+#include "libwrc_node_offset_table.h"
+#include "libwrc_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,6 +51,29 @@ struct libwrc_io_handle
 	 */
 	size64_t stream_size;
 
+	/* The stream data
+	 * Only set if the stream is available in memory
+	 */
+	const uint8_t *stream_data;
+
+	/* Value to indicate the resource node tree is read on demand
+	 */
+	uint8_t read_on_demand;
+
+	/* Value to indicate resource nodes that are referenced more than once are rejected
+	 */
+	uint8_t reject_shared_nodes;
+
+	/* The node offset table
+	 * Used to detect resource nodes that are referenced more than once
+	 */
+	libwrc_node_offset_table_t *node_offset_table;
+
+	/* The arena from which the resource node tree is allocated
+	 * The arena is owned by the stream
+	 */
+	libwrc_arena_t *arena;
+
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
@@ -52,6 +81,22 @@ struct libwrc_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The statistics
+	 */
+	libwrc_statistics_t statistics;
+
+	/* The number of bytes currently allocated for read buffers
+	 * Used to determine the maximum allocated size
+	 */
+	size64_t allocated_size;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	/* The mutex of the statistics
+	 * The mutex is owned by the stream
+	 */
+	libcthreads_mutex_t *statistics_mutex;
+#endif
 };
 
 int libwrc_io_handle_initialize(
@@ -66,6 +111,50 @@ int libwrc_io_handle_clear(
      libwrc_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libwrc_io_handle_get_stream_data_at_offset(
+     libwrc_io_handle_t *io_handle,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libwrc_io_handle_read_resource_data(
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libwrc_data_descriptor_t *data_descriptor,
+     const uint8_t **resource_data,
+     uint8_t **resource_data_buffer,
+     libcerror_error_t **error );
+
+int libwrc_io_handle_free_resource_data(
+     libwrc_io_handle_t *io_handle,
+     libwrc_data_descriptor_t *data_descriptor,
+     uint8_t **resource_data_buffer,
+     libcerror_error_t **error );
+
+ssize_t libwrc_io_handle_read_buffer_at_offset(
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libwrc_io_handle_update_statistics(
+     libwrc_io_handle_t *io_handle,
+     int value_type,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int libwrc_io_handle_get_statistics(
+     libwrc_io_handle_t *io_handle,
+     libwrc_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libwrc_io_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
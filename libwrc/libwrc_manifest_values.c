@@ -44,11 +44,10 @@ int libwrc_manifest_values_read(
      libcerror_error_t **error )
 {
 	libfvalue_value_t *manifest_value = NULL;
-	uint8_t *resource_data            = NULL;
+	const uint8_t *resource_data      = NULL;
+	uint8_t *resource_data_buffer     = NULL;
 	static char *function             = "libwrc_manifest_values_read";
-	off64_t file_offset               = 0;
 	size_t resource_data_size         = 0;
-	ssize_t read_count                = 0;
 	int value_index                   = 0;
 
 	if( language_entry == NULL )
@@ -84,56 +83,25 @@ int libwrc_manifest_values_read(
 
 		return( -1 );
 	}
-	resource_data_size = (size_t) data_descriptor->size;
-
-	if( ( resource_data_size == 0 )
-	 || ( resource_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource data size value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-	resource_data = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * resource_data_size );
-
-	if( resource_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create resource data.",
-		 function );
-
-		goto on_error;
-	}
-	file_offset = data_descriptor->virtual_address - io_handle->virtual_address;
-
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              resource_data,
-	              resource_data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) resource_data_size )
+	if( libwrc_io_handle_read_resource_data(
+	     io_handle,
+	     file_io_handle,
+	     data_descriptor,
+	     &resource_data,
+	     &resource_data_buffer,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read resource data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 "%s: unable to read resource data.",
+		 function );
 
 		goto on_error;
 	}
+	resource_data_size = (size_t) data_descriptor->size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -220,9 +188,21 @@ int libwrc_manifest_values_read(
 	}
 	manifest_value = NULL;
 
-	memory_free(
-	 resource_data );
+	if( libwrc_io_handle_free_resource_data(
+	     io_handle,
+	     data_descriptor,
+	     &resource_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource data.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -232,10 +212,13 @@ on_error:
 		 &manifest_value,
 		 NULL );
 	}
-	if( resource_data != NULL )
+	if( resource_data_buffer != NULL )
 	{
-		memory_free(
-		 resource_data );
+		libwrc_io_handle_free_resource_data(
+		 io_handle,
+		 data_descriptor,
+		 &resource_data_buffer,
+		 NULL );
 	}
 	return( -1 );
 }
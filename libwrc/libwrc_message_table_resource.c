@@ -166,6 +166,16 @@ int libwrc_message_table_resource_free(
 
 			result = -1;
 		}
+		if( internal_message_table_resource->ranges != NULL )
+		{
+			memory_free(
+			 internal_message_table_resource->ranges );
+		}
+		if( internal_message_table_resource->data != NULL )
+		{
+			memory_free(
+			 internal_message_table_resource->data );
+		}
 		memory_free(
 		 internal_message_table_resource );
 	}
@@ -210,6 +220,17 @@ int libwrc_message_table_resource_read(
 	}
 	internal_message_table_resource = (libwrc_internal_message_table_resource_t *) message_table_resource;
 
+	if( internal_message_table_resource->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message table resource - data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -222,7 +243,7 @@ int libwrc_message_table_resource_read(
 		return( -1 );
 	}
 	if( ( data_size < 4 )
-	 || ( data_size > (size_t) SSIZE_MAX ) )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -245,6 +266,39 @@ int libwrc_message_table_resource_read(
 		 0 );
 	}
 #endif
+	/* The resource data is retained so that the table entries
+	 * can reference the message strings instead of copying them
+	 */
+	internal_message_table_resource->data = (uint8_t *) memory_allocate(
+	                                                     sizeof( uint8_t ) * data_size );
+
+	if( internal_message_table_resource->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_message_table_resource->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_message_table_resource->data_size = data_size;
+
 	byte_stream_copy_to_uint32_little_endian(
 	 data,
 	 number_of_message_entry_descriptors );
@@ -484,9 +538,9 @@ int libwrc_message_table_resource_read(
 				{
 					value_encoding = LIBUNA_CODEPAGE_UTF16_LITTLE_ENDIAN;
 				}
-				if( libwrc_table_entry_set_string(
+				if( libwrc_table_entry_set_string_reference(
 				     table_entry,
-				     &( data[ message_string_offset ] ),
+				     &( internal_message_table_resource->data[ message_string_offset ] ),
 				     (size_t) string_size,
 				     value_encoding,
 				     error ) != 1 )
@@ -519,6 +573,22 @@ int libwrc_message_table_resource_read(
 				}
 				table_entry = NULL;
 
+				if( libwrc_internal_message_table_resource_append_identifier(
+				     internal_message_table_resource,
+				     first_message_identifier,
+				     entry_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append message identifier: 0x%08" PRIx32 " to ranges.",
+					 function,
+					 first_message_identifier );
+
+					goto on_error;
+				}
 				message_string_offset += message_string_size;
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -540,9 +610,211 @@ on_error:
 		 &table_entry,
 		 NULL );
 	}
+	/* The table entries reference the resource data hence they are freed first
+	 */
+	libcdata_array_empty(
+	 internal_message_table_resource->entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_table_entry_free,
+	 NULL );
+
+	if( internal_message_table_resource->ranges != NULL )
+	{
+		memory_free(
+		 internal_message_table_resource->ranges );
+
+		internal_message_table_resource->ranges = NULL;
+	}
+	internal_message_table_resource->number_of_ranges           = 0;
+	internal_message_table_resource->number_of_allocated_ranges = 0;
+	internal_message_table_resource->ranges_unsorted            = 0;
+
+	if( internal_message_table_resource->data != NULL )
+	{
+		memory_free(
+		 internal_message_table_resource->data );
+
+		internal_message_table_resource->data = NULL;
+	}
+	internal_message_table_resource->data_size = 0;
+
 	return( -1 );
 }
 
+/* Appends a message identifier to the message ranges
+ * The identifier extends the last range if it directly follows the last identifier
+ * and entry of that range, otherwise a new range is started
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_internal_message_table_resource_append_identifier(
+     libwrc_internal_message_table_resource_t *internal_message_table_resource,
+     uint32_t message_identifier,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libwrc_message_table_range_t *last_range = NULL;
+	void *reallocation                       = NULL;
+	static char *function                    = "libwrc_internal_message_table_resource_append_identifier";
+	size_t ranges_size                       = 0;
+	int number_of_allocated_ranges           = 0;
+
+	if( internal_message_table_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message table resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_message_table_resource->number_of_ranges > 0 )
+	{
+		last_range = &( internal_message_table_resource->ranges[ internal_message_table_resource->number_of_ranges - 1 ] );
+
+		if( ( last_range->last_identifier < 0xffffffffUL )
+		 && ( message_identifier == ( last_range->last_identifier + 1 ) )
+		 && ( (uint32_t) ( entry_index - last_range->first_entry_index ) == ( message_identifier - last_range->first_identifier ) ) )
+		{
+			last_range->last_identifier = message_identifier;
+
+			return( 1 );
+		}
+		if( message_identifier <= last_range->last_identifier )
+		{
+			internal_message_table_resource->ranges_unsorted = 1;
+		}
+	}
+	if( internal_message_table_resource->number_of_ranges >= internal_message_table_resource->number_of_allocated_ranges )
+	{
+		if( internal_message_table_resource->number_of_allocated_ranges == 0 )
+		{
+			number_of_allocated_ranges = 16;
+		}
+		else
+		{
+			number_of_allocated_ranges = internal_message_table_resource->number_of_allocated_ranges * 2;
+		}
+		if( (size_t) number_of_allocated_ranges > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwrc_message_table_range_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated ranges value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		ranges_size = sizeof( libwrc_message_table_range_t ) * number_of_allocated_ranges;
+
+		reallocation = memory_reallocate(
+		                internal_message_table_resource->ranges,
+		                ranges_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		internal_message_table_resource->ranges                     = (libwrc_message_table_range_t *) reallocation;
+		internal_message_table_resource->number_of_allocated_ranges = number_of_allocated_ranges;
+	}
+	last_range = &( internal_message_table_resource->ranges[ internal_message_table_resource->number_of_ranges ] );
+
+	last_range->first_identifier  = message_identifier;
+	last_range->last_identifier   = message_identifier;
+	last_range->first_entry_index = entry_index;
+
+	internal_message_table_resource->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific table entry
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_internal_message_table_resource_get_entry_by_index(
+     libwrc_internal_message_table_resource_t *internal_message_table_resource,
+     int message_index,
+     libwrc_table_entry_t **table_entry,
+     libcerror_error_t **error )
+{
+	libwrc_table_entry_t *safe_table_entry = NULL;
+	static char *function                  = "libwrc_internal_message_table_resource_get_entry_by_index";
+
+	if( internal_message_table_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message table resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_message_table_resource->entries_array,
+	     message_index,
+	     (intptr_t **) &safe_table_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table entry: %d.",
+		 function,
+		 message_index );
+
+		return( -1 );
+	}
+	if( safe_table_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing table entry: %d.",
+		 function,
+		 message_index );
+
+		return( -1 );
+	}
+	*table_entry = safe_table_entry;
+
+	return( 1 );
+}
+
 /* Retrieves the number of messages
  * Returns 1 if successful or -1 on error
  */
@@ -655,6 +927,7 @@ int libwrc_message_table_resource_get_identifier(
 }
 
 /* Retrieves the message index for a specific identifier
+ * The message ranges are searched with a binary search if they are stored in ascending order
  * Returns 1 if successful, 0 if no such message identifier or -1 on error
  */
 int libwrc_message_table_resource_get_index_by_identifier(
@@ -665,8 +938,12 @@ int libwrc_message_table_resource_get_index_by_identifier(
 {
 	libwrc_internal_message_table_resource_t *internal_message_table_resource = NULL;
 	libwrc_table_entry_t *table_entry                                         = NULL;
+	libwrc_message_table_range_t *range                                       = NULL;
 	static char *function                                                     = "libwrc_message_table_resource_get_index_by_identifier";
 	int number_of_messages                                                    = 0;
+	int range_index                                                           = 0;
+	int range_start                                                           = 0;
+	int range_end                                                             = 0;
 	int safe_message_index                                                    = 0;
 
 	if( message_table_resource == NULL )
@@ -693,6 +970,33 @@ int libwrc_message_table_resource_get_index_by_identifier(
 
 		return( -1 );
 	}
+	if( internal_message_table_resource->ranges_unsorted == 0 )
+	{
+		range_start = 0;
+		range_end   = internal_message_table_resource->number_of_ranges;
+
+		while( range_start < range_end )
+		{
+			range_index = range_start + ( ( range_end - range_start ) / 2 );
+			range       = &( internal_message_table_resource->ranges[ range_index ] );
+
+			if( message_identifier < range->first_identifier )
+			{
+				range_end = range_index;
+			}
+			else if( message_identifier > range->last_identifier )
+			{
+				range_start = range_index + 1;
+			}
+			else
+			{
+				*message_index = range->first_entry_index + (int) ( message_identifier - range->first_identifier );
+
+				return( 1 );
+			}
+		}
+		return( 0 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_message_table_resource->entries_array,
 	     &number_of_messages,
@@ -775,10 +1079,10 @@ int libwrc_message_table_resource_get_utf8_string_size(
 	}
 	internal_message_table_resource = (libwrc_internal_message_table_resource_t *) message_table_resource;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_message_table_resource->entries_array,
+	if( libwrc_internal_message_table_resource_get_entry_by_index(
+	     internal_message_table_resource,
 	     message_index,
-	     (intptr_t **) &table_entry,
+	     &table_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -836,10 +1140,10 @@ int libwrc_message_table_resource_get_utf8_string(
 	}
 	internal_message_table_resource = (libwrc_internal_message_table_resource_t *) message_table_resource;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_message_table_resource->entries_array,
+	if( libwrc_internal_message_table_resource_get_entry_by_index(
+	     internal_message_table_resource,
 	     message_index,
-	     (intptr_t **) &table_entry,
+	     &table_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -897,10 +1201,10 @@ int libwrc_message_table_resource_get_utf16_string_size(
 	}
 	internal_message_table_resource = (libwrc_internal_message_table_resource_t *) message_table_resource;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_message_table_resource->entries_array,
+	if( libwrc_internal_message_table_resource_get_entry_by_index(
+	     internal_message_table_resource,
 	     message_index,
-	     (intptr_t **) &table_entry,
+	     &table_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -958,10 +1262,10 @@ int libwrc_message_table_resource_get_utf16_string(
 	}
 	internal_message_table_resource = (libwrc_internal_message_table_resource_t *) message_table_resource;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_message_table_resource->entries_array,
+	if( libwrc_internal_message_table_resource_get_entry_by_index(
+	     internal_message_table_resource,
 	     message_index,
-	     (intptr_t **) &table_entry,
+	     &table_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -28,12 +28,30 @@
 #include "libwrc_extern.h"
 #include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_table_entry.h"
 #include "libwrc_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libwrc_message_table_range libwrc_message_table_range_t;
+
+struct libwrc_message_table_range
+{
+	/* The first message identifier
+	 */
+	uint32_t first_identifier;
+
+	/* The last message identifier
+	 */
+	uint32_t last_identifier;
+
+	/* The index of the entry of the first message identifier
+	 */
+	int first_entry_index;
+};
+
 typedef struct libwrc_internal_message_table_resource libwrc_internal_message_table_resource_t;
 
 struct libwrc_internal_message_table_resource
@@ -41,8 +59,47 @@ struct libwrc_internal_message_table_resource
 	/* The entries array
 	 */
 	libcdata_array_t *entries_array;
+
+	/* The resource data
+	 * The table entries reference the message strings in the resource data
+	 */
+	uint8_t *data;
+
+	/* The resource data size
+	 */
+	size_t data_size;
+
+	/* The message ranges
+	 * Each range contains consecutive message identifiers of consecutive entries
+	 */
+	libwrc_message_table_range_t *ranges;
+
+	/* The number of message ranges
+	 */
+	int number_of_ranges;
+
+	/* The number of allocated message ranges
+	 */
+	int number_of_allocated_ranges;
+
+	/* Value to indicate the message ranges are not stored in ascending order
+	 * or overlap, in which case identifiers are looked up by scanning the entries array
+	 */
+	uint8_t ranges_unsorted;
 };
 
+int libwrc_internal_message_table_resource_append_identifier(
+     libwrc_internal_message_table_resource_t *internal_message_table_resource,
+     uint32_t message_identifier,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libwrc_internal_message_table_resource_get_entry_by_index(
+     libwrc_internal_message_table_resource_t *internal_message_table_resource,
+     int message_index,
+     libwrc_table_entry_t **table_entry,
+     libcerror_error_t **error );
+
 LIBWRC_EXTERN \
 int libwrc_message_table_resource_initialize(
      libwrc_message_table_resource_t **message_table_resource,
@@ -45,26 +45,25 @@ int libwrc_message_table_values_read(
      libwrc_data_descriptor_t *data_descriptor,
      libcerror_error_t **error )
 {
-	libfvalue_value_t *message_table_value       = NULL;
-	uint8_t *resource_data                       = NULL;
-	uint8_t *message_table_resource_data         = NULL;
-	uint8_t *message_table_string_resource_data  = NULL;
-	static char *function                        = "libwrc_message_table_values_read";
-	off64_t file_offset                          = 0;
-	size_t message_entry_descriptors_size        = 0;
-	size_t resource_data_size                    = 0;
-	ssize_t read_count                           = 0;
-	uint32_t first_message_identifier            = 0;
-	uint32_t last_message_identifier             = 0;
-	uint16_t message_entry_descriptor_index      = 0;
-	uint16_t message_table_string_flags          = 0;
-	uint32_t message_table_string_offset         = 0;
-	uint16_t message_table_string_size           = 0;
-	uint16_t number_of_message_entry_descriptors = 0;
-	uint16_t string_size                         = 0;
-	int result                                   = 0;
-	int value_encoding                           = 0;
-	int value_index                              = 0;
+	libfvalue_value_t *message_table_value            = NULL;
+	const uint8_t *resource_data                      = NULL;
+	uint8_t *resource_data_buffer                     = NULL;
+	const uint8_t *message_table_resource_data        = NULL;
+	const uint8_t *message_table_string_resource_data = NULL;
+	static char *function                             = "libwrc_message_table_values_read";
+	size_t message_entry_descriptors_size             = 0;
+	size_t resource_data_size                         = 0;
+	uint32_t first_message_identifier                 = 0;
+	uint32_t last_message_identifier                  = 0;
+	uint16_t message_entry_descriptor_index           = 0;
+	uint16_t message_table_string_flags               = 0;
+	uint32_t message_table_string_offset              = 0;
+	uint16_t message_table_string_size                = 0;
+	uint16_t number_of_message_entry_descriptors      = 0;
+	uint16_t string_size                              = 0;
+	int result                                        = 0;
+	int value_encoding                                = 0;
+	int value_index                                   = 0;
 
 	if( language_entry == NULL )
 	{
@@ -99,56 +98,36 @@ int libwrc_message_table_values_read(
 
 		return( -1 );
 	}
-	resource_data_size = (size_t) data_descriptor->size;
-
-	if( ( resource_data_size == 0 )
-	 || ( resource_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( libwrc_io_handle_read_resource_data(
+	     io_handle,
+	     file_io_handle,
+	     data_descriptor,
+	     &resource_data,
+	     &resource_data_buffer,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resource data.",
 		 function );
 
 		goto on_error;
 	}
-	resource_data = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * resource_data_size );
+	resource_data_size = (size_t) data_descriptor->size;
 
-	if( resource_data == NULL )
+	if( resource_data_size < sizeof( uint32_t ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create resource data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource data size value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	file_offset = data_descriptor->virtual_address - io_handle->virtual_address;
-
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              resource_data,
-	              resource_data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) resource_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read resource data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
-
-		goto on_error;
-	}
 	message_table_resource_data = resource_data;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -263,7 +242,8 @@ int libwrc_message_table_values_read(
 		}
 		while( first_message_identifier <= last_message_identifier )
 		{
-			if( message_table_string_offset >= (size_t) data_descriptor->size )
+			if( ( (size_t) data_descriptor->size < sizeof( wrc_message_table_string_t ) )
+			 || ( message_table_string_offset > ( (size_t) data_descriptor->size - sizeof( wrc_message_table_string_t ) ) ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -313,6 +293,17 @@ int libwrc_message_table_values_read(
 				 message_table_string_flags );
 			}
 #endif
+			if( message_table_string_size < sizeof( wrc_message_table_string_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: message string size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
 			if( message_table_string_size > sizeof( wrc_message_table_string_t ) )
 			{
 				message_table_string_resource_data += sizeof( wrc_message_table_string_t );
@@ -368,7 +359,17 @@ int libwrc_message_table_values_read(
 				{
 					value_encoding = LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN;
 				}
-/* TODO data bounds check */
+				if( (size_t) message_table_string_size > ( (size_t) data_descriptor->size - message_table_string_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: message string size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
 				{
@@ -464,9 +465,10 @@ int libwrc_message_table_values_read(
 				libcnotify_printf(
 				 "\n" );
 			}
+#endif
 			message_table_string_resource_data += message_table_string_size;
 			message_table_string_offset        += message_table_string_size;
-#endif
+
 			if( libwrc_language_entry_append_value(
 			     language_entry,
 			     &value_index,
@@ -487,9 +489,21 @@ int libwrc_message_table_values_read(
 			first_message_identifier++;
 		}
 	}
-	memory_free(
-	 resource_data );
+	if( libwrc_io_handle_free_resource_data(
+	     io_handle,
+	     data_descriptor,
+	     &resource_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource data.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -499,10 +513,13 @@ on_error:
 		 &message_table_value,
 		 NULL );
 	}
-	if( resource_data != NULL )
+	if( resource_data_buffer != NULL )
 	{
-		memory_free(
-		 resource_data );
+		libwrc_io_handle_free_resource_data(
+		 io_handle,
+		 data_descriptor,
+		 &resource_data_buffer,
+		 NULL );
 	}
 	return( -1 );
 }
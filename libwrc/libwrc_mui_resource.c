@@ -33,6 +33,7 @@
 #include "libwrc_libcnotify.h"
 #include "libwrc_libuna.h"
 #include "libwrc_mui_resource.h"
+#include "libwrc_utf8_string.h"
 
 #include "wrc_mui_resource.h"
 
@@ -1468,10 +1469,9 @@ int libwrc_mui_resource_get_utf8_main_name_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libwrc_utf8_string_size_from_utf16_stream(
 	     internal_mui_resource->main_name,
 	     internal_mui_resource->main_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -1539,12 +1539,11 @@ int libwrc_mui_resource_get_utf8_main_name(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libwrc_utf8_string_copy_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     internal_mui_resource->main_name,
 	     internal_mui_resource->main_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1730,10 +1729,9 @@ int libwrc_mui_resource_get_utf8_mui_name_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libwrc_utf8_string_size_from_utf16_stream(
 	     internal_mui_resource->mui_name,
 	     internal_mui_resource->mui_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -1801,12 +1799,11 @@ int libwrc_mui_resource_get_utf8_mui_name(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libwrc_utf8_string_copy_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     internal_mui_resource->mui_name,
 	     internal_mui_resource->mui_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1992,10 +1989,9 @@ int libwrc_mui_resource_get_utf8_language_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libwrc_utf8_string_size_from_utf16_stream(
 	     internal_mui_resource->language,
 	     internal_mui_resource->language_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -2063,12 +2059,11 @@ int libwrc_mui_resource_get_utf8_language(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libwrc_utf8_string_copy_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     internal_mui_resource->language,
 	     internal_mui_resource->language_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2254,10 +2249,9 @@ int libwrc_mui_resource_get_utf8_fallback_language_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libwrc_utf8_string_size_from_utf16_stream(
 	     internal_mui_resource->fallback_language,
 	     internal_mui_resource->fallback_language_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -2325,12 +2319,11 @@ int libwrc_mui_resource_get_utf8_fallback_language(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libwrc_utf8_string_copy_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     internal_mui_resource->fallback_language,
 	     internal_mui_resource->fallback_language_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
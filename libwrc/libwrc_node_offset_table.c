@@ -0,0 +1,424 @@
+/*
+ * Node offset table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_node_offset_table.h"
+#include "libwrc_resource_node_entry.h"
+
+/* Creates a node offset table
+ * Make sure the value node_offset_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_node_offset_table_initialize(
+     libwrc_node_offset_table_t **node_offset_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_node_offset_table_initialize";
+
+	if( node_offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_offset_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node offset table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*node_offset_table = memory_allocate_structure(
+	                      libwrc_node_offset_table_t );
+
+	if( *node_offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node offset table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *node_offset_table,
+	     0,
+	     sizeof( libwrc_node_offset_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node offset table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *node_offset_table != NULL )
+	{
+		memory_free(
+		 *node_offset_table );
+
+		*node_offset_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a node offset table
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_node_offset_table_free(
+     libwrc_node_offset_table_t **node_offset_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_node_offset_table_free";
+
+	if( node_offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_offset_table != NULL )
+	{
+		/* The resource_node_entry references are freed elsewhere
+		 */
+		if( ( *node_offset_table )->slots != NULL )
+		{
+			memory_free(
+			 ( *node_offset_table )->slots );
+		}
+		if( ( *node_offset_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *node_offset_table )->entries );
+		}
+		memory_free(
+		 *node_offset_table );
+
+		*node_offset_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the resource node entry of a specific resource node offset
+ * Returns 1 if successful, 0 if no such resource node entry or -1 on error
+ */
+int libwrc_node_offset_table_get_resource_node_entry_by_offset(
+     libwrc_node_offset_table_t *node_offset_table,
+     uint32_t offset,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_node_offset_table_entry_t *table_entry = NULL;
+	static char *function                         = "libwrc_node_offset_table_get_resource_node_entry_by_offset";
+	uint32_t slot                                 = 0;
+	uint32_t slot_mask                            = 0;
+	int entry_index                               = 0;
+
+	if( node_offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_offset_table->number_of_slots == 0 )
+	{
+		return( 0 );
+	}
+	slot_mask = node_offset_table->number_of_slots - 1;
+	slot      = (uint32_t) ( offset * 0x9e3779b1UL ) & slot_mask;
+
+	entry_index = node_offset_table->slots[ slot ];
+
+	while( entry_index != 0 )
+	{
+		table_entry = &( node_offset_table->entries[ entry_index - 1 ] );
+
+		/* Removed entries remain in the slots and are skipped
+		 */
+		if( ( table_entry->offset == offset )
+		 && ( table_entry->resource_node_entry != NULL ) )
+		{
+			*resource_node_entry = table_entry->resource_node_entry;
+
+			return( 1 );
+		}
+		slot = ( slot + 1 ) & slot_mask;
+
+		entry_index = node_offset_table->slots[ slot ];
+	}
+	return( 0 );
+}
+
+/* Appends the resource node entry of a specific resource node offset
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_node_offset_table_append_resource_node_entry(
+     libwrc_node_offset_table_t *node_offset_table,
+     uint32_t offset,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_node_offset_table_entry_t *entries = NULL;
+	int *slots                                = NULL;
+	static char *function                     = "libwrc_node_offset_table_append_resource_node_entry";
+	size_t entries_size                       = 0;
+	size_t slots_size                         = 0;
+	uint32_t number_of_slots                  = 0;
+	uint32_t slot                             = 0;
+	uint32_t slot_mask                        = 0;
+	int entry_index                           = 0;
+	int number_of_allocated_entries           = 0;
+
+	if( node_offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_offset_table->number_of_entries >= node_offset_table->number_of_allocated_entries )
+	{
+		if( node_offset_table->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 32;
+		}
+		else if( node_offset_table->number_of_allocated_entries <= ( INT_MAX / 4 ) )
+		{
+			number_of_allocated_entries = node_offset_table->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid node offset table - number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libwrc_node_offset_table_entry_t ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libwrc_node_offset_table_entry_t *) memory_reallocate(
+		                                                node_offset_table->entries,
+		                                                entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		node_offset_table->entries = entries;
+
+		/* The slots are kept at least twice the number of entries
+		 */
+		number_of_slots = (uint32_t) number_of_allocated_entries * 2;
+		slots_size      = sizeof( int ) * number_of_slots;
+
+		slots = (int *) memory_allocate(
+		                 slots_size );
+
+		if( slots == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slots.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     slots,
+		     0,
+		     slots_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slots.",
+			 function );
+
+			memory_free(
+			 slots );
+
+			return( -1 );
+		}
+		slot_mask = number_of_slots - 1;
+
+		for( entry_index = 0;
+		     entry_index < node_offset_table->number_of_entries;
+		     entry_index++ )
+		{
+			slot = (uint32_t) ( node_offset_table->entries[ entry_index ].offset * 0x9e3779b1UL ) & slot_mask;
+
+			while( slots[ slot ] != 0 )
+			{
+				slot = ( slot + 1 ) & slot_mask;
+			}
+			slots[ slot ] = entry_index + 1;
+		}
+		if( node_offset_table->slots != NULL )
+		{
+			memory_free(
+			 node_offset_table->slots );
+		}
+		node_offset_table->slots                       = slots;
+		node_offset_table->number_of_slots             = number_of_slots;
+		node_offset_table->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry_index = node_offset_table->number_of_entries;
+
+	node_offset_table->entries[ entry_index ].offset              = offset;
+	node_offset_table->entries[ entry_index ].resource_node_entry = resource_node_entry;
+
+	slot_mask = node_offset_table->number_of_slots - 1;
+	slot      = (uint32_t) ( offset * 0x9e3779b1UL ) & slot_mask;
+
+	while( node_offset_table->slots[ slot ] != 0 )
+	{
+		slot = ( slot + 1 ) & slot_mask;
+	}
+	node_offset_table->slots[ slot ] = entry_index + 1;
+
+	node_offset_table->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Removes the entries starting with a specific entry index
+ * The resource node entries of the removed entries are no longer returned
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_node_offset_table_remove_entries(
+     libwrc_node_offset_table_t *node_offset_table,
+     int first_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_node_offset_table_remove_entries";
+	int entry_index       = 0;
+
+	if( node_offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = first_entry_index;
+	     entry_index < node_offset_table->number_of_entries;
+	     entry_index++ )
+	{
+		node_offset_table->entries[ entry_index ].resource_node_entry = NULL;
+	}
+	return( 1 );
+}
+
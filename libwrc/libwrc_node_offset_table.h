@@ -0,0 +1,110 @@
+/*
+ * Node offset table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWRC_NODE_OFFSET_TABLE_H )
+#define _LIBWRC_NODE_OFFSET_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_resource_node_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwrc_node_offset_table_entry libwrc_node_offset_table_entry_t;
+
+struct libwrc_node_offset_table_entry
+{
+	/* The offset of the resource node
+	 */
+	uint32_t offset;
+
+	/* The resource node entry that contains the sub entries of the resource node
+	 * NULL if the entry was removed
+	 */
+	libwrc_resource_node_entry_t *resource_node_entry;
+};
+
+typedef struct libwrc_node_offset_table libwrc_node_offset_table_t;
+
+struct libwrc_node_offset_table
+{
+	/* The entries
+	 */
+	libwrc_node_offset_table_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The slots
+	 * Each slot contains the entry index + 1 or 0 if not used
+	 */
+	int *slots;
+
+	/* The number of slots, which is a power of 2
+	 */
+	uint32_t number_of_slots;
+
+	/* The size of the resource node headers and entries read
+	 */
+	size64_t node_data_size;
+};
+
+int libwrc_node_offset_table_initialize(
+     libwrc_node_offset_table_t **node_offset_table,
+     libcerror_error_t **error );
+
+int libwrc_node_offset_table_free(
+     libwrc_node_offset_table_t **node_offset_table,
+     libcerror_error_t **error );
+
+int libwrc_node_offset_table_get_resource_node_entry_by_offset(
+     libwrc_node_offset_table_t *node_offset_table,
+     uint32_t offset,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_node_offset_table_append_resource_node_entry(
+     libwrc_node_offset_table_t *node_offset_table,
+     uint32_t offset,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_node_offset_table_remove_entries(
+     libwrc_node_offset_table_t *node_offset_table,
+     int first_entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWRC_NODE_OFFSET_TABLE_H ) */
+
@@ -0,0 +1,408 @@
+/*
+ * Node read queue functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_node_read_queue.h"
+#include "libwrc_resource_node_entry.h"
+
+/* Creates a node read queue
+ * Make sure the value node_read_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_node_read_queue_initialize(
+     libwrc_node_read_queue_t **node_read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_node_read_queue_initialize";
+
+	if( node_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*node_read_queue = memory_allocate_structure(
+	                    libwrc_node_read_queue_t );
+
+	if( *node_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *node_read_queue,
+	     0,
+	     sizeof( libwrc_node_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node read queue.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *node_read_queue != NULL )
+	{
+		memory_free(
+		 *node_read_queue );
+
+		*node_read_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a node read queue
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_node_read_queue_free(
+     libwrc_node_read_queue_t **node_read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_node_read_queue_free";
+
+	if( node_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_read_queue != NULL )
+	{
+		/* The resource_node_entry references are freed elsewhere
+		 */
+		if( ( *node_read_queue )->entries != NULL )
+		{
+			memory_free(
+			 ( *node_read_queue )->entries );
+		}
+		memory_free(
+		 *node_read_queue );
+
+		*node_read_queue = NULL;
+	}
+	return( 1 );
+}
+
+/* Pushes a resource node entry onto the node read queue
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_node_read_queue_push(
+     libwrc_node_read_queue_t *node_read_queue,
+     uint32_t offset,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_node_read_queue_entry_t *entries = NULL;
+	static char *function                   = "libwrc_node_read_queue_push";
+	size_t entries_size                     = 0;
+	int entry_index                         = 0;
+	int number_of_allocated_entries         = 0;
+	int parent_entry_index                  = 0;
+
+	if( node_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_read_queue->number_of_entries >= node_read_queue->number_of_allocated_entries )
+	{
+		if( node_read_queue->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 32;
+		}
+		else if( node_read_queue->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = node_read_queue->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid node read queue - number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libwrc_node_read_queue_entry_t ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libwrc_node_read_queue_entry_t *) memory_reallocate(
+		                                              node_read_queue->entries,
+		                                              entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		node_read_queue->entries                     = entries;
+		node_read_queue->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	/* Move the entry up the heap until its parent has a lower offset,
+	 * entries with the same offset are kept in the order they were pushed
+	 */
+	entry_index = node_read_queue->number_of_entries;
+
+	while( entry_index > 0 )
+	{
+		parent_entry_index = ( entry_index - 1 ) / 2;
+
+		if( node_read_queue->entries[ parent_entry_index ].offset <= offset )
+		{
+			break;
+		}
+		node_read_queue->entries[ entry_index ] = node_read_queue->entries[ parent_entry_index ];
+
+		entry_index = parent_entry_index;
+	}
+	node_read_queue->entries[ entry_index ].offset              = offset;
+	node_read_queue->entries[ entry_index ].sequence_number     = node_read_queue->next_sequence_number;
+	node_read_queue->entries[ entry_index ].resource_node_entry = resource_node_entry;
+
+	node_read_queue->next_sequence_number += 1;
+
+	node_read_queue->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the resource node entry with the lowest offset without removing it from the node read queue
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int libwrc_node_read_queue_peek(
+     libwrc_node_read_queue_t *node_read_queue,
+     uint32_t *offset,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_node_read_queue_peek";
+
+	if( node_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_read_queue->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	*offset              = node_read_queue->entries[ 0 ].offset;
+	*resource_node_entry = node_read_queue->entries[ 0 ].resource_node_entry;
+
+	return( 1 );
+}
+
+/* Pops the resource node entry with the lowest offset from the node read queue
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int libwrc_node_read_queue_pop(
+     libwrc_node_read_queue_t *node_read_queue,
+     uint32_t *offset,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_node_read_queue_entry_t *child_entry = NULL;
+	libwrc_node_read_queue_entry_t *last_entry  = NULL;
+	static char *function                       = "libwrc_node_read_queue_pop";
+	int child_entry_index                       = 0;
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+
+	if( node_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_read_queue->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	*offset              = node_read_queue->entries[ 0 ].offset;
+	*resource_node_entry = node_read_queue->entries[ 0 ].resource_node_entry;
+
+	node_read_queue->number_of_entries -= 1;
+
+	number_of_entries = node_read_queue->number_of_entries;
+
+	if( number_of_entries > 0 )
+	{
+		/* Move the last entry down the heap until it is to be read before its children
+		 */
+		last_entry        = &( node_read_queue->entries[ number_of_entries ] );
+		child_entry_index = 1;
+
+		while( child_entry_index < number_of_entries )
+		{
+			child_entry = &( node_read_queue->entries[ child_entry_index ] );
+
+			if( ( child_entry_index + 1 ) < number_of_entries )
+			{
+				if( ( child_entry[ 1 ].offset < child_entry[ 0 ].offset )
+				 || ( ( child_entry[ 1 ].offset == child_entry[ 0 ].offset )
+				  &&  ( child_entry[ 1 ].sequence_number < child_entry[ 0 ].sequence_number ) ) )
+				{
+					child_entry_index += 1;
+					child_entry       += 1;
+				}
+			}
+			if( ( last_entry->offset < child_entry->offset )
+			 || ( ( last_entry->offset == child_entry->offset )
+			  &&  ( last_entry->sequence_number < child_entry->sequence_number ) ) )
+			{
+				break;
+			}
+			node_read_queue->entries[ entry_index ] = *child_entry;
+
+			entry_index       = child_entry_index;
+			child_entry_index = ( entry_index * 2 ) + 1;
+		}
+		node_read_queue->entries[ entry_index ] = *last_entry;
+	}
+	return( 1 );
+}
+
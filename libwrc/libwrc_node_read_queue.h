@@ -0,0 +1,106 @@
+/*
+ * Node read queue functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWRC_NODE_READ_QUEUE_H )
+#define _LIBWRC_NODE_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_resource_node_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwrc_node_read_queue_entry libwrc_node_read_queue_entry_t;
+
+struct libwrc_node_read_queue_entry
+{
+	/* The offset of the data to read
+	 */
+	uint32_t offset;
+
+	/* The sequence number
+	 * Used to retrieve entries with the same offset in the order they were pushed
+	 */
+	uint32_t sequence_number;
+
+	/* The resource node entry that references the data
+	 */
+	libwrc_resource_node_entry_t *resource_node_entry;
+};
+
+typedef struct libwrc_node_read_queue libwrc_node_read_queue_t;
+
+struct libwrc_node_read_queue
+{
+	/* The entries
+	 * Stored as a binary heap with the lowest offset first
+	 */
+	libwrc_node_read_queue_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The next sequence number
+	 */
+	uint32_t next_sequence_number;
+};
+
+int libwrc_node_read_queue_initialize(
+     libwrc_node_read_queue_t **node_read_queue,
+     libcerror_error_t **error );
+
+int libwrc_node_read_queue_free(
+     libwrc_node_read_queue_t **node_read_queue,
+     libcerror_error_t **error );
+
+int libwrc_node_read_queue_push(
+     libwrc_node_read_queue_t *node_read_queue,
+     uint32_t offset,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_node_read_queue_peek(
+     libwrc_node_read_queue_t *node_read_queue,
+     uint32_t *offset,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_node_read_queue_pop(
+     libwrc_node_read_queue_t *node_read_queue,
+     uint32_t *offset,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWRC_NODE_READ_QUEUE_H ) */
+
@@ -0,0 +1,294 @@
+/*
+ * Read range functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_read_range.h"
+
+/* Sorts the read ranges by offset
+ * This uses a stable merge sort so that ranges with the same offset retain their request order
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_read_range_sort(
+     libwrc_read_range_t *read_ranges,
+     int number_of_read_ranges,
+     libcerror_error_t **error )
+{
+	libwrc_read_range_t *sorted_read_ranges = NULL;
+	libwrc_read_range_t *source_read_ranges = NULL;
+	libwrc_read_range_t *swap_read_ranges   = NULL;
+	static char *function                   = "libwrc_read_range_sort";
+	size_t read_ranges_size                 = 0;
+	int first_index                         = 0;
+	int last_index                          = 0;
+	int left_index                          = 0;
+	int middle_index                        = 0;
+	int right_index                         = 0;
+	int sorted_index                        = 0;
+	int width                               = 0;
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_read_ranges < 0 )
+	 || ( (size_t) number_of_read_ranges > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwrc_read_range_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Read ranges are often requested in on-disk order
+	 */
+	for( sorted_index = 1;
+	     sorted_index < number_of_read_ranges;
+	     sorted_index++ )
+	{
+		if( read_ranges[ sorted_index - 1 ].offset > read_ranges[ sorted_index ].offset )
+		{
+			break;
+		}
+	}
+	if( sorted_index >= number_of_read_ranges )
+	{
+		return( 1 );
+	}
+	read_ranges_size = sizeof( libwrc_read_range_t ) * number_of_read_ranges;
+
+	sorted_read_ranges = (libwrc_read_range_t *) memory_allocate(
+	                                             read_ranges_size );
+
+	if( sorted_read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	source_read_ranges = read_ranges;
+
+	for( width = 1;
+	     width < number_of_read_ranges;
+	     width *= 2 )
+	{
+		sorted_index = 0;
+
+		for( first_index = 0;
+		     first_index < number_of_read_ranges;
+		     first_index += 2 * width )
+		{
+			middle_index = first_index + width;
+
+			if( middle_index > number_of_read_ranges )
+			{
+				middle_index = number_of_read_ranges;
+			}
+			last_index = middle_index + width;
+
+			if( last_index > number_of_read_ranges )
+			{
+				last_index = number_of_read_ranges;
+			}
+			left_index  = first_index;
+			right_index = middle_index;
+
+			while( ( left_index < middle_index )
+			    || ( right_index < last_index ) )
+			{
+				if( ( right_index >= last_index )
+				 || ( ( left_index < middle_index )
+				  && ( source_read_ranges[ left_index ].offset <= source_read_ranges[ right_index ].offset ) ) )
+				{
+					sorted_read_ranges[ sorted_index++ ] = source_read_ranges[ left_index++ ];
+				}
+				else
+				{
+					sorted_read_ranges[ sorted_index++ ] = source_read_ranges[ right_index++ ];
+				}
+			}
+		}
+		swap_read_ranges   = source_read_ranges;
+		source_read_ranges = sorted_read_ranges;
+		sorted_read_ranges = swap_read_ranges;
+	}
+	if( source_read_ranges != read_ranges )
+	{
+		if( memory_copy(
+		     read_ranges,
+		     source_read_ranges,
+		     read_ranges_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted read ranges.",
+			 function );
+
+			memory_free(
+			 source_read_ranges );
+
+			return( -1 );
+		}
+		sorted_read_ranges = source_read_ranges;
+	}
+	memory_free(
+	 sorted_read_ranges );
+
+	return( 1 );
+}
+
+/* Retrieves the range that can be read at once starting with a specific read range
+ * The read ranges must be sorted by offset. Subsequent read ranges are coalesced when
+ * they overlap or are separated by at most maximum gap size bytes and the coalesced
+ * range does not exceed maximum size. The first read range is always included
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_read_range_get_coalesced_range(
+     libwrc_read_range_t *read_ranges,
+     int number_of_read_ranges,
+     int read_range_index,
+     size_t maximum_gap_size,
+     size_t maximum_size,
+     int *number_of_coalesced_ranges,
+     size64_t *coalesced_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_read_range_get_coalesced_range";
+	off64_t end_offset    = 0;
+	off64_t range_end     = 0;
+	off64_t start_offset  = 0;
+	int range_index       = 0;
+
+	if( read_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_range_index < 0 )
+	 || ( read_range_index >= number_of_read_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read range index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_gap_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum gap size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_coalesced_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of coalesced ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( coalesced_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid coalesced size.",
+		 function );
+
+		return( -1 );
+	}
+	start_offset = read_ranges[ read_range_index ].offset;
+	end_offset   = start_offset + (off64_t) read_ranges[ read_range_index ].size;
+
+	for( range_index = read_range_index + 1;
+	     range_index < number_of_read_ranges;
+	     range_index++ )
+	{
+		if( read_ranges[ range_index ].offset > ( end_offset + (off64_t) maximum_gap_size ) )
+		{
+			break;
+		}
+		range_end = read_ranges[ range_index ].offset + (off64_t) read_ranges[ range_index ].size;
+
+		if( range_end > end_offset )
+		{
+			if( (size64_t) ( range_end - start_offset ) > (size64_t) maximum_size )
+			{
+				break;
+			}
+			end_offset = range_end;
+		}
+	}
+	*number_of_coalesced_ranges = range_index - read_range_index;
+	*coalesced_size             = (size64_t) ( end_offset - start_offset );
+
+	return( 1 );
+}
+
@@ -0,0 +1,72 @@
+/*
+ * Read range functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWRC_READ_RANGE_H )
+#define _LIBWRC_READ_RANGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwrc_read_range libwrc_read_range_t;
+
+struct libwrc_read_range
+{
+	/* The offset
+	 * Contains the offset relative to the start of the stream
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The index of the corresponding read request
+	 */
+	int request_index;
+};
+
+int libwrc_read_range_sort(
+     libwrc_read_range_t *read_ranges,
+     int number_of_read_ranges,
+     libcerror_error_t **error );
+
+int libwrc_read_range_get_coalesced_range(
+     libwrc_read_range_t *read_ranges,
+     int number_of_read_ranges,
+     int read_range_index,
+     size_t maximum_gap_size,
+     size_t maximum_size,
+     int *number_of_coalesced_ranges,
+     size64_t *coalesced_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWRC_READ_RANGE_H ) */
+
@@ -28,9 +28,9 @@
 #include "libwrc_language_entry.h"
 #include "libwrc_language_table.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
 #include "libwrc_libcnotify.h"
+#include "libwrc_libcthreads.h"
 #include "libwrc_libfvalue.h"
 #include "libwrc_libfwnt.h"
 #include "libwrc_manifest_values.h"
@@ -39,6 +39,7 @@
 #include "libwrc_resource.h"
 #include "libwrc_resource_item.h"
 #include "libwrc_resource_node_entry.h"
+#include "libwrc_resource_node_tree.h"
 #include "libwrc_string_values.h"
 #include "libwrc_version_values.h"
 
@@ -50,12 +51,11 @@ int libwrc_resource_initialize(
      libwrc_resource_t **resource,
      libwrc_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_tree_node_t *resource_node,
+     libwrc_resource_node_entry_t *resource_node_entry,
      libcerror_error_t **error )
 {
-	libwrc_internal_resource_t *internal_resource     = NULL;
-	libwrc_resource_node_entry_t *resource_node_entry = NULL;
-	static char *function                             = "libwrc_resource_initialize";
+	libwrc_internal_resource_t *internal_resource = NULL;
+	static char *function                         = "libwrc_resource_initialize";
 
 	if( resource == NULL )
 	{
@@ -79,30 +79,34 @@ int libwrc_resource_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_value(
-	     resource_node,
-	     (intptr_t **) &resource_node_entry,
-	     error ) != 1 )
+	if( resource_node_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve resource node entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( resource_node_entry == NULL )
+	/* When the stream is read on demand the sub nodes are read
+	 * the first time the resource is retrieved
+	 */
+	if( libwrc_resource_node_tree_read_sub_nodes(
+	     resource_node_entry,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid resource node entry.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub nodes of resource node entry.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	internal_resource = memory_allocate_structure(
 	                     libwrc_internal_resource_t );
@@ -137,9 +141,23 @@ int libwrc_resource_initialize(
 	}
 	internal_resource->io_handle           = io_handle;
 	internal_resource->file_io_handle      = file_io_handle;
-	internal_resource->resource_node       = resource_node;
 	internal_resource->resource_node_entry = resource_node_entry;
 
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_resource->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*resource = (libwrc_resource_t *) internal_resource;
 
 	return( 1 );
@@ -180,7 +198,7 @@ int libwrc_resource_free(
 		internal_resource = (libwrc_internal_resource_t *) *resource;
 		*resource         = NULL;
 
-		/* The io_handle, file_io_handle, resource_node and resource_node_entry references are freed elsewhere
+		/* The io_handle, file_io_handle and resource_node_entry references are freed elsewhere
 		 */
 		if( internal_resource->value != NULL )
 		{
@@ -201,12 +219,214 @@ int libwrc_resource_free(
 				}
 			}
 		}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_resource->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_resource );
 	}
 	return( result );
 }
 
+/* Reads the value of a leaf resource node entry into a language entry
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_internal_resource_read_leaf_value(
+     libwrc_internal_resource_t *internal_resource,
+     libwrc_resource_node_entry_t *sub_resource_node_entry,
+     libwrc_resource_node_entry_t *leaf_resource_node_entry,
+     libwrc_language_entry_t *language_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_internal_resource_read_leaf_value";
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
+	int result            = -1;
+	int value_type        = 0;
+
+	if( internal_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_resource->resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource - missing resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_io_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_resource->resource_node_entry->type )
+	{
+		case LIBWRC_RESOURCE_TYPE_STRING_TABLE:
+			result = libwrc_string_values_read(
+			          language_entry,
+			          internal_resource->io_handle,
+			          internal_resource->file_io_handle,
+			          sub_resource_node_entry->identifier - 1,
+			          leaf_resource_node_entry->data_descriptor,
+			          error );
+			value_type = LIBWRC_STATISTICS_VALUE_TYPE_STRING_VALUES_READ_TIME;
+			break;
+
+		case LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE:
+			result = libwrc_message_table_values_read(
+			          language_entry,
+			          internal_resource->io_handle,
+			          internal_resource->file_io_handle,
+			          leaf_resource_node_entry->data_descriptor,
+			          error );
+			value_type = LIBWRC_STATISTICS_VALUE_TYPE_MESSAGE_TABLE_VALUES_READ_TIME;
+			break;
+
+		case LIBWRC_RESOURCE_TYPE_MANIFEST:
+			result = libwrc_manifest_values_read(
+			          language_entry,
+			          internal_resource->io_handle,
+			          internal_resource->file_io_handle,
+			          leaf_resource_node_entry->data_descriptor,
+			          error );
+			value_type = LIBWRC_STATISTICS_VALUE_TYPE_MANIFEST_VALUES_READ_TIME;
+			break;
+
+		case LIBWRC_RESOURCE_TYPE_MUI:
+			result = libwrc_mui_values_read(
+			          language_entry,
+			          internal_resource->io_handle,
+			          internal_resource->file_io_handle,
+			          leaf_resource_node_entry->data_descriptor,
+			          error );
+			value_type = LIBWRC_STATISTICS_VALUE_TYPE_MUI_VALUES_READ_TIME;
+			break;
+
+		case LIBWRC_RESOURCE_TYPE_VERSION_INFORMATION:
+			result = libwrc_version_values_read(
+			          language_entry,
+			          internal_resource->io_handle,
+			          internal_resource->file_io_handle,
+			          leaf_resource_node_entry->data_descriptor,
+			          error );
+			value_type = LIBWRC_STATISTICS_VALUE_TYPE_VERSION_VALUES_READ_TIME;
+			break;
+
+		default:
+#if defined( HAVE_DEBUG_OUTPUT )
+			result = libwrc_resource_read_data_descriptor(
+			          internal_resource,
+			          internal_resource->io_handle,
+			          internal_resource->file_io_handle,
+			          leaf_resource_node_entry->data_descriptor,
+			          error );
+#else
+			/* The values of other resource types are not read
+			 */
+			result = 1;
+#endif
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read leaf value for language identifier: 0x%08" PRIx32 ".",
+		 function,
+		 leaf_resource_node_entry->identifier );
+
+		return( -1 );
+	}
+	if( value_type != 0 )
+	{
+		if( libwrc_io_handle_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		if( libwrc_io_handle_update_statistics(
+		     internal_resource->io_handle,
+		     value_type,
+		     end_time - start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Read the values
  * Returns 1 if successful or -1 on error
  */
@@ -214,9 +434,6 @@ int libwrc_resource_read_value(
      libwrc_internal_resource_t *internal_resource,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *leaf_node                        = NULL;
-	libcdata_tree_node_t *sub_node                         = NULL;
-	libwrc_data_descriptor_t *data_descriptor              = NULL;
 	libwrc_language_entry_t *existing_language_entry       = NULL;
 	libwrc_language_entry_t *language_entry                = NULL;
 	libwrc_resource_node_entry_t *leaf_resource_node_entry = NULL;
@@ -241,17 +458,6 @@ int libwrc_resource_read_value(
 
 		return( -1 );
 	}
-	if( internal_resource->resource_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid resource - missing resource node.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_resource->resource_node_entry == NULL )
 	{
 		libcerror_error_set(
@@ -351,8 +557,8 @@ int libwrc_resource_read_value(
 
 		goto on_error;
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_resource->resource_node,
+	if( libwrc_resource_node_entry_get_number_of_sub_entries(
+	     internal_resource->resource_node_entry,
 	     &number_of_sub_nodes,
 	     error ) != 1 )
 	{
@@ -387,25 +593,10 @@ int libwrc_resource_read_value(
 	     sub_node_index < number_of_sub_nodes;
 	     sub_node_index++ )
 	{
-		if( libcdata_tree_node_get_sub_node_by_index(
-		     internal_resource->resource_node,
+		if( libwrc_resource_node_entry_get_sub_entry_by_index(
+		     internal_resource->resource_node_entry,
 		     sub_node_index,
-		     &sub_node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub node: %d.",
-			 function,
-			 sub_node_index );
-
-			goto on_error;
-		}
-		if( libcdata_tree_node_get_value(
-		     sub_node,
-		     (intptr_t **) &sub_resource_node_entry,
+		     &sub_resource_node_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -418,20 +609,8 @@ int libwrc_resource_read_value(
 
 			goto on_error;
 		}
-		if( sub_resource_node_entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid resource sub node: %d entry.",
-			 function,
-			 sub_node_index );
-
-			goto on_error;
-		}
-		if( libcdata_tree_node_get_number_of_sub_nodes(
-		     sub_node,
+		if( libwrc_resource_node_entry_get_number_of_sub_entries(
+		     sub_resource_node_entry,
 		     &number_of_leaf_nodes,
 		     error ) != 1 )
 		{
@@ -448,25 +627,10 @@ int libwrc_resource_read_value(
 		     leaf_node_index < number_of_leaf_nodes;
 		     leaf_node_index++ )
 		{
-			if( libcdata_tree_node_get_sub_node_by_index(
-			     sub_node,
+			if( libwrc_resource_node_entry_get_sub_entry_by_index(
+			     sub_resource_node_entry,
 			     leaf_node_index,
-			     &leaf_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve leaf node: %d.",
-				 function,
-				 leaf_node_index );
-
-				goto on_error;
-			}
-			if( libcdata_tree_node_get_value(
-			     leaf_node,
-			     (intptr_t **) &leaf_resource_node_entry,
+			     &leaf_resource_node_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -479,18 +643,6 @@ int libwrc_resource_read_value(
 
 				goto on_error;
 			}
-			if( leaf_resource_node_entry == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: invalid resource leaf node: %d entry.",
-				 function,
-				 leaf_node_index );
-
-				goto on_error;
-			}
 			if( leaf_resource_node_entry->data_descriptor == NULL )
 			{
 				libcerror_error_set(
@@ -503,8 +655,6 @@ int libwrc_resource_read_value(
 
 				goto on_error;
 			}
-			data_descriptor = leaf_resource_node_entry->data_descriptor;
-
 			switch( internal_resource->resource_node_entry->type )
 			{
 				case LIBWRC_RESOURCE_TYPE_STRING_TABLE:
@@ -638,75 +788,13 @@ int libwrc_resource_read_value(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			switch( internal_resource->resource_node_entry->type )
-			{
-				case LIBWRC_RESOURCE_TYPE_STRING_TABLE:
-					result = libwrc_string_values_read(
-					          language_entry,
-					          internal_resource->io_handle,
-					          internal_resource->file_io_handle,
-					          sub_resource_node_entry->identifier - 1,
-					          data_descriptor,
-					          error );
-					break;
-
-				case LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE:
-					result = libwrc_message_table_values_read(
-					          language_entry,
-					          internal_resource->io_handle,
-					          internal_resource->file_io_handle,
-					          data_descriptor,
-					          error );
-					break;
-
-				case LIBWRC_RESOURCE_TYPE_MANIFEST:
-					result = libwrc_manifest_values_read(
-					          language_entry,
-					          internal_resource->io_handle,
-					          internal_resource->file_io_handle,
-					          data_descriptor,
-					          error );
-					break;
-
-				case LIBWRC_RESOURCE_TYPE_MUI:
-					result = libwrc_mui_values_read(
-					          language_entry,
-					          internal_resource->io_handle,
-					          internal_resource->file_io_handle,
-					          data_descriptor,
-					          error );
-					break;
-
-				case LIBWRC_RESOURCE_TYPE_VERSION_INFORMATION:
-					result = libwrc_version_values_read(
-					          language_entry,
-					          internal_resource->io_handle,
-					          internal_resource->file_io_handle,
-					          data_descriptor,
-					          error );
-					break;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-				default:
-					if( libwrc_resource_read_data_descriptor(
-					     internal_resource,
-					     internal_resource->io_handle,
-					     internal_resource->file_io_handle,
-					     data_descriptor,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: unable to read unknown resource.",
-						 function );
+			result = libwrc_internal_resource_read_leaf_value(
+			          internal_resource,
+			          sub_resource_node_entry,
+			          leaf_resource_node_entry,
+			          language_entry,
+			          error );
 
-						goto on_error;
-					}
-					break;
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-			}
 			switch( internal_resource->resource_node_entry->type )
 			{
 				case LIBWRC_RESOURCE_TYPE_STRING_TABLE:
@@ -784,6 +872,22 @@ int libwrc_resource_read_value(
 					language_entry = NULL;
 
 					break;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				default:
+					if( result != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read unknown resource.",
+						 function );
+
+						goto on_error;
+					}
+					break;
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 			}
 		}
 	}
@@ -820,11 +924,9 @@ int libwrc_resource_read_data_descriptor(
      libwrc_data_descriptor_t *data_descriptor,
      libcerror_error_t **error )
 {
-	uint8_t *resource_data    = NULL;
-	static char *function     = "libwrc_resource_read_data_descriptor";
-	off64_t file_offset       = 0;
-	size_t resource_data_size = 0;
-	ssize_t read_count        = 0;
+	const uint8_t *resource_data  = NULL;
+	uint8_t *resource_data_buffer = NULL;
+	static char *function         = "libwrc_resource_read_data_descriptor";
 
 	if( internal_resource == NULL )
 	{
@@ -859,53 +961,20 @@ int libwrc_resource_read_data_descriptor(
 
 		return( -1 );
 	}
-	resource_data_size = (size_t) data_descriptor->size;
-
-	if( ( resource_data_size == 0 )
-	 || ( resource_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource data size value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-	resource_data = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * resource_data_size );
-
-	if( resource_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create resource data.",
-		 function );
-
-		goto on_error;
-	}
-	file_offset = data_descriptor->virtual_address - io_handle->virtual_address;
-
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              resource_data,
-	              resource_data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) resource_data_size )
+	if( libwrc_io_handle_read_resource_data(
+	     io_handle,
+	     file_io_handle,
+	     data_descriptor,
+	     &resource_data,
+	     &resource_data_buffer,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read resource data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 "%s: unable to read resource data.",
+		 function );
 
 		goto on_error;
 	}
@@ -917,20 +986,35 @@ int libwrc_resource_read_data_descriptor(
 		 function );
 		libcnotify_print_data(
 		 resource_data,
-		 resource_data_size,
+		 (size_t) data_descriptor->size,
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	memory_free(
-	 resource_data );
+	if( libwrc_io_handle_free_resource_data(
+	     io_handle,
+	     data_descriptor,
+	     &resource_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource data.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
-	if( resource_data != NULL )
+	if( resource_data_buffer != NULL )
 	{
-		memory_free(
-		 resource_data );
+		libwrc_io_handle_free_resource_data(
+		 io_handle,
+		 data_descriptor,
+		 &resource_data_buffer,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -1215,6 +1299,7 @@ int libwrc_resource_get_value_by_language_identifier(
 	libwrc_internal_resource_t *internal_resource = NULL;
 	libwrc_language_entry_t *language_entry       = NULL;
 	static char *function                         = "libwrc_resource_get_value_by_language_identifier";
+	int result                                    = 1;
 
 	if( resource == NULL )
 	{
@@ -1252,27 +1337,40 @@ int libwrc_resource_get_value_by_language_identifier(
 
 		return( -1 );
 	}
-	if( internal_resource->value == NULL )
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_resource->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libwrc_resource_read_value(
-		     internal_resource,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read resource value.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( libwrc_language_table_get_entry_by_identifier(
-	     (libwrc_language_table_t *) internal_resource->value,
-	     language_identifier,
-	     &language_entry,
-	     error ) != 1 )
+#endif
+	if( ( internal_resource->value == NULL )
+	 && ( libwrc_resource_read_value(
+	       internal_resource,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resource value.",
+		 function );
+
+		result = -1;
+	}
+	else if( libwrc_language_table_get_entry_by_identifier(
+	          (libwrc_language_table_t *) internal_resource->value,
+	          language_identifier,
+	          &language_entry,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1282,13 +1380,13 @@ int libwrc_resource_get_value_by_language_identifier(
 		 function,
 		 language_identifier );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libwrc_language_entry_get_value_by_index(
-	     language_entry,
-	     value_index,
-	     value,
-	     error ) != 1 )
+	else if( libwrc_language_entry_get_value_by_index(
+	          language_entry,
+	          value_index,
+	          value,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1298,9 +1396,24 @@ int libwrc_resource_get_value_by_language_identifier(
 		 function,
 		 value_index );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_resource->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves the number of items
@@ -1327,8 +1440,8 @@ int libwrc_resource_get_number_of_items(
 	}
 	internal_resource = (libwrc_internal_resource_t *) resource;
 
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_resource->resource_node,
+	if( libwrc_resource_node_entry_get_number_of_sub_entries(
+	     internal_resource->resource_node_entry,
 	     number_of_items,
 	     error ) != 1 )
 	{
@@ -1353,9 +1466,9 @@ int libwrc_resource_get_item_by_index(
      libwrc_resource_item_t **resource_item,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *resource_sub_node       = NULL;
-	libwrc_internal_resource_t *internal_resource = NULL;
-	static char *function                         = "libwrc_resource_get_item_by_index";
+	libwrc_internal_resource_t *internal_resource         = NULL;
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	static char *function                                 = "libwrc_resource_get_item_by_index";
 
 	if( resource == NULL )
 	{
@@ -1370,10 +1483,10 @@ int libwrc_resource_get_item_by_index(
 	}
 	internal_resource = (libwrc_internal_resource_t *) resource;
 
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     internal_resource->resource_node,
+	if( libwrc_resource_node_entry_get_sub_entry_by_index(
+	     internal_resource->resource_node_entry,
 	     item_index,
-	     &resource_sub_node,
+	     &sub_resource_node_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1390,7 +1503,7 @@ int libwrc_resource_get_item_by_index(
 	     resource_item,
 	     internal_resource->io_handle,
 	     internal_resource->file_io_handle,
-	     resource_sub_node,
+	     sub_resource_node_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
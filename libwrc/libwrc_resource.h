@@ -27,9 +27,11 @@
 
 #include "libwrc_extern.h"
 #include "libwrc_io_handle.h"
+#include "libwrc_language_entry.h"
+#include "libwrc_language_table.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_libcthreads.h"
 #include "libwrc_resource_node_entry.h"
 #include "libwrc_types.h"
 
@@ -49,10 +51,6 @@ struct libwrc_internal_resource
 	 */
 	libbfio_handle_t *file_io_handle;
 
-	/* The resource node
-	 */
-	libcdata_tree_node_t *resource_node;
-
 	/* The resource node entry
 	 */
 	libwrc_resource_node_entry_t *resource_node_entry;
@@ -66,13 +64,19 @@ struct libwrc_internal_resource
 	int (*free_value)(
 	       intptr_t **value,
 	       libcerror_error_t **error );
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libwrc_resource_initialize(
      libwrc_resource_t **resource,
      libwrc_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_tree_node_t *resource_node,
+     libwrc_resource_node_entry_t *resource_node_entry,
      libcerror_error_t **error );
 
 LIBWRC_EXTERN \
@@ -80,6 +84,13 @@ int libwrc_resource_free(
      libwrc_resource_t **resource,
      libcerror_error_t **error );
 
+int libwrc_internal_resource_read_leaf_value(
+     libwrc_internal_resource_t *internal_resource,
+     libwrc_resource_node_entry_t *sub_resource_node_entry,
+     libwrc_resource_node_entry_t *leaf_resource_node_entry,
+     libwrc_language_entry_t *language_entry,
+     libcerror_error_t **error );
+
 int libwrc_resource_read_value(
      libwrc_internal_resource_t *internal_resource,
      libcerror_error_t **error );
@@ -25,8 +25,8 @@
 
 #include "libwrc_io_handle.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_libcthreads.h"
 #include "libwrc_resource_item.h"
 #include "libwrc_resource_node_entry.h"
 
@@ -38,11 +38,10 @@ int libwrc_resource_item_initialize(
      libwrc_resource_item_t **resource_item,
      libwrc_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_tree_node_t *resource_node,
+     libwrc_resource_node_entry_t *resource_node_entry,
      libcerror_error_t **error )
 {
 	libwrc_internal_resource_item_t *internal_resource_item = NULL;
-	libwrc_resource_node_entry_t *resource_node_entry       = NULL;
 	static char *function                                   = "libwrc_resource_item_initialize";
 
 	if( resource_item == NULL )
@@ -67,30 +66,16 @@ int libwrc_resource_item_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_value(
-	     resource_node,
-	     (intptr_t **) &resource_node_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve resource node entry.",
-		 function );
-
-		goto on_error;
-	}
 	if( resource_node_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
 		 "%s: invalid resource node entry.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	internal_resource_item = memory_allocate_structure(
 	                          libwrc_internal_resource_item_t );
@@ -125,9 +110,23 @@ int libwrc_resource_item_initialize(
 	}
 	internal_resource_item->io_handle           = io_handle;
 	internal_resource_item->file_io_handle      = file_io_handle;
-	internal_resource_item->resource_node       = resource_node;
 	internal_resource_item->resource_node_entry = resource_node_entry;
 
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_resource_item->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*resource_item = (libwrc_resource_item_t *) internal_resource_item;
 
 	return( 1 );
@@ -150,6 +149,7 @@ int libwrc_resource_item_free(
 {
 	libwrc_internal_resource_item_t *internal_resource_item = NULL;
 	static char *function                                   = "libwrc_resource_item_free";
+	int result                                              = 1;
 
 	if( resource_item == NULL )
 	{
@@ -167,10 +167,25 @@ int libwrc_resource_item_free(
 		internal_resource_item = (libwrc_internal_resource_item_t *) *resource_item;
 		*resource_item         = NULL;
 
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_resource_item->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_resource_item );
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the resource item identifier
@@ -398,21 +413,25 @@ int libwrc_resource_item_get_utf16_name(
 	return( result );
 }
 
-/* Reads resource item data from the current offset into a buffer
+/* Reads resource item data at a specific offset into a buffer
+ * This function does not use or change the current offset
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libwrc_resource_item_read_buffer(
-         libwrc_resource_item_t *resource_item,
+ssize_t libwrc_internal_resource_item_read_buffer_at_offset(
+         libwrc_internal_resource_item_t *internal_resource_item,
          uint8_t *buffer,
          size_t size,
+         off64_t offset,
          libcerror_error_t **error )
 {
-	libwrc_internal_resource_item_t *internal_resource_item = NULL;
-	static char *function                                   = "libwrc_resource_item_read_buffer";
-	ssize_t read_count                                      = 0;
-	off64_t data_offset                                     = 0;
+	const uint8_t *stream_data = NULL;
+	static char *function      = "libwrc_internal_resource_item_read_buffer_at_offset";
+	size_t stream_data_size    = 0;
+	ssize_t read_count         = 0;
+	off64_t data_offset        = 0;
+	int result                 = 0;
 
-	if( resource_item == NULL )
+	if( internal_resource_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -423,8 +442,6 @@ ssize_t libwrc_resource_item_read_buffer(
 
 		return( -1 );
 	}
-	internal_resource_item = (libwrc_internal_resource_item_t *) resource_item;
-
 	if( internal_resource_item->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -458,59 +475,98 @@ ssize_t libwrc_resource_item_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_resource_item->current_offset < 0 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource item - current offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_resource_item->current_offset >= (off64_t) internal_resource_item->resource_node_entry->data_descriptor->size )
+	if( offset >= (off64_t) internal_resource_item->resource_node_entry->data_descriptor->size )
 	{
 		return( 0 );
 	}
 	if( ( size > (size64_t) internal_resource_item->resource_node_entry->data_descriptor->size )
-	 || ( (size64_t) internal_resource_item->current_offset > ( (size64_t) internal_resource_item->resource_node_entry->data_descriptor->size - size ) ) )
+	 || ( (size64_t) offset > ( (size64_t) internal_resource_item->resource_node_entry->data_descriptor->size - size ) ) )
 	{
-		size = (size_t)( (off64_t) internal_resource_item->resource_node_entry->data_descriptor->size - internal_resource_item->current_offset );
+		size = (size_t)( (off64_t) internal_resource_item->resource_node_entry->data_descriptor->size - offset );
 	}
 	data_offset  = internal_resource_item->resource_node_entry->data_descriptor->virtual_address;
 	data_offset -= internal_resource_item->io_handle->virtual_address;
-	data_offset += internal_resource_item->current_offset;
+	data_offset += offset;
 
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              internal_resource_item->file_io_handle,
-	              buffer,
-	              size,
-	              data_offset,
-	              error );
+	result = libwrc_io_handle_get_stream_data_at_offset(
+	          internal_resource_item->io_handle,
+	          data_offset,
+	          &stream_data,
+	          &stream_data_size,
+	          error );
 
+	if( result == 1 )
+	{
+		if( size > stream_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     stream_data,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy resource data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) size;
+	}
+	else if( result == 0 )
+	{
+		read_count = libwrc_io_handle_read_buffer_at_offset(
+		              internal_resource_item->io_handle,
+		              internal_resource_item->file_io_handle,
+		              buffer,
+		              size,
+		              data_offset,
+		              error );
+	}
 	if( read_count != (ssize_t) size )
 	{
 		libcerror_error_set(
@@ -527,7 +583,90 @@ ssize_t libwrc_resource_item_read_buffer(
 	return( read_count );
 }
 
-/* Reads resource item data a specific offset into a buffer
+/* Reads resource item data from the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libwrc_resource_item_read_buffer(
+         libwrc_resource_item_t *resource_item,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libwrc_internal_resource_item_t *internal_resource_item = NULL;
+	static char *function                                   = "libwrc_resource_item_read_buffer";
+	ssize_t read_count                                      = 0;
+
+	if( resource_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_resource_item = (libwrc_internal_resource_item_t *) resource_item;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libwrc_internal_resource_item_read_buffer_at_offset(
+	              internal_resource_item,
+	              buffer,
+	              size,
+	              internal_resource_item->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		internal_resource_item->current_offset += (off64_t) read_count;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads resource item data at a specific offset into a buffer
+ * This function does not change the current offset, which allows multiple threads
+ * to read the same resource item concurrently
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libwrc_resource_item_read_buffer_at_offset(
@@ -537,28 +676,43 @@ ssize_t libwrc_resource_item_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function = "libwrc_resource_item_read_buffer_at_offset";
-	ssize_t read_count    = 0;
+	libwrc_internal_resource_item_t *internal_resource_item = NULL;
+	static char *function                                   = "libwrc_resource_item_read_buffer_at_offset";
+	ssize_t read_count                                      = 0;
 
-	if( libwrc_resource_item_seek_offset(
-	     resource_item,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( resource_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_resource_item = (libwrc_internal_resource_item_t *) resource_item;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libwrc_resource_item_read_buffer(
-	              resource_item,
+#endif
+	read_count = libwrc_internal_resource_item_read_buffer_at_offset(
+	              internal_resource_item,
 	              buffer,
 	              buffer_size,
+	              offset,
 	              error );
 
 	if( read_count < 0 )
@@ -570,8 +724,23 @@ ssize_t libwrc_resource_item_read_buffer_at_offset(
 		 "%s: unable to read buffer.",
 		 function );
 
+		read_count = -1;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
 		return( -1 );
 	}
+#endif
 	return( read_count );
 }
 
@@ -646,6 +815,21 @@ off64_t libwrc_resource_item_seek_offset(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( whence == SEEK_CUR )
 	{
 		offset += internal_resource_item->current_offset;
@@ -663,10 +847,27 @@ off64_t libwrc_resource_item_seek_offset(
 		 "%s: unable to seek offset.",
 		 function );
 
-		return( -1 );
+		offset = -1;
 	}
-	internal_resource_item->current_offset = offset;
+	else
+	{
+		internal_resource_item->current_offset = offset;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
+		return( -1 );
+	}
+#endif
 	return( offset );
 }
 
@@ -727,8 +928,38 @@ int libwrc_resource_item_get_offset(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	*offset = internal_resource_item->current_offset;
 
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_resource_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 }
 
@@ -812,8 +1043,8 @@ int libwrc_resource_item_get_number_of_sub_items(
 	}
 	internal_resource_item = (libwrc_internal_resource_item_t *) resource_item;
 
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_resource_item->resource_node,
+	if( libwrc_resource_node_entry_get_number_of_sub_entries(
+	     internal_resource_item->resource_node_entry,
 	     number_of_sub_items,
 	     error ) != 1 )
 	{
@@ -838,8 +1069,8 @@ int libwrc_resource_item_get_sub_item_by_index(
      libwrc_resource_item_t **resource_sub_item,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *resource_sub_node                 = NULL;
 	libwrc_internal_resource_item_t *internal_resource_item = NULL;
+	libwrc_resource_node_entry_t *sub_resource_node_entry   = NULL;
 	static char *function                                   = "libwrc_resource_item_get_sub_item_by_index";
 
 	if( resource_item == NULL )
@@ -855,10 +1086,10 @@ int libwrc_resource_item_get_sub_item_by_index(
 	}
 	internal_resource_item = (libwrc_internal_resource_item_t *) resource_item;
 
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     internal_resource_item->resource_node,
+	if( libwrc_resource_node_entry_get_sub_entry_by_index(
+	     internal_resource_item->resource_node_entry,
 	     sub_item_index,
-	     &resource_sub_node,
+	     &sub_resource_node_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -875,7 +1106,7 @@ int libwrc_resource_item_get_sub_item_by_index(
 	     resource_sub_item,
 	     internal_resource_item->io_handle,
 	     internal_resource_item->file_io_handle,
-	     resource_sub_node,
+	     sub_resource_node_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -28,8 +28,8 @@
 #include "libwrc_extern.h"
 #include "libwrc_io_handle.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_libcthreads.h"
 #include "libwrc_resource_node_entry.h"
 #include "libwrc_types.h"
 
@@ -49,10 +49,6 @@ struct libwrc_internal_resource_item
 	 */
 	libbfio_handle_t *file_io_handle;
 
-	/* The resource node
-	 */
-	libcdata_tree_node_t *resource_node;
-
 	/* The resource node entry
 	 */
 	libwrc_resource_node_entry_t *resource_node_entry;
@@ -60,13 +56,19 @@ struct libwrc_internal_resource_item
 	/* The current data offset
 	 */
 	off64_t current_offset;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libwrc_resource_item_initialize(
      libwrc_resource_item_t **resource_item,
      libwrc_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_tree_node_t *resource_node,
+     libwrc_resource_node_entry_t *resource_node_entry,
      libcerror_error_t **error );
 
 LIBWRC_EXTERN \
@@ -106,6 +108,13 @@ int libwrc_resource_item_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+ssize_t libwrc_internal_resource_item_read_buffer_at_offset(
+         libwrc_internal_resource_item_t *internal_resource_item,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBWRC_EXTERN \
 ssize_t libwrc_resource_item_read_buffer(
          libwrc_resource_item_t *resource_item,
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libwrc_arena.h"
 #include "libwrc_data_descriptor.h"
 #include "libwrc_debug.h"
 #include "libwrc_definitions.h"
@@ -33,6 +34,7 @@
 #include "libwrc_libcnotify.h"
 #include "libwrc_libuna.h"
 #include "libwrc_resource_node_entry.h"
+#include "libwrc_utf8_string.h"
 
 #include "wrc_resource_node.h"
 
@@ -132,8 +134,82 @@ int libwrc_resource_node_entry_free(
 	}
 	if( *resource_node_entry != NULL )
 	{
+		if( libwrc_resource_node_entry_clear(
+		     *resource_node_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear table entry.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *resource_node_entry );
+
+		*resource_node_entry = NULL;
+	}
+	return( result );
+}
+
+/* Clears a table entry
+ * Frees the data descriptor, name string and sub entries if not shared
+ * and not allocated from an arena
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_entry_clear(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_resource_node_entry_clear";
+	int result            = 1;
+	int sub_entry_index   = 0;
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Memory allocated from an arena is released when the arena is reset or freed
+	 */
+	if( resource_node_entry->arena_allocated == 0 )
+	{
+		if( ( resource_node_entry->sub_entries != NULL )
+		 && ( resource_node_entry->sub_entries_shared == 0 ) )
+		{
+			for( sub_entry_index = 0;
+			     sub_entry_index < resource_node_entry->number_of_sub_entries;
+			     sub_entry_index++ )
+			{
+				if( libwrc_resource_node_entry_clear(
+				     &( resource_node_entry->sub_entries[ sub_entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to clear sub entry: %d.",
+					 function,
+					 sub_entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 resource_node_entry->sub_entries );
+		}
 		if( libwrc_data_descriptor_free(
-		     &( ( *resource_node_entry )->data_descriptor ),
+		     &( resource_node_entry->data_descriptor ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -145,15 +221,25 @@ int libwrc_resource_node_entry_free(
 
 			result = -1;
 		}
-		if( ( *resource_node_entry )->name_string != NULL )
+		if( resource_node_entry->name_string != NULL )
 		{
 			memory_free(
-			 ( *resource_node_entry )->name_string );
+			 resource_node_entry->name_string );
 		}
-		memory_free(
-		 *resource_node_entry );
+	}
+	if( memory_set(
+	     resource_node_entry,
+	     0,
+	     sizeof( libwrc_resource_node_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table entry.",
+		 function );
 
-		*resource_node_entry = NULL;
+		result = -1;
 	}
 	return( result );
 }
@@ -224,6 +310,8 @@ int libwrc_resource_node_entry_read_data(
 	 ( (wrc_resource_node_entry_t *) data )->offset,
 	 resource_node_entry->offset );
 
+	resource_node_entry->node_level = node_level;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -328,12 +416,180 @@ int libwrc_resource_node_entry_read_file_io_handle(
 	return( 1 );
 }
 
+/* Reads the resource node entry name from data
+ * The data is expected to start with the name string size
+ * The name string is allocated from the arena if set
+ * Returns 1 if successful, 0 if the resource node entry has no name or -1 on error
+ */
+int libwrc_resource_node_entry_read_name_data(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libwrc_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function   = "libwrc_resource_node_entry_read_name_data";
+	size_t name_string_size = 0;
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 2 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_node_entry->identifier & LIBWRC_RESOURCE_IDENTIFIER_FLAG_HAS_NAME ) == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 data,
+	 name_string_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: name string size\t: %" PRIzd "\n",
+		 function,
+		 name_string_size );
+	}
+#endif
+	name_string_size *= 2;
+
+	if( ( name_string_size == 0 )
+	 || ( name_string_size > ( data_size - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena != NULL )
+	{
+		if( resource_node_entry->name_string != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid resource node entry - name string value already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( libwrc_arena_allocate(
+		     arena,
+		     name_string_size,
+		     (void **) &( resource_node_entry->name_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name string.",
+			 function );
+
+			return( -1 );
+		}
+		resource_node_entry->name_string_size = name_string_size;
+
+		if( memory_copy(
+		     resource_node_entry->name_string,
+		     &( data[ 2 ] ),
+		     name_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libwrc_resource_node_entry_set_name_string(
+	          resource_node_entry,
+	          &( data[ 2 ] ),
+	          name_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libwrc_debug_print_utf16_string_value(
+		     function,
+		     "name string\t",
+		     resource_node_entry->name_string,
+		     resource_node_entry->name_string_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print UTF-16 string value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
 /* Reads the resource node entry name
+ * The name string is allocated from the arena if set
  * Returns 1 if successful, 0 if not available or -1 on error
  */
 int libwrc_resource_node_entry_read_name_file_io_handle(
      libwrc_resource_node_entry_t *resource_node_entry,
      libbfio_handle_t *file_io_handle,
+     libwrc_arena_t *arena,
      libcerror_error_t **error )
 {
 	uint8_t name_size_data[ 2 ];
@@ -417,9 +673,22 @@ int libwrc_resource_node_entry_read_name_file_io_handle(
 
 		goto on_error;
 	}
-	resource_node_entry->name_string = (uint8_t *) memory_allocate(
-	                                                sizeof( uint8_t ) * name_string_size );
-
+	if( arena != NULL )
+	{
+		if( libwrc_arena_allocate(
+		     arena,
+		     name_string_size,
+		     (void **) &( resource_node_entry->name_string ),
+		     error ) != 1 )
+		{
+			resource_node_entry->name_string = NULL;
+		}
+	}
+	else
+	{
+		resource_node_entry->name_string = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * name_string_size );
+	}
 	if( resource_node_entry->name_string == NULL )
 	{
 		libcerror_error_set(
@@ -476,13 +745,13 @@ int libwrc_resource_node_entry_read_name_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( resource_node_entry->name_string != NULL )
+	if( ( resource_node_entry->name_string != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 resource_node_entry->name_string );
-
-		resource_node_entry->name_string = NULL;
 	}
+	resource_node_entry->name_string      = NULL;
 	resource_node_entry->name_string_size = 0;
 
 	return( -1 );
@@ -707,10 +976,9 @@ int libwrc_resource_node_entry_get_utf8_name_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libwrc_utf8_string_size_from_utf16_stream(
 	     resource_node_entry->name_string,
 	     resource_node_entry->name_string_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -776,12 +1044,11 @@ int libwrc_resource_node_entry_get_utf8_name(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libwrc_utf8_string_copy_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     resource_node_entry->name_string,
 	     resource_node_entry->name_string_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -960,3 +1227,333 @@ int libwrc_resource_node_entry_get_type(
 	return( 1 );
 }
 
+
+/* Retrieves the number of sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_entry_get_number_of_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     int *number_of_sub_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_resource_node_entry_get_number_of_sub_entries";
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_sub_entries = resource_node_entry->number_of_sub_entries;
+
+	return( 1 );
+}
+
+/* Sets the number of sub entries
+ * The sub entries are stored in a single contiguous array
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_entry_set_number_of_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     int number_of_sub_entries,
+     libcerror_error_t **error )
+{
+	static char *function   = "libwrc_resource_node_entry_set_number_of_sub_entries";
+	size_t sub_entries_size = 0;
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry->sub_entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource node entry - sub entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of sub entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_sub_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwrc_resource_node_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of sub entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	sub_entries_size = sizeof( libwrc_resource_node_entry_t ) * number_of_sub_entries;
+
+	resource_node_entry->sub_entries = (libwrc_resource_node_entry_t *) memory_allocate(
+	                                                                    sub_entries_size );
+
+	if( resource_node_entry->sub_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     resource_node_entry->sub_entries,
+	     0,
+	     sub_entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub entries.",
+		 function );
+
+		memory_free(
+		 resource_node_entry->sub_entries );
+
+		resource_node_entry->sub_entries = NULL;
+
+		return( -1 );
+	}
+	resource_node_entry->number_of_sub_entries = number_of_sub_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific sub entry
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_entry_get_sub_entry_by_index(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     int sub_entry_index,
+     libwrc_resource_node_entry_t **sub_resource_node_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_resource_node_entry_get_sub_entry_by_index";
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_entry_index < 0 )
+	 || ( sub_entry_index >= resource_node_entry->number_of_sub_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_resource_node_entry = &( resource_node_entry->sub_entries[ sub_entry_index ] );
+
+	return( 1 );
+}
+
+/* Sorts the sub entries by identifier
+ * This uses a stable merge sort so that entries with the same identifier retain their on-disk order
+ * The sorted entries are stored in the original sub entries array
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_entry_sort_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t *sorted_sub_entries = NULL;
+	libwrc_resource_node_entry_t *source_sub_entries = NULL;
+	libwrc_resource_node_entry_t *swap_sub_entries   = NULL;
+	static char *function                            = "libwrc_resource_node_entry_sort_sub_entries";
+	size_t sub_entries_size                          = 0;
+	int first_index                                  = 0;
+	int last_index                                   = 0;
+	int left_index                                   = 0;
+	int middle_index                                 = 0;
+	int number_of_sub_entries                        = 0;
+	int right_index                                  = 0;
+	int sorted_index                                 = 0;
+	int width                                        = 0;
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sub_entries = resource_node_entry->number_of_sub_entries;
+
+	/* Directory entries are normally stored in sorted order
+	 */
+	for( sorted_index = 1;
+	     sorted_index < number_of_sub_entries;
+	     sorted_index++ )
+	{
+		if( resource_node_entry->sub_entries[ sorted_index - 1 ].identifier > resource_node_entry->sub_entries[ sorted_index ].identifier )
+		{
+			break;
+		}
+	}
+	if( sorted_index >= number_of_sub_entries )
+	{
+		return( 1 );
+	}
+	sub_entries_size = sizeof( libwrc_resource_node_entry_t ) * number_of_sub_entries;
+
+	sorted_sub_entries = (libwrc_resource_node_entry_t *) memory_allocate(
+	                                                      sub_entries_size );
+
+	if( sorted_sub_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	source_sub_entries = resource_node_entry->sub_entries;
+
+	for( width = 1;
+	     width < number_of_sub_entries;
+	     width *= 2 )
+	{
+		sorted_index = 0;
+
+		for( first_index = 0;
+		     first_index < number_of_sub_entries;
+		     first_index += 2 * width )
+		{
+			middle_index = first_index + width;
+
+			if( middle_index > number_of_sub_entries )
+			{
+				middle_index = number_of_sub_entries;
+			}
+			last_index = middle_index + width;
+
+			if( last_index > number_of_sub_entries )
+			{
+				last_index = number_of_sub_entries;
+			}
+			left_index  = first_index;
+			right_index = middle_index;
+
+			while( ( left_index < middle_index )
+			    || ( right_index < last_index ) )
+			{
+				if( ( right_index >= last_index )
+				 || ( ( left_index < middle_index )
+				  && ( source_sub_entries[ left_index ].identifier <= source_sub_entries[ right_index ].identifier ) ) )
+				{
+					sorted_sub_entries[ sorted_index++ ] = source_sub_entries[ left_index++ ];
+				}
+				else
+				{
+					sorted_sub_entries[ sorted_index++ ] = source_sub_entries[ right_index++ ];
+				}
+			}
+		}
+		swap_sub_entries   = source_sub_entries;
+		source_sub_entries = sorted_sub_entries;
+		sorted_sub_entries = swap_sub_entries;
+	}
+	/* The sub entries array can be allocated from an arena, hence the sorted entries
+	 * are copied back into it if needed
+	 */
+	if( source_sub_entries != resource_node_entry->sub_entries )
+	{
+		if( memory_copy(
+		     resource_node_entry->sub_entries,
+		     source_sub_entries,
+		     sub_entries_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted sub entries.",
+			 function );
+
+			memory_free(
+			 source_sub_entries );
+
+			return( -1 );
+		}
+		sorted_sub_entries = source_sub_entries;
+	}
+	memory_free(
+	 sorted_sub_entries );
+
+	return( 1 );
+}
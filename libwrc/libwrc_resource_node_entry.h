@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libwrc_arena.h"
 #include "libwrc_data_descriptor.h"
 #include "libwrc_libbfio.h"
 #include "libwrc_libcerror.h"
@@ -60,6 +61,30 @@ struct libwrc_resource_node_entry
 	/* The type
 	 */
 	int type;
+
+	/* The sub entries
+	 */
+	libwrc_resource_node_entry_t *sub_entries;
+
+	/* The number of sub entries
+	 */
+	int number_of_sub_entries;
+
+	/* The node level
+	 */
+	int node_level;
+
+	/* Value to indicate the sub entries were read
+	 */
+	uint8_t sub_entries_read;
+
+	/* Value to indicate the sub entries are shared with another resource node entry
+	 */
+	uint8_t sub_entries_shared;
+
+	/* Value to indicate the sub entries, name string and data descriptor are allocated from an arena
+	 */
+	uint8_t arena_allocated;
 };
 
 int libwrc_resource_node_entry_initialize(
@@ -70,6 +95,10 @@ int libwrc_resource_node_entry_free(
      libwrc_resource_node_entry_t **resource_node_entry,
      libcerror_error_t **error );
 
+int libwrc_resource_node_entry_clear(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error );
+
 int libwrc_resource_node_entry_read_data(
      libwrc_resource_node_entry_t *resource_node_entry,
      const uint8_t *data,
@@ -84,9 +113,17 @@ int libwrc_resource_node_entry_read_file_io_handle(
      int node_level,
      libcerror_error_t **error );
 
+int libwrc_resource_node_entry_read_name_data(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libwrc_arena_t *arena,
+     libcerror_error_t **error );
+
 int libwrc_resource_node_entry_read_name_file_io_handle(
      libwrc_resource_node_entry_t *resource_node_entry,
      libbfio_handle_t *file_io_handle,
+     libwrc_arena_t *arena,
      libcerror_error_t **error );
 
 int libwrc_resource_node_entry_compare(
@@ -132,6 +169,26 @@ int libwrc_resource_node_entry_get_type(
      int *type,
      libcerror_error_t **error );
 
+int libwrc_resource_node_entry_get_number_of_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     int *number_of_sub_entries,
+     libcerror_error_t **error );
+
+int libwrc_resource_node_entry_set_number_of_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     int number_of_sub_entries,
+     libcerror_error_t **error );
+
+int libwrc_resource_node_entry_get_sub_entry_by_index(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     int sub_entry_index,
+     libwrc_resource_node_entry_t **sub_resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_resource_node_entry_sort_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -19,20 +19,24 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libwrc_arena.h"
 #include "libwrc_definitions.h"
 #include "libwrc_io_handle.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
 #include "libwrc_libcnotify.h"
+#include "libwrc_node_offset_table.h"
+#include "libwrc_node_read_queue.h"
 #include "libwrc_resource_node_entry.h"
 #include "libwrc_resource_node_header.h"
 #include "libwrc_resource_node_tree.h"
 
+#include "wrc_data_descriptor.h"
 #include "wrc_resource_node.h"
 
 const uint8_t libwrc_resource_name_mui[ 6 ] = {
@@ -42,30 +46,51 @@ const uint8_t libwrc_resource_name_wevt_template[ 26 ] = {
 	'W', 0, 'E', 0, 'V', 0, 'T', 0, '_', 0, 'T', 0, 'E', 0, 'M', 0,
 	'P', 0, 'L', 0, 'A', 0, 'T', 0, 'E', 0 };
 
-/* Reads the node of a resource node tree
+/* Reads the header, entries and names of a node of a resource node tree
+ * The node header and entries are read at once and the names of the entries
+ * are read in a second pass, the sub nodes and data descriptors are not read
+ * A node that was read before is shared, or rejected if reject_shared_nodes
+ * is set in the IO handle, and a node that references itself is rejected
  * Returns 1 if successful or -1 on error
  */
-int libwrc_resource_node_tree_read_node(
-     libcdata_tree_node_t *node,
+int libwrc_resource_node_tree_read_node_entries(
+     libwrc_resource_node_entry_t *parent_resource_node_entry,
      libwrc_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      int node_level,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *sub_node                        = NULL;
-	libwrc_resource_node_entry_t *resource_node_entry     = NULL;
-	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
-	libwrc_resource_node_header_t *resource_node_header   = NULL;
-	static char *function                                 = "libwrc_resource_node_tree_read_node";
-	off64_t resource_node_entry_data_offset               = 0;
-	uint32_t entry_index                                  = 0;
-	uint32_t number_of_entries                            = 0;
-	uint32_t resource_node_entry_offset                   = 0;
-	int number_of_sub_nodes                               = 0;
-	int resource_node_entry_index                         = 0;
-	int result                                            = 0;
-	int sub_node_index                                    = 0;
+	uint8_t node_header_data[ sizeof( wrc_resource_node_header_t ) ];
+	uint8_t name_size_data[ 2 ];
+
+	libwrc_resource_node_header_t resource_node_header;
+
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	libwrc_resource_node_entry_t *shared_node_entry   = NULL;
+	const uint8_t *names_data                         = NULL;
+	const uint8_t *node_entries_data                  = NULL;
+	const uint8_t *stream_data                        = NULL;
+	uint8_t *name_data_buffer                         = NULL;
+	uint8_t *names_data_buffer                        = NULL;
+	uint8_t *node_entries_data_buffer                 = NULL;
+	static char *function                             = "libwrc_resource_node_tree_read_node_entries";
+	off64_t resource_node_entry_data_offset           = 0;
+	size_t name_data_size                             = 0;
+	size_t names_data_offset                          = 0;
+	size_t names_data_size                            = 0;
+	size_t node_entries_data_size                     = 0;
+	size_t stream_data_size                           = 0;
+	ssize_t read_count                                = 0;
+	uint32_t entry_index                              = 0;
+	uint32_t first_name_offset                        = 0;
+	uint32_t last_name_offset                         = 0;
+	uint32_t name_offset                              = 0;
+	uint32_t number_of_entries                        = 0;
+	uint32_t number_of_named_entries                  = 0;
+	uint32_t resource_node_entry_offset               = 0;
+	uint16_t name_size                                = 0;
+	int result                                        = 0;
 
 	if( io_handle == NULL )
 	{
@@ -90,34 +115,155 @@ int libwrc_resource_node_tree_read_node(
 
 		return( -1 );
 	}
-	if( node == NULL )
+	if( parent_resource_node_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 "%s: invalid parent resource node entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( libwrc_resource_node_header_initialize(
-	     &resource_node_header,
-	     error ) == -1 )
+	if( io_handle->node_offset_table != NULL )
+	{
+		result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+		          io_handle->node_offset_table,
+		          (uint32_t) file_offset,
+		          &shared_node_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource node entry of offset: %" PRIi64 " (0x%08" PRIx64 ") from node offset table.",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* A node that is still being read is referenced by one of its sub nodes
+			 * and a node read at another level would make the tree cyclic
+			 */
+			if( ( shared_node_entry->sub_entries_read == 0 )
+			 || ( shared_node_entry->node_level != parent_resource_node_entry->node_level ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid resource node at offset: %" PRIi64 " (0x%08" PRIx64 ") - cyclic reference.",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			if( io_handle->reject_shared_nodes != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported resource node at offset: %" PRIi64 " (0x%08" PRIx64 ") - referenced more than once.",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			parent_resource_node_entry->sub_entries           = shared_node_entry->sub_entries;
+			parent_resource_node_entry->number_of_sub_entries = shared_node_entry->number_of_sub_entries;
+			parent_resource_node_entry->sub_entries_shared    = 1;
+			parent_resource_node_entry->sub_entries_read      = 1;
+
+			return( 1 );
+		}
+		if( libwrc_node_offset_table_append_resource_node_entry(
+		     io_handle->node_offset_table,
+		     (uint32_t) file_offset,
+		     parent_resource_node_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append resource node entry of offset: %" PRIi64 " (0x%08" PRIx64 ") to node offset table.",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+	}
+	result = libwrc_io_handle_get_stream_data_at_offset(
+	          io_handle,
+	          file_offset,
+	          &stream_data,
+	          &stream_data_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create resource node header.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 
 		goto on_error;
 	}
-	if( libwrc_resource_node_header_read_file_io_handle(
-	     resource_node_header,
-	     file_io_handle,
-	     file_offset,
+	else if( result == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading resource node header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		read_count = libwrc_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              node_header_data,
+		              sizeof( wrc_resource_node_header_t ),
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) sizeof( wrc_resource_node_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read resource node header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		stream_data      = node_header_data;
+		stream_data_size = sizeof( wrc_resource_node_header_t );
+	}
+	if( libwrc_resource_node_header_read_data(
+	     &resource_node_header,
+	     stream_data,
+	     stream_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -131,92 +277,198 @@ int libwrc_resource_node_tree_read_node(
 
 		goto on_error;
 	}
-	file_offset += sizeof( wrc_resource_node_header_t );
+	number_of_entries = (uint32_t) resource_node_header.number_of_named_entries + (uint32_t) resource_node_header.number_of_unnamed_entries;
 
-	number_of_entries = (uint32_t) resource_node_header->number_of_named_entries + (uint32_t) resource_node_header->number_of_unnamed_entries;
+	node_entries_data_size          = (size_t) number_of_entries * sizeof( wrc_resource_node_entry_t );
+	resource_node_entry_data_offset = sizeof( wrc_resource_node_header_t ) + node_entries_data_size;
 
-	if( libwrc_resource_node_header_free(
-	     &resource_node_header,
-	     error ) == -1 )
+	if( ( (size64_t) resource_node_entry_data_offset > io_handle->stream_size )
+	 || ( (size64_t) file_offset > ( io_handle->stream_size - resource_node_entry_data_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resource node header.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	resource_node_entry_data_offset = sizeof( wrc_resource_node_header_t ) + ( number_of_entries * sizeof( wrc_resource_node_entry_t ) );
+	/* Resource nodes do not overlap hence the size of all the nodes read
+	 * cannot exceed the stream size, this bounds the number of entries read
+	 */
+	if( io_handle->node_offset_table != NULL )
+	{
+		if( (size64_t) resource_node_entry_data_offset > ( io_handle->stream_size - io_handle->node_offset_table->node_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid resource node at offset: %" PRIi64 " (0x%08" PRIx64 ") - size of resource nodes exceeds stream size.",
+			 function,
+			 file_offset,
+			 file_offset );
 
-	if( (size64_t) resource_node_entry_data_offset > io_handle->stream_size )
+			goto on_error;
+		}
+		io_handle->node_offset_table->node_data_size += resource_node_entry_data_offset;
+	}
+	if( libwrc_io_handle_update_statistics(
+	     io_handle,
+	     LIBWRC_STATISTICS_VALUE_TYPE_NODE,
+	     (uint64_t) number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of entries value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update statistics.",
 		 function );
 
 		goto on_error;
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	if( ( io_handle->arena != NULL )
+	 && ( number_of_entries > 0 ) )
 	{
-		if( libwrc_resource_node_entry_initialize(
-		     &resource_node_entry,
-		     error ) == -1 )
+		if( parent_resource_node_entry->sub_entries != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create resource node entry: %d.",
-			 function,
-			 entry_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid parent resource node entry - sub entries value already set.",
+			 function );
 
 			goto on_error;
 		}
-		if( libwrc_resource_node_entry_read_file_io_handle(
-		     resource_node_entry,
-		     file_io_handle,
-		     file_offset,
-		     node_level,
+		if( libwrc_arena_allocate(
+		     io_handle->arena,
+		     sizeof( libwrc_resource_node_entry_t ) * number_of_entries,
+		     (void **) &( parent_resource_node_entry->sub_entries ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub entries.",
+			 function );
+
+			goto on_error;
+		}
+		parent_resource_node_entry->number_of_sub_entries = (int) number_of_entries;
+		parent_resource_node_entry->arena_allocated       = 1;
+	}
+	else if( libwrc_resource_node_entry_set_number_of_sub_entries(
+	          parent_resource_node_entry,
+	          (int) number_of_entries,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of sub entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries == 0 )
+	{
+		parent_resource_node_entry->sub_entries_read = 1;
+
+		return( 1 );
+	}
+	file_offset += sizeof( wrc_resource_node_header_t );
+
+	/* The entries directly follow the header, when the stream data is available
+	 * in memory the entries are referenced otherwise they are read at once
+	 */
+	if( stream_data != node_header_data )
+	{
+		node_entries_data = &( stream_data[ sizeof( wrc_resource_node_header_t ) ] );
+	}
+	else
+	{
+		node_entries_data_buffer = (uint8_t *) memory_allocate(
+		                                        sizeof( uint8_t ) * node_entries_data_size );
+
+		if( node_entries_data_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create resource node entries data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_io_handle_update_statistics(
+		     io_handle,
+		     LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+		     (uint64_t) node_entries_data_size,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libwrc_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              node_entries_data_buffer,
+		              node_entries_data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) node_entries_data_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read resource node entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to read resource node entries data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
-			 entry_index,
 			 file_offset,
 			 file_offset );
 
 			goto on_error;
 		}
-		file_offset += sizeof( wrc_resource_node_entry_t );
-
-		result = libwrc_resource_node_entry_read_name_file_io_handle(
-		          resource_node_entry,
-		          file_io_handle,
-		          error );
+		node_entries_data = node_entries_data_buffer;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		resource_node_entry = &( parent_resource_node_entry->sub_entries[ entry_index ] );
 
-		if( result == -1 )
+		if( libwrc_resource_node_entry_read_data(
+		     resource_node_entry,
+		     &( node_entries_data[ entry_index * sizeof( wrc_resource_node_entry_t ) ] ),
+		     sizeof( wrc_resource_node_entry_t ),
+		     node_level,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read resource node entry: %d name.",
+			 "%s: unable to read resource node entry: %" PRIu32 ".",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
+		resource_node_entry->arena_allocated = parent_resource_node_entry->arena_allocated;
+
 		resource_node_entry_offset = resource_node_entry->offset & 0x7fffffffUL;
 
 		/* Check the bounds here to fail fast on corrupt data
@@ -228,65 +480,347 @@ int libwrc_resource_node_tree_read_node(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid resource node entry: %d - offset value out of bounds.",
+			 "%s: invalid resource node entry: %" PRIu32 " - offset value out of bounds.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		if( node_level == 1 )
+		if( ( resource_node_entry->identifier & LIBWRC_RESOURCE_IDENTIFIER_FLAG_HAS_NAME ) != 0 )
 		{
-			if( ( resource_node_entry->identifier & LIBWRC_RESOURCE_IDENTIFIER_FLAG_HAS_NAME ) == 0 )
+			name_offset = resource_node_entry->identifier & 0x7fffffffUL;
+
+			if( ( number_of_named_entries == 0 )
+			 || ( name_offset < first_name_offset ) )
 			{
-				switch( resource_node_entry->identifier )
-				{
-					case LIBWRC_RESOURCE_IDENTIFIER_CURSOR:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_CURSOR;
-						break;
+				first_name_offset = name_offset;
+			}
+			if( name_offset > last_name_offset )
+			{
+				last_name_offset = name_offset;
+			}
+			number_of_named_entries++;
+		}
+	}
+	if( node_entries_data_buffer != NULL )
+	{
+		memory_free(
+		 node_entries_data_buffer );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_BITMAP:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_BITMAP;
-						break;
+		node_entries_data_buffer = NULL;
 
-					case LIBWRC_RESOURCE_IDENTIFIER_ICON:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_ICON;
-						break;
+		if( libwrc_io_handle_update_statistics(
+		     io_handle,
+		     LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		     (uint64_t) node_entries_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_MENU:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_MENU;
-						break;
+			goto on_error;
+		}
+	}
+	/* The names are typically stored consecutively, when the stream data is not
+	 * available in memory the range containing the names is read at once
+	 */
+	if( ( number_of_named_entries > 0 )
+	 && ( io_handle->stream_data == NULL )
+	 && ( (size64_t) first_name_offset < io_handle->stream_size ) )
+	{
+		names_data_size = (size_t) ( last_name_offset - first_name_offset ) + 2;
 
-					case LIBWRC_RESOURCE_IDENTIFIER_DIALOG:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_DIALOG;
-						break;
+		if( (size64_t) names_data_size > ( io_handle->stream_size - first_name_offset ) )
+		{
+			names_data_size = (size_t) ( io_handle->stream_size - first_name_offset );
+		}
+		if( names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid names data size value exceeds maximum.",
+			 function );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_STRING:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_STRING;
-						break;
+			goto on_error;
+		}
+		names_data_buffer = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * names_data_size );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_FONT_DIRECTORY:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_FONT_DIRECTORY;
-						break;
+		if( names_data_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create names data.",
+			 function );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_FONT:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_FONT;
-						break;
+			goto on_error;
+		}
+		if( libwrc_io_handle_update_statistics(
+		     io_handle,
+		     LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+		     (uint64_t) names_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_ACCELERATOR:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_ACCELERATOR;
-						break;
+			goto on_error;
+		}
+		read_count = libwrc_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              names_data_buffer,
+		              names_data_size,
+		              (off64_t) first_name_offset,
+		              error );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_RAW_DATA:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_RAW_DATA;
-						break;
+		if( read_count != (ssize_t) names_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read names data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 first_name_offset,
+			 first_name_offset );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_MESSAGE_TABLE:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE;
-						break;
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		resource_node_entry = &( parent_resource_node_entry->sub_entries[ entry_index ] );
 
-					case LIBWRC_RESOURCE_IDENTIFIER_GROUP_CURSOR:
-						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_GROUP_CURSOR;
-						break;
+		if( ( resource_node_entry->identifier & LIBWRC_RESOURCE_IDENTIFIER_FLAG_HAS_NAME ) != 0 )
+		{
+			name_offset = resource_node_entry->identifier & 0x7fffffffUL;
+
+			result = libwrc_io_handle_get_stream_data_at_offset(
+			          io_handle,
+			          (off64_t) name_offset,
+			          &stream_data,
+			          &stream_data_size,
+			          error );
+
+			if( ( result == 0 )
+			 && ( names_data_buffer != NULL ) )
+			{
+				names_data_offset = (size_t) ( name_offset - first_name_offset );
+
+				if( ( names_data_offset + 2 ) <= names_data_size )
+				{
+					names_data = &( names_data_buffer[ names_data_offset ] );
+
+					byte_stream_copy_to_uint16_little_endian(
+					 names_data,
+					 name_size );
+
+					/* The last name can extend beyond the names data
+					 */
+					if( ( (size_t) name_size * 2 ) <= ( names_data_size - names_data_offset - 2 ) )
+					{
+						stream_data      = names_data;
+						stream_data_size = names_data_size - names_data_offset;
+						result           = 1;
+					}
+				}
+			}
+			if( result == 1 )
+			{
+				result = libwrc_resource_node_entry_read_name_data(
+				          resource_node_entry,
+				          stream_data,
+				          stream_data_size,
+				          io_handle->arena,
+				          error );
+			}
+			else if( result == 0 )
+			{
+				/* The name is not part of the names data, hence the name string size
+				 * and the name string are read separately
+				 */
+				read_count = libwrc_io_handle_read_buffer_at_offset(
+				              io_handle,
+				              file_io_handle,
+				              name_size_data,
+				              2,
+				              (off64_t) name_offset,
+				              error );
+
+				if( read_count != (ssize_t) 2 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read resource node entry: %" PRIu32 " name string size at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+					 function,
+					 entry_index,
+					 name_offset,
+					 name_offset );
+
+					goto on_error;
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 name_size_data,
+				 name_size );
+
+				name_data_size = 2 + ( (size_t) name_size * 2 );
+
+				name_data_buffer = (uint8_t *) memory_allocate(
+				                                sizeof( uint8_t ) * name_data_size );
+
+				if( name_data_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create name data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libwrc_io_handle_update_statistics(
+				     io_handle,
+				     LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+				     (uint64_t) name_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update statistics.",
+					 function );
+
+					goto on_error;
+				}
+				name_data_buffer[ 0 ] = name_size_data[ 0 ];
+				name_data_buffer[ 1 ] = name_size_data[ 1 ];
+
+				read_count = libwrc_io_handle_read_buffer_at_offset(
+				              io_handle,
+				              file_io_handle,
+				              &( name_data_buffer[ 2 ] ),
+				              name_data_size - 2,
+				              (off64_t) name_offset + 2,
+				              error );
+
+				if( read_count != (ssize_t) ( name_data_size - 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read resource node entry: %" PRIu32 " name string.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = libwrc_resource_node_entry_read_name_data(
+				          resource_node_entry,
+				          name_data_buffer,
+				          name_data_size,
+				          io_handle->arena,
+				          error );
+
+				memory_free(
+				 name_data_buffer );
+
+				name_data_buffer = NULL;
+
+				if( libwrc_io_handle_update_statistics(
+				     io_handle,
+				     LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+				     (uint64_t) name_data_size,
+				     NULL ) != 1 )
+				{
+					result = -1;
+				}
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read resource node entry: %" PRIu32 " name.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( node_level == 1 )
+		{
+			if( ( resource_node_entry->identifier & LIBWRC_RESOURCE_IDENTIFIER_FLAG_HAS_NAME ) == 0 )
+			{
+				switch( resource_node_entry->identifier )
+				{
+					case LIBWRC_RESOURCE_IDENTIFIER_CURSOR:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_CURSOR;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_BITMAP:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_BITMAP;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_ICON:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_ICON;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_MENU:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_MENU;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_DIALOG:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_DIALOG;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_STRING:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_STRING;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_FONT_DIRECTORY:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_FONT_DIRECTORY;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_FONT:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_FONT;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_ACCELERATOR:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_ACCELERATOR;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_RAW_DATA:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_RAW_DATA;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_MESSAGE_TABLE:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE;
+						break;
+
+					case LIBWRC_RESOURCE_IDENTIFIER_GROUP_CURSOR:
+						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_GROUP_CURSOR;
+						break;
 
 					case LIBWRC_RESOURCE_IDENTIFIER_GROUP_ICON:
 						resource_node_entry->type = LIBWRC_RESOURCE_TYPE_GROUP_ICON;
@@ -349,27 +883,6 @@ int libwrc_resource_node_tree_read_node(
 				}
 			}
 		}
-		if( libcdata_tree_node_insert_value(
-		     node,
-		     (intptr_t *) resource_node_entry,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libwrc_resource_node_entry_compare,
-		     LIBCDATA_INSERT_FLAG_NON_UNIQUE_ENTRIES,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert resource node: %d.",
-			 function,
-			 resource_node_entry_index );
-
-			goto on_error;
-		}
-		resource_node_entry = NULL;
-
-		resource_node_entry_index++;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -378,182 +891,944 @@ int libwrc_resource_node_tree_read_node(
 		}
 #endif
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     node,
-	     &number_of_sub_nodes,
+	if( names_data_buffer != NULL )
+	{
+		memory_free(
+		 names_data_buffer );
+
+		names_data_buffer = NULL;
+
+		if( libwrc_io_handle_update_statistics(
+		     io_handle,
+		     LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		     (uint64_t) names_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_resource_node_entry_sort_sub_entries(
+	     parent_resource_node_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to retrieve number of sub nodes.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort sub entries.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     node,
-	     0,
-	     &sub_node,
-	     error ) != 1 )
+	parent_resource_node_entry->sub_entries_read = 1;
+
+	return( 1 );
+
+on_error:
+	if( name_data_buffer != NULL )
+	{
+		memory_free(
+		 name_data_buffer );
+
+		libwrc_io_handle_update_statistics(
+		 io_handle,
+		 LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		 (uint64_t) name_data_size,
+		 NULL );
+	}
+	if( names_data_buffer != NULL )
+	{
+		memory_free(
+		 names_data_buffer );
+
+		libwrc_io_handle_update_statistics(
+		 io_handle,
+		 LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		 (uint64_t) names_data_size,
+		 NULL );
+	}
+	if( node_entries_data_buffer != NULL )
+	{
+		memory_free(
+		 node_entries_data_buffer );
+
+		libwrc_io_handle_update_statistics(
+		 io_handle,
+		 LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		 (uint64_t) node_entries_data_size,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the data descriptors of resource node entries
+ * The resource node entries must be sorted by offset, the data descriptors
+ * are read with a single read and are stored in a packed array when an arena is used
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_tree_read_data_descriptors(
+     libwrc_resource_node_entry_t **resource_node_entries,
+     int number_of_resource_node_entries,
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libwrc_data_descriptor_t *data_descriptors        = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	const uint8_t *data                               = NULL;
+	uint8_t *data_buffer                              = NULL;
+	static char *function                             = "libwrc_resource_node_tree_read_data_descriptors";
+	size_t data_offset                                = 0;
+	size_t data_size                                  = 0;
+	size_t stream_data_size                           = 0;
+	ssize_t read_count                                = 0;
+	uint32_t first_offset                             = 0;
+	uint32_t last_offset                              = 0;
+	int entry_index                                   = 0;
+	int result                                        = 0;
+
+	if( resource_node_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first sub node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entries.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( sub_node_index = 0;
-	     sub_node_index < number_of_sub_nodes;
-	     sub_node_index++ )
+	if( number_of_resource_node_entries <= 0 )
 	{
-		if( libcdata_tree_node_get_value(
-		     sub_node,
-		     (intptr_t **) &sub_resource_node_entry,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of resource node entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_resource_node_entries;
+	     entry_index++ )
+	{
+		resource_node_entry = resource_node_entries[ entry_index ];
+
+		if( resource_node_entry == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource sub node: %d entry.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid resource node entry: %d.",
 			 function,
-			 sub_node_index );
+			 entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( sub_resource_node_entry == NULL )
+		if( resource_node_entry->data_descriptor != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid resource sub node: %d entry.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid resource node entry: %d - data descriptor value already set.",
 			 function,
-			 sub_node_index );
-
-			goto on_error;
-		}
-		if( ( sub_resource_node_entry->offset & 0x80000000UL ) != 0 )
-		{
-			resource_node_entry_offset = sub_resource_node_entry->offset & 0x7fffffffUL;
-
-			if( libwrc_resource_node_tree_read_node(
-			     sub_node,
-			     io_handle,
-			     file_io_handle,
-			     (off64_t) resource_node_entry_offset,
-			     node_level + 1,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub resource node: %d at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_node_index,
-				 resource_node_entry_offset,
-				 resource_node_entry_offset );
-
-				goto on_error;
-			}
-		}
-		else
-		{
-			if( libwrc_data_descriptor_initialize(
-			     &( sub_resource_node_entry->data_descriptor ),
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create data descriptor: %d.",
-				 function,
-				 sub_node_index );
-
-				goto on_error;
-			}
-			if( libwrc_data_descriptor_read_file_io_handle(
-			     sub_resource_node_entry->data_descriptor,
-			     file_io_handle,
-			     (off64_t) sub_resource_node_entry->offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data descriptor: %d at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_node_index,
-				 sub_resource_node_entry->offset,
-				 sub_resource_node_entry->offset );
-
-				goto on_error;
-			}
-			if( ( sub_resource_node_entry->data_descriptor->virtual_address < io_handle->virtual_address )
-			 || ( (size64_t) sub_resource_node_entry->data_descriptor->virtual_address >= ( io_handle->virtual_address + io_handle->stream_size ) ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid data descriptor: %d - virtual address value out of bounds.",
-				 function,
-				 sub_node_index );
-
-				goto on_error;
-			}
-			if( (size64_t) ( sub_resource_node_entry->data_descriptor->virtual_address + sub_resource_node_entry->data_descriptor->size ) > ( io_handle->virtual_address + io_handle->stream_size ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid data descriptor: %d - size value out of bounds.",
-				 function,
-				 sub_node_index );
+			 entry_index );
 
-				goto on_error;
-			}
+			return( -1 );
 		}
-		if( libcdata_tree_node_get_next_node(
-		     sub_node,
-		     &sub_node,
-		     error ) != 1 )
+		if( ( resource_node_entry->offset < last_offset )
+		 || ( (size64_t) resource_node_entry->offset >= io_handle->stream_size ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next node of sub node: %d.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid resource node entry: %d - offset value out of bounds.",
 			 function,
-			 sub_node_index );
+			 entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
+		last_offset = resource_node_entry->offset;
 	}
-	return( 1 );
+	first_offset = resource_node_entries[ 0 ]->offset;
 
-on_error:
-	if( resource_node_entry != NULL )
+	/* A data descriptor at the end of the stream can be truncated,
+	 * which is detected when the data descriptor is read
+	 */
+	data_size = (size_t) ( last_offset - first_offset ) + sizeof( wrc_data_descriptor_t );
+
+	if( (size64_t) data_size > ( io_handle->stream_size - first_offset ) )
 	{
-		libwrc_resource_node_entry_free(
-		 &resource_node_entry,
-		 NULL );
+		data_size = (size_t) ( io_handle->stream_size - first_offset );
 	}
-	if( resource_node_header != NULL )
+	if( data_size > (size_t) LIBWRC_MAXIMUM_DATA_DESCRIPTORS_READ_SIZE )
 	{
-		libwrc_resource_node_header_free(
-		 &resource_node_header,
-		 NULL );
-	}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	result = libwrc_io_handle_get_stream_data_at_offset(
+	          io_handle,
+	          (off64_t) first_offset,
+	          &data,
+	          &stream_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 first_offset,
+		 first_offset );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( data_size > stream_data_size )
+		{
+			data_size = stream_data_size;
+		}
+	}
+	else
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading %d data descriptors at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+			 function,
+			 number_of_resource_node_entries,
+			 first_offset,
+			 first_offset );
+		}
+#endif
+		data_buffer = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * data_size );
+
+		if( data_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data descriptors data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_io_handle_update_statistics(
+		     io_handle,
+		     LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+		     (uint64_t) data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libwrc_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              data_buffer,
+		              data_size,
+		              (off64_t) first_offset,
+		              error );
+
+		if( read_count != (ssize_t) data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data descriptors data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 first_offset,
+			 first_offset );
+
+			goto on_error;
+		}
+		data = data_buffer;
+	}
+	/* When an arena is used the data descriptors are stored in a single packed array
+	 */
+	if( io_handle->arena != NULL )
+	{
+		if( libwrc_arena_allocate(
+		     io_handle->arena,
+		     sizeof( libwrc_data_descriptor_t ) * number_of_resource_node_entries,
+		     (void **) &data_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data descriptors.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_resource_node_entries;
+	     entry_index++ )
+	{
+		resource_node_entry = resource_node_entries[ entry_index ];
+
+		if( data_descriptors != NULL )
+		{
+			resource_node_entry->data_descriptor = &( data_descriptors[ entry_index ] );
+		}
+		else if( libwrc_data_descriptor_initialize(
+		          &( resource_node_entry->data_descriptor ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data descriptor: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		data_offset = (size_t) ( resource_node_entry->offset - first_offset );
+
+		if( data_offset >= data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data descriptor at offset: %" PRIu32 " (0x%08" PRIx32 ") - data offset value out of bounds.",
+			 function,
+			 resource_node_entry->offset,
+			 resource_node_entry->offset );
+
+			goto on_error;
+		}
+		if( libwrc_data_descriptor_read_data(
+		     resource_node_entry->data_descriptor,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data descriptor at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 resource_node_entry->offset,
+			 resource_node_entry->offset );
+
+			goto on_error;
+		}
+		if( ( resource_node_entry->data_descriptor->virtual_address < io_handle->virtual_address )
+		 || ( (size64_t) resource_node_entry->data_descriptor->virtual_address >= ( io_handle->virtual_address + io_handle->stream_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data descriptor at offset: %" PRIu32 " (0x%08" PRIx32 ") - virtual address value out of bounds.",
+			 function,
+			 resource_node_entry->offset,
+			 resource_node_entry->offset );
+
+			goto on_error;
+		}
+		if( ( (size64_t) resource_node_entry->data_descriptor->virtual_address + resource_node_entry->data_descriptor->size ) > ( io_handle->virtual_address + io_handle->stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data descriptor at offset: %" PRIu32 " (0x%08" PRIx32 ") - size value out of bounds.",
+			 function,
+			 resource_node_entry->offset,
+			 resource_node_entry->offset );
+
+			goto on_error;
+		}
+	}
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+
+		data_buffer = NULL;
+
+		if( libwrc_io_handle_update_statistics(
+		     io_handle,
+		     LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		     (uint64_t) data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_io_handle_update_statistics(
+	     io_handle,
+	     LIBWRC_STATISTICS_VALUE_TYPE_DATA_DESCRIPTORS,
+	     (uint64_t) number_of_resource_node_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update statistics.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+
+		libwrc_io_handle_update_statistics(
+		 io_handle,
+		 LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+		 (uint64_t) data_size,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Pushes the sub nodes and data descriptors of the sub entries of a resource node entry
+ * onto the node read queue
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_tree_push_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libwrc_io_handle_t *io_handle,
+     libwrc_node_read_queue_t *node_read_queue,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	static char *function                                 = "libwrc_resource_node_tree_push_sub_entries";
+	int sub_entry_index                                   = 0;
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sub entries of a shared node are pushed when the node was first read
+	 */
+	if( resource_node_entry->sub_entries_shared != 0 )
+	{
+		return( 1 );
+	}
+	for( sub_entry_index = 0;
+	     sub_entry_index < resource_node_entry->number_of_sub_entries;
+	     sub_entry_index++ )
+	{
+		sub_resource_node_entry = &( resource_node_entry->sub_entries[ sub_entry_index ] );
+
+		/* When reading on demand the sub nodes of the resource types
+		 * are read by libwrc_resource_node_tree_read_sub_nodes
+		 */
+		if( ( ( sub_resource_node_entry->offset & 0x80000000UL ) != 0 )
+		 && ( io_handle->read_on_demand != 0 )
+		 && ( sub_resource_node_entry->node_level == 1 ) )
+		{
+			continue;
+		}
+		if( libwrc_node_read_queue_push(
+		     node_read_queue,
+		     sub_resource_node_entry->offset & 0x7fffffffUL,
+		     sub_resource_node_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push sub entry: %d onto node read queue.",
+			 function,
+			 sub_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a node of a resource node tree including its sub nodes and data descriptors
+ * The nodes and data descriptors are read in order of their offset using
+ * a node read queue instead of recursion, so that the data is mostly read forward
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_tree_read_node(
+     libwrc_resource_node_entry_t *parent_resource_node_entry,
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     int node_level,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t **data_descriptor_entries = NULL;
+	libwrc_node_read_queue_t *node_read_queue              = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry      = NULL;
+	static char *function                                  = "libwrc_resource_node_tree_read_node";
+	uint64_t end_time                                      = 0;
+	uint64_t start_time                                    = 0;
+	uint32_t next_offset                                   = 0;
+	uint32_t offset                                        = 0;
+	int maximum_number_of_data_descriptor_entries          = (int) ( LIBWRC_MAXIMUM_DATA_DESCRIPTORS_READ_SIZE / sizeof( wrc_data_descriptor_t ) );
+	int number_of_data_descriptor_entries                  = 0;
+	int result                                             = 0;
+
+	if( libwrc_io_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_resource_node_tree_read_node_entries(
+	     parent_resource_node_entry,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     node_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resource node at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libwrc_node_read_queue_initialize(
+	     &node_read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_resource_node_tree_push_sub_entries(
+	     parent_resource_node_entry,
+	     io_handle,
+	     node_read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push sub entries onto node read queue.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libwrc_node_read_queue_pop(
+		          node_read_queue,
+		          &offset,
+		          &resource_node_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop entry from node read queue.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( resource_node_entry->offset & 0x80000000UL ) == 0 )
+		{
+			/* Data descriptors that are close together are read in a single batch
+			 */
+			if( data_descriptor_entries == NULL )
+			{
+				data_descriptor_entries = (libwrc_resource_node_entry_t **) memory_allocate(
+				                                                             sizeof( libwrc_resource_node_entry_t * ) * maximum_number_of_data_descriptor_entries );
+
+				if( data_descriptor_entries == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create data descriptor entries.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			data_descriptor_entries[ 0 ] = resource_node_entry;
+			number_of_data_descriptor_entries = 1;
+
+			while( number_of_data_descriptor_entries < maximum_number_of_data_descriptor_entries )
+			{
+				result = libwrc_node_read_queue_peek(
+				          node_read_queue,
+				          &next_offset,
+				          &resource_node_entry,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to peek entry in node read queue.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+				if( ( ( resource_node_entry->offset & 0x80000000UL ) != 0 )
+				 || ( ( next_offset - offset ) > ( LIBWRC_MAXIMUM_DATA_DESCRIPTORS_READ_SIZE - sizeof( wrc_data_descriptor_t ) ) ) )
+				{
+					break;
+				}
+				if( libwrc_node_read_queue_pop(
+				     node_read_queue,
+				     &next_offset,
+				     &resource_node_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to pop entry from node read queue.",
+					 function );
+
+					goto on_error;
+				}
+				data_descriptor_entries[ number_of_data_descriptor_entries++ ] = resource_node_entry;
+			}
+			if( libwrc_resource_node_tree_read_data_descriptors(
+			     data_descriptor_entries,
+			     number_of_data_descriptor_entries,
+			     io_handle,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data descriptors at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 offset,
+				 offset );
+
+				goto on_error;
+			}
+			result = 1;
+		}
+		else
+		{
+			if( libwrc_resource_node_tree_read_node_entries(
+			     resource_node_entry,
+			     io_handle,
+			     file_io_handle,
+			     (off64_t) offset,
+			     resource_node_entry->node_level + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub resource node at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 offset,
+				 offset );
+
+				goto on_error;
+			}
+			if( libwrc_resource_node_tree_push_sub_entries(
+			     resource_node_entry,
+			     io_handle,
+			     node_read_queue,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push sub entries of resource node at offset: %" PRIu32 " (0x%08" PRIx32 ") onto node read queue.",
+				 function,
+				 offset,
+				 offset );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result == 1 );
+
+	if( libwrc_node_read_queue_free(
+	     &node_read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free node read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_descriptor_entries != NULL )
+	{
+		memory_free(
+		 data_descriptor_entries );
+
+		data_descriptor_entries = NULL;
+	}
+	if( libwrc_io_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_io_handle_update_statistics(
+	     io_handle,
+	     LIBWRC_STATISTICS_VALUE_TYPE_NODE_TREE_READ_TIME,
+	     end_time - start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update statistics.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_descriptor_entries != NULL )
+	{
+		memory_free(
+		 data_descriptor_entries );
+	}
+	if( node_read_queue != NULL )
+	{
+		libwrc_node_read_queue_free(
+		 &node_read_queue,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the sub nodes of a resource node entry if not read before
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_node_tree_read_sub_nodes(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function               = "libwrc_resource_node_tree_read_sub_nodes";
+	size64_t node_data_size             = 0;
+	uint32_t resource_node_entry_offset = 0;
+	int first_entry_index               = 0;
+	int sub_entry_index                 = 0;
+
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_node_entry->sub_entries_read != 0 )
+	 || ( ( resource_node_entry->offset & 0x80000000UL ) == 0 ) )
+	{
+		return( 1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->node_offset_table != NULL )
+	{
+		first_entry_index = io_handle->node_offset_table->number_of_entries;
+		node_data_size    = io_handle->node_offset_table->node_data_size;
+	}
+	resource_node_entry_offset = resource_node_entry->offset & 0x7fffffffUL;
+
+	if( libwrc_resource_node_tree_read_node(
+	     resource_node_entry,
+	     io_handle,
+	     file_io_handle,
+	     (off64_t) resource_node_entry_offset,
+	     resource_node_entry->node_level + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub resource node at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 resource_node_entry_offset,
+		 resource_node_entry_offset );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* Remove the partially read sub entries so that reading can be retried
+	 */
+	if( io_handle->node_offset_table != NULL )
+	{
+		libwrc_node_offset_table_remove_entries(
+		 io_handle->node_offset_table,
+		 first_entry_index,
+		 NULL );
+
+		io_handle->node_offset_table->node_data_size = node_data_size;
+	}
+	if( ( resource_node_entry->sub_entries != NULL )
+	 && ( resource_node_entry->sub_entries_shared == 0 )
+	 && ( resource_node_entry->arena_allocated == 0 ) )
+	{
+		for( sub_entry_index = 0;
+		     sub_entry_index < resource_node_entry->number_of_sub_entries;
+		     sub_entry_index++ )
+		{
+			libwrc_resource_node_entry_clear(
+			 &( resource_node_entry->sub_entries[ sub_entry_index ] ),
+			 NULL );
+		}
+		memory_free(
+		 resource_node_entry->sub_entries );
+	}
+	/* Memory allocated from an arena is released when the arena is reset or freed
+	 */
+	resource_node_entry->sub_entries           = NULL;
+	resource_node_entry->number_of_sub_entries = 0;
+	resource_node_entry->sub_entries_shared    = 0;
+
 	return( -1 );
 }
 
@@ -27,21 +27,49 @@
 
 #include "libwrc_io_handle.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_node_read_queue.h"
+#include "libwrc_resource_node_entry.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+int libwrc_resource_node_tree_read_node_entries(
+     libwrc_resource_node_entry_t *parent_resource_node_entry,
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     int node_level,
+     libcerror_error_t **error );
+
+int libwrc_resource_node_tree_read_data_descriptors(
+     libwrc_resource_node_entry_t **resource_node_entries,
+     int number_of_resource_node_entries,
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libwrc_resource_node_tree_push_sub_entries(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libwrc_io_handle_t *io_handle,
+     libwrc_node_read_queue_t *node_read_queue,
+     libcerror_error_t **error );
+
 int libwrc_resource_node_tree_read_node(
-     libcdata_tree_node_t *node,
+     libwrc_resource_node_entry_t *parent_resource_node_entry,
      libwrc_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      int node_level,
      libcerror_error_t **error );
 
+int libwrc_resource_node_tree_read_sub_nodes(
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libwrc_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
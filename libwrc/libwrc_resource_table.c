@@ -0,0 +1,936 @@
+/*
+ * Resource table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_libuna.h"
+#include "libwrc_resource_node_entry.h"
+#include "libwrc_resource_table.h"
+
+/* The resource table uses open addressing with linear probing. The number
+ * of slots is at least twice the number of resources so that a lookup
+ * ends at an unused slot after a few probes.
+ */
+
+/* Creates a resource table of the sub entries of a resource node entry
+ * Make sure the value resource_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_table_initialize(
+     libwrc_resource_table_t **resource_table,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	static char *function                                 = "libwrc_resource_table_initialize";
+	size_t slots_size                                     = 0;
+	uint32_t identifier_slot                              = 0;
+	uint32_t name_slot                                    = 0;
+	uint32_t slot_mask                                    = 0;
+	uint32_t type_slot                                    = 0;
+	int slot_entry_index                                  = 0;
+	int sub_entry_index                                   = 0;
+
+	if( resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_node_entry->number_of_sub_entries < 0 )
+	 || ( resource_node_entry->number_of_sub_entries > ( INT_MAX / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource node entry - number of sub entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_table = memory_allocate_structure(
+	                   libwrc_resource_table_t );
+
+	if( *resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *resource_table,
+	     0,
+	     sizeof( libwrc_resource_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resource table.",
+		 function );
+
+		memory_free(
+		 *resource_table );
+
+		*resource_table = NULL;
+
+		return( -1 );
+	}
+	( *resource_table )->resource_node_entry = resource_node_entry;
+	( *resource_table )->number_of_slots     = 16;
+
+	while( ( *resource_table )->number_of_slots < (uint32_t) ( 2 * resource_node_entry->number_of_sub_entries ) )
+	{
+		( *resource_table )->number_of_slots *= 2;
+	}
+	slots_size = sizeof( int ) * ( *resource_table )->number_of_slots;
+
+	( *resource_table )->identifier_slots = (int *) memory_allocate(
+	                                                 slots_size );
+
+	if( ( *resource_table )->identifier_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier slots.",
+		 function );
+
+		goto on_error;
+	}
+	( *resource_table )->type_slots = (int *) memory_allocate(
+	                                           slots_size );
+
+	if( ( *resource_table )->type_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create type slots.",
+		 function );
+
+		goto on_error;
+	}
+	( *resource_table )->name_slots = (int *) memory_allocate(
+	                                           slots_size );
+
+	if( ( *resource_table )->name_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( memory_set(
+	       ( *resource_table )->identifier_slots,
+	       0,
+	       slots_size ) == NULL )
+	 || ( memory_set(
+	       ( *resource_table )->type_slots,
+	       0,
+	       slots_size ) == NULL )
+	 || ( memory_set(
+	       ( *resource_table )->name_slots,
+	       0,
+	       slots_size ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_node_entry->number_of_sub_entries > 0 )
+	{
+		( *resource_table )->name_hashes = (uint32_t *) memory_allocate(
+		                                                 sizeof( uint32_t ) * resource_node_entry->number_of_sub_entries );
+
+		if( ( *resource_table )->name_hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	slot_mask = ( *resource_table )->number_of_slots - 1;
+
+	/* The sub entries are added in order so that a lookup returns
+	 * the first matching sub entry. Since a lookup by identifier or type
+	 * only returns the first matching sub entry, later sub entries with
+	 * the same identifier or type are not added, otherwise many sub entries
+	 * with the same type, such as named resources, would make the probing
+	 * quadratic
+	 */
+	for( sub_entry_index = 0;
+	     sub_entry_index < resource_node_entry->number_of_sub_entries;
+	     sub_entry_index++ )
+	{
+		sub_resource_node_entry = &( resource_node_entry->sub_entries[ sub_entry_index ] );
+
+		identifier_slot = (uint32_t) ( sub_resource_node_entry->identifier * 0x9e3779b1UL ) & slot_mask;
+
+		while( ( *resource_table )->identifier_slots[ identifier_slot ] != 0 )
+		{
+			slot_entry_index = ( *resource_table )->identifier_slots[ identifier_slot ] - 1;
+
+			if( resource_node_entry->sub_entries[ slot_entry_index ].identifier == sub_resource_node_entry->identifier )
+			{
+				break;
+			}
+			identifier_slot = ( identifier_slot + 1 ) & slot_mask;
+		}
+		if( ( *resource_table )->identifier_slots[ identifier_slot ] == 0 )
+		{
+			( *resource_table )->identifier_slots[ identifier_slot ] = sub_entry_index + 1;
+		}
+		type_slot = (uint32_t) ( (uint32_t) sub_resource_node_entry->type * 0x9e3779b1UL ) & slot_mask;
+
+		while( ( *resource_table )->type_slots[ type_slot ] != 0 )
+		{
+			slot_entry_index = ( *resource_table )->type_slots[ type_slot ] - 1;
+
+			if( resource_node_entry->sub_entries[ slot_entry_index ].type == sub_resource_node_entry->type )
+			{
+				break;
+			}
+			type_slot = ( type_slot + 1 ) & slot_mask;
+		}
+		if( ( *resource_table )->type_slots[ type_slot ] == 0 )
+		{
+			( *resource_table )->type_slots[ type_slot ] = sub_entry_index + 1;
+		}
+
+		( *resource_table )->name_hashes[ sub_entry_index ] = 0;
+
+		if( sub_resource_node_entry->name_string_size > 0 )
+		{
+			/* A name that cannot be decoded cannot be matched by a lookup
+			 * hence it is not added to the name slots
+			 */
+			if( libwrc_resource_table_get_name_hash_from_utf16_stream(
+			     sub_resource_node_entry->name_string,
+			     sub_resource_node_entry->name_string_size,
+			     &( ( *resource_table )->name_hashes[ sub_entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_free(
+				 error );
+
+				continue;
+			}
+			name_slot = ( *resource_table )->name_hashes[ sub_entry_index ] & slot_mask;
+
+			while( ( *resource_table )->name_slots[ name_slot ] != 0 )
+			{
+				name_slot = ( name_slot + 1 ) & slot_mask;
+			}
+			( *resource_table )->name_slots[ name_slot ] = sub_entry_index + 1;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *resource_table != NULL )
+	{
+		libwrc_resource_table_free(
+		 resource_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a resource table
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_table_free(
+     libwrc_resource_table_t **resource_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_resource_table_free";
+
+	if( resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_table != NULL )
+	{
+		/* The resource_node_entry reference is freed elsewhere
+		 */
+		if( ( *resource_table )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *resource_table )->name_hashes );
+		}
+		if( ( *resource_table )->name_slots != NULL )
+		{
+			memory_free(
+			 ( *resource_table )->name_slots );
+		}
+		if( ( *resource_table )->type_slots != NULL )
+		{
+			memory_free(
+			 ( *resource_table )->type_slots );
+		}
+		if( ( *resource_table )->identifier_slots != NULL )
+		{
+			memory_free(
+			 ( *resource_table )->identifier_slots );
+		}
+		memory_free(
+		 *resource_table );
+
+		*resource_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the name hash of an UTF-16 little-endian stream
+ * The hash is calculated over the Unicode characters up to the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_table_get_name_hash_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libwrc_resource_table_get_name_hash_from_utf16_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_stream_index                    = 0;
+	uint32_t safe_name_hash                      = 2166136261UL;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 16777619UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the name hash of an UTF-8 string
+ * The hash is calculated over the Unicode characters up to the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_table_get_name_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libwrc_resource_table_get_name_hash_from_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_name_hash                      = 2166136261UL;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_size )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_size,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 16777619UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the name hash of an UTF-16 string
+ * The hash is calculated over the Unicode characters up to the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_resource_table_get_name_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libwrc_resource_table_get_name_hash_from_utf16_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_name_hash                      = 2166136261UL;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_size )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_size,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 16777619UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves a specific resource node entry by identifier
+ * Returns 1 if successful, 0 if no such resource node entry or -1 on error
+ */
+int libwrc_resource_table_get_entry_by_identifier(
+     libwrc_resource_table_t *resource_table,
+     uint32_t identifier,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	static char *function                                 = "libwrc_resource_table_get_entry_by_identifier";
+	uint32_t slot                                         = 0;
+	uint32_t slot_mask                                    = 0;
+	int sub_entry_index                                   = 0;
+
+	if( resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource table.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask = resource_table->number_of_slots - 1;
+	slot      = (uint32_t) ( identifier * 0x9e3779b1UL ) & slot_mask;
+
+	sub_entry_index = resource_table->identifier_slots[ slot ];
+
+	while( sub_entry_index != 0 )
+	{
+		sub_resource_node_entry = &( resource_table->resource_node_entry->sub_entries[ sub_entry_index - 1 ] );
+
+		if( sub_resource_node_entry->identifier == identifier )
+		{
+			*resource_node_entry = sub_resource_node_entry;
+
+			return( 1 );
+		}
+		slot = ( slot + 1 ) & slot_mask;
+
+		sub_entry_index = resource_table->identifier_slots[ slot ];
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific resource node entry by type
+ * Returns 1 if successful, 0 if no such resource node entry or -1 on error
+ */
+int libwrc_resource_table_get_entry_by_type(
+     libwrc_resource_table_t *resource_table,
+     int type,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	static char *function                                 = "libwrc_resource_table_get_entry_by_type";
+	uint32_t slot                                         = 0;
+	uint32_t slot_mask                                    = 0;
+	int sub_entry_index                                   = 0;
+
+	if( resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource table.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask = resource_table->number_of_slots - 1;
+	slot      = (uint32_t) ( (uint32_t) type * 0x9e3779b1UL ) & slot_mask;
+
+	sub_entry_index = resource_table->type_slots[ slot ];
+
+	while( sub_entry_index != 0 )
+	{
+		sub_resource_node_entry = &( resource_table->resource_node_entry->sub_entries[ sub_entry_index - 1 ] );
+
+		if( sub_resource_node_entry->type == type )
+		{
+			*resource_node_entry = sub_resource_node_entry;
+
+			return( 1 );
+		}
+		slot = ( slot + 1 ) & slot_mask;
+
+		sub_entry_index = resource_table->type_slots[ slot ];
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific resource node entry by an UTF-8 formatted name
+ * Returns 1 if successful, 0 if no such resource node entry or -1 on error
+ */
+int libwrc_resource_table_get_entry_by_utf8_name(
+     libwrc_resource_table_t *resource_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	static char *function                                 = "libwrc_resource_table_get_entry_by_utf8_name";
+	uint32_t name_hash                                    = 0;
+	uint32_t slot                                         = 0;
+	uint32_t slot_mask                                    = 0;
+	int result                                            = 0;
+	int sub_entry_index                                   = 0;
+
+	if( resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_resource_table_get_name_hash_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask = resource_table->number_of_slots - 1;
+	slot      = name_hash & slot_mask;
+
+	sub_entry_index = resource_table->name_slots[ slot ];
+
+	while( sub_entry_index != 0 )
+	{
+		if( resource_table->name_hashes[ sub_entry_index - 1 ] == name_hash )
+		{
+			sub_resource_node_entry = &( resource_table->resource_node_entry->sub_entries[ sub_entry_index - 1 ] );
+
+			result = libuna_utf8_string_compare_with_utf16_stream(
+			          utf8_string,
+			          utf8_string_length + 1,
+			          sub_resource_node_entry->name_string,
+			          sub_resource_node_entry->name_string_size,
+			          LIBUNA_ENDIAN_LITTLE,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare name of sub entry: %d.",
+				 function,
+				 sub_entry_index - 1 );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*resource_node_entry = sub_resource_node_entry;
+
+				return( 1 );
+			}
+		}
+		slot = ( slot + 1 ) & slot_mask;
+
+		sub_entry_index = resource_table->name_slots[ slot ];
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific resource node entry by an UTF-16 formatted name
+ * Returns 1 if successful, 0 if no such resource node entry or -1 on error
+ */
+int libwrc_resource_table_get_entry_by_utf16_name(
+     libwrc_resource_table_t *resource_table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	static char *function                                 = "libwrc_resource_table_get_entry_by_utf16_name";
+	uint32_t name_hash                                    = 0;
+	uint32_t slot                                         = 0;
+	uint32_t slot_mask                                    = 0;
+	int result                                            = 0;
+	int sub_entry_index                                   = 0;
+
+	if( resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_resource_table_get_name_hash_from_utf16_string(
+	     utf16_string,
+	     utf16_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask = resource_table->number_of_slots - 1;
+	slot      = name_hash & slot_mask;
+
+	sub_entry_index = resource_table->name_slots[ slot ];
+
+	while( sub_entry_index != 0 )
+	{
+		if( resource_table->name_hashes[ sub_entry_index - 1 ] == name_hash )
+		{
+			sub_resource_node_entry = &( resource_table->resource_node_entry->sub_entries[ sub_entry_index - 1 ] );
+
+			result = libuna_utf16_string_compare_with_utf16_stream(
+			          utf16_string,
+			          utf16_string_length + 1,
+			          sub_resource_node_entry->name_string,
+			          sub_resource_node_entry->name_string_size,
+			          LIBUNA_ENDIAN_LITTLE,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare name of sub entry: %d.",
+				 function,
+				 sub_entry_index - 1 );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*resource_node_entry = sub_resource_node_entry;
+
+				return( 1 );
+			}
+		}
+		slot = ( slot + 1 ) & slot_mask;
+
+		sub_entry_index = resource_table->name_slots[ slot ];
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,125 @@
+/*
+ * Resource table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWRC_RESOURCE_TABLE_H )
+#define _LIBWRC_RESOURCE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_resource_node_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwrc_resource_table libwrc_resource_table_t;
+
+struct libwrc_resource_table
+{
+	/* The resource node entry that contains the resources
+	 */
+	libwrc_resource_node_entry_t *resource_node_entry;
+
+	/* The number of slots, which is a power of 2
+	 */
+	uint32_t number_of_slots;
+
+	/* The identifier slots
+	 * Each slot contains the sub entry index + 1 or 0 if not used
+	 */
+	int *identifier_slots;
+
+	/* The type slots
+	 * Each slot contains the sub entry index + 1 or 0 if not used
+	 */
+	int *type_slots;
+
+	/* The name slots
+	 * Each slot contains the sub entry index + 1 or 0 if not used
+	 */
+	int *name_slots;
+
+	/* The name hashes of the sub entries
+	 */
+	uint32_t *name_hashes;
+};
+
+int libwrc_resource_table_initialize(
+     libwrc_resource_table_t **resource_table,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_free(
+     libwrc_resource_table_t **resource_table,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_get_name_hash_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_get_name_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_get_name_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_get_entry_by_identifier(
+     libwrc_resource_table_t *resource_table,
+     uint32_t identifier,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_get_entry_by_type(
+     libwrc_resource_table_t *resource_table,
+     int type,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_get_entry_by_utf8_name(
+     libwrc_resource_table_t *resource_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error );
+
+int libwrc_resource_table_get_entry_by_utf16_name(
+     libwrc_resource_table_t *resource_table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWRC_RESOURCE_TABLE_H ) */
+
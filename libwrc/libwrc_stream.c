@@ -25,20 +25,46 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libwrc_arena.h"
 #include "libwrc_codepage.h"
+#include "libwrc_data_descriptor.h"
 #include "libwrc_debug.h"
 #include "libwrc_definitions.h"
 #include "libwrc_io_handle.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_libclocale.h"
 #include "libwrc_libcnotify.h"
+#include "libwrc_libcthreads.h"
 #include "libwrc_libuna.h"
+#include "libwrc_node_offset_table.h"
+#include "libwrc_read_range.h"
 #include "libwrc_resource.h"
+#include "libwrc_resource_item.h"
 #include "libwrc_resource_node_entry.h"
 #include "libwrc_resource_node_tree.h"
 #include "libwrc_stream.h"
 
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
 /* Creates a stream
  * Make sure the value stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -116,6 +142,47 @@ int libwrc_stream_initialize(
 
 		goto on_error;
 	}
+	if( libwrc_arena_initialize(
+	     &( internal_stream->arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_stream->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_stream->statistics_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize statistics mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*stream = (libwrc_stream_t *) internal_stream;
 
 	return( 1 );
@@ -123,6 +190,26 @@ int libwrc_stream_initialize(
 on_error:
 	if( internal_stream != NULL )
 	{
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+		if( internal_stream->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_stream->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_stream->arena != NULL )
+		{
+			libwrc_arena_free(
+			 &( internal_stream->arena ),
+			 NULL );
+		}
+		if( internal_stream->io_handle != NULL )
+		{
+			libwrc_io_handle_free(
+			 &( internal_stream->io_handle ),
+			 NULL );
+		}
 		memory_free(
 		 internal_stream );
 	}
@@ -186,6 +273,47 @@ int libwrc_stream_free(
 
 			result = -1;
 		}
+		if( libwrc_arena_free(
+		     &( internal_stream->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_stream->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_stream->statistics_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_stream );
 	}
@@ -245,6 +373,10 @@ int libwrc_stream_open(
 	static char *function                     = "libwrc_stream_open";
 	size_t filename_length                    = 0;
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	int result                                = 0;
+#endif
+
 	if( stream == NULL )
 	{
 		libcerror_error_set(
@@ -292,6 +424,57 @@ int libwrc_stream_open(
 
 		return( -1 );
 	}
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	if( ( access_flags & LIBWRC_ACCESS_FLAG_MAP_FILE ) != 0 )
+	{
+		result = libwrc_internal_stream_map_file(
+		          internal_stream,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libwrc_stream_open_memory(
+			     stream,
+			     internal_stream->mapped_data,
+			     internal_stream->mapped_data_size,
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open stream: %s.",
+				 function,
+				 filename );
+
+				munmap(
+				 internal_stream->mapped_data,
+				 internal_stream->mapped_data_size );
+
+				internal_stream->mapped_data      = NULL;
+				internal_stream->mapped_data_size = 0;
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -385,6 +568,10 @@ int libwrc_stream_open_wide(
 	static char *function                     = "libwrc_stream_open_wide";
 	size_t filename_length                    = 0;
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	int result                                = 0;
+#endif
+
 	if( stream == NULL )
 	{
 		libcerror_error_set(
@@ -432,6 +619,57 @@ int libwrc_stream_open_wide(
 
 		return( -1 );
 	}
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	if( ( access_flags & LIBWRC_ACCESS_FLAG_MAP_FILE ) != 0 )
+	{
+		result = libwrc_internal_stream_map_file_wide(
+		          internal_stream,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %ls.",
+			 function,
+			 filename );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libwrc_stream_open_memory(
+			     stream,
+			     internal_stream->mapped_data,
+			     internal_stream->mapped_data_size,
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open stream: %ls.",
+				 function,
+				 filename );
+
+				munmap(
+				 internal_stream->mapped_data,
+				 internal_stream->mapped_data_size );
+
+				internal_stream->mapped_data      = NULL;
+				internal_stream->mapped_data_size = 0;
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -620,6 +858,37 @@ int libwrc_stream_open_file_io_handle(
 		}
 		internal_stream->file_io_handle_opened_in_library = 1;
 	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( ( access_flags & LIBWRC_ACCESS_FLAG_READ_ON_DEMAND ) != 0 )
+	{
+		internal_stream->io_handle->read_on_demand = 1;
+	}
+	else
+	{
+		internal_stream->io_handle->read_on_demand = 0;
+	}
+	if( ( access_flags & LIBWRC_ACCESS_FLAG_REJECT_SHARED_NODES ) != 0 )
+	{
+		internal_stream->io_handle->reject_shared_nodes = 1;
+	}
+	else
+	{
+		internal_stream->io_handle->reject_shared_nodes = 0;
+	}
 	if( libwrc_internal_stream_open_read(
 	     internal_stream,
 	     file_io_handle,
@@ -632,10 +901,30 @@ int libwrc_stream_open_file_io_handle(
 		 "%s: unable to read from file handle.",
 		 function );
 
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 internal_stream->read_write_lock,
+		 NULL );
+#endif
 		goto on_error;
 	}
 	internal_stream->file_io_handle = file_io_handle;
 
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -653,16 +942,20 @@ on_error:
 	return( -1 );
 }
 
-/* Closes a stream
- * Returns 0 if successful or -1 on error
+/* Opens a stream from memory
+ * The data is not copied and must remain available until the stream is closed
+ * Returns 1 if successful or -1 on error
  */
-int libwrc_stream_close(
+int libwrc_stream_open_memory(
      libwrc_stream_t *stream,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle          = NULL;
 	libwrc_internal_stream_t *internal_stream = NULL;
-	static char *function                     = "libwrc_stream_close";
-	int result                                = 0;
+	static char *function                     = "libwrc_stream_open_memory";
 
 	if( stream == NULL )
 	{
@@ -677,115 +970,1581 @@ int libwrc_stream_close(
 	}
 	internal_stream = (libwrc_internal_stream_t *) stream;
 
-	if( internal_stream->file_io_handle == NULL )
+	if( internal_stream->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid stream - missing file IO handle.",
+		 "%s: invalid stream - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( internal_stream->file_io_handle_created_in_library != 0 )
-		{
-			if( libwrc_debug_print_read_offsets(
-			     internal_stream->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
-
-				result = -1;
-			}
-		}
-	}
-#endif
-	if( internal_stream->file_io_handle_opened_in_library != 0 )
+	if( internal_stream->file_io_handle != NULL )
 	{
-		if( libbfio_handle_close(
-		     internal_stream->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - file IO handle already set.",
+		 function );
 
-			result = -1;
-		}
-		internal_stream->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_stream->file_io_handle_created_in_library != 0 )
+	if( data == NULL )
 	{
-		if( libbfio_handle_free(
-		     &( internal_stream->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-			result = -1;
-		}
-		internal_stream->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_stream->file_io_handle = NULL;
-
-	if( libwrc_io_handle_clear(
-	     internal_stream->io_handle,
-	     error ) != 1 )
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libcdata_tree_node_free(
-	     &( internal_stream->resources_root_node ),
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The stream data is set before reading so the resource node tree
+	 * is parsed directly from memory
+	 */
+	internal_stream->io_handle->stream_data = data;
+
+	if( libwrc_stream_open_file_io_handle(
+	     stream,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open stream from memory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_stream->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	internal_stream->io_handle->stream_data = NULL;
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a stream
+ * Returns 0 if successful or -1 on error
+ */
+int libwrc_stream_close(
+     libwrc_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_close";
+	int result                                = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( internal_stream->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_stream->file_io_handle_created_in_library != 0 )
+		{
+			if( libwrc_debug_print_read_offsets(
+			     internal_stream->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_stream->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_stream->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_stream->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_stream->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_stream->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_stream->file_io_handle_created_in_library = 0;
+	}
+	internal_stream->file_io_handle = NULL;
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	if( internal_stream->mapped_data != NULL )
+	{
+		if( munmap(
+		     internal_stream->mapped_data,
+		     internal_stream->mapped_data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file data.",
+			 function );
+
+			result = -1;
+		}
+		internal_stream->mapped_data      = NULL;
+		internal_stream->mapped_data_size = 0;
+	}
+#endif
+	if( libwrc_io_handle_clear(
+	     internal_stream->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libwrc_resource_table_free(
+	     &( internal_stream->resource_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource table.",
+		 function );
+
+		result = -1;
+	}
+	if( libwrc_resource_node_entry_free(
+	     &( internal_stream->root_node_entry ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resources root node entry.",
+		 function );
+
+		result = -1;
+	}
+	/* The resource node tree was allocated from the arena
+	 */
+	if( libwrc_arena_reset(
+	     internal_stream->arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resources root node.",
+		 "%s: unable to reset arena.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+
+/* Maps a file into memory for reading
+ * Only regular files are mapped, other files are read using a file IO handle
+ * The mapping is read-only and private, the file must not be changed while the stream is open,
+ * since truncating a mapped file causes access beyond its new end to raise SIGBUS
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libwrc_internal_stream_map_file(
+     libwrc_internal_stream_t *internal_stream,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	void *mapped_data     = NULL;
+	static char *function = "libwrc_internal_stream_map_file";
+	size_t mapped_size    = 0;
+	int file_descriptor   = -1;
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_stream->file_io_handle != NULL )
+	 || ( internal_stream->mapped_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* Failures to map the file are not considered errors, the caller
+	 * falls back to reading the file using a file IO handle
+	 */
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	if( ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	mapped_size = (size_t) file_statistics.st_size;
+
+	mapped_data = mmap(
+	               NULL,
+	               mapped_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		return( 0 );
+	}
+	internal_stream->mapped_data      = (uint8_t *) mapped_data;
+	internal_stream->mapped_data_size = mapped_size;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Maps a file into memory for reading
+ * The filename is converted to a narrow string using the system codepage
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libwrc_internal_stream_map_file_wide(
+     libwrc_internal_stream_t *internal_stream,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	char *narrow_filename       = NULL;
+	static char *function       = "libwrc_internal_stream_map_file_wide";
+	size_t filename_length      = 0;
+	size_t narrow_filename_size = 0;
+	int result                  = 0;
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          &narrow_filename_size,
+		          error );
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          libclocale_codepage,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          libclocale_codepage,
+		          &narrow_filename_size,
+		          error );
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( narrow_filename_size == 0 )
+	 || ( narrow_filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid narrow filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_filename = narrow_string_allocate(
+	                   narrow_filename_size );
+
+	if( narrow_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) narrow_filename,
+		          narrow_filename_size,
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) narrow_filename,
+		          narrow_filename_size,
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) narrow_filename,
+		          narrow_filename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) narrow_filename,
+		          narrow_filename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow filename.",
+		 function );
+
+		goto on_error;
+	}
+	result = libwrc_internal_stream_map_file(
+	          internal_stream,
+	          narrow_filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 narrow_filename );
+
+	return( result );
+
+on_error:
+	if( narrow_filename != NULL )
+	{
+		memory_free(
+		 narrow_filename );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+
+/* Opens a stream for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_internal_stream_open_read(
+     libwrc_internal_stream_t *internal_stream,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_internal_stream_open_read";
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->io_handle->abort != 0 )
+	{
+		internal_stream->io_handle->abort = 0;
+	}
+	internal_stream->io_handle->virtual_address = internal_stream->virtual_address;
+	internal_stream->io_handle->arena           = internal_stream->arena;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	internal_stream->io_handle->statistics_mutex = internal_stream->statistics_mutex;
+#endif
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_stream->io_handle->stream_size ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to retrieve stream size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading resource node tree:\n" );
+	}
+#endif
+	if( libwrc_node_offset_table_initialize(
+	     &( internal_stream->io_handle->node_offset_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node offset table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_resource_node_entry_initialize(
+	     &( internal_stream->root_node_entry ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resources root node entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_resource_node_tree_read_node(
+	     internal_stream->root_node_entry,
+	     internal_stream->io_handle,
+	     file_io_handle,
+	     0,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resources root node.",
+		 function );
+
+		goto on_error;
+	}
+	/* The node offset table is only needed to read the sub nodes on demand
+	 */
+	if( internal_stream->io_handle->read_on_demand == 0 )
+	{
+		if( libwrc_node_offset_table_free(
+		     &( internal_stream->io_handle->node_offset_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free node offset table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_resource_table_initialize(
+	     &( internal_stream->resource_table ),
+	     internal_stream->root_node_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resource table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_stream->resource_table != NULL )
+	{
+		libwrc_resource_table_free(
+		 &( internal_stream->resource_table ),
+		 NULL );
+	}
+	if( internal_stream->root_node_entry != NULL )
+	{
+		libwrc_resource_node_entry_free(
+		 &( internal_stream->root_node_entry ),
+		 NULL );
+	}
+	if( internal_stream->io_handle->node_offset_table != NULL )
+	{
+		libwrc_node_offset_table_free(
+		 &( internal_stream->io_handle->node_offset_table ),
+		 NULL );
+	}
+	if( internal_stream->arena != NULL )
+	{
+		libwrc_arena_reset(
+		 internal_stream->arena,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the stream ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_stream_get_ascii_codepage(
+     libwrc_stream_t *stream,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_get_ascii_codepage";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( internal_stream->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*ascii_codepage = internal_stream->io_handle->ascii_codepage;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the stream ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_stream_set_ascii_codepage(
+     libwrc_stream_t *stream,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_set_ascii_codepage";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( internal_stream->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBWRC_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_stream->io_handle->ascii_codepage = ascii_codepage;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_stream_get_virtual_address(
+     libwrc_stream_t *stream,
+     uint32_t *virtual_address,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_get_virtual_address";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid virtual address.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*virtual_address = internal_stream->virtual_address;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_stream_set_virtual_address(
+     libwrc_stream_t *stream,
+     uint32_t virtual_address,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_set_virtual_address";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_stream->virtual_address = virtual_address;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of resources
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_stream_get_number_of_resources(
+     libwrc_stream_t *stream,
+     int *number_of_resources,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_get_number_of_resources";
+	int result                                = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libwrc_resource_node_entry_get_number_of_sub_entries(
+	     internal_stream->root_node_entry,
+	     number_of_resources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resources.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Creates a resource for a resource node entry
+ * The sub nodes of the resource node entry are read on demand, in which case
+ * the write lock is grabbed, otherwise the resource is created under the read lock
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_internal_stream_initialize_resource(
+     libwrc_internal_stream_t *internal_stream,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libwrc_resource_t **resource,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_internal_stream_initialize_resource";
+	int result            = 1;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	uint8_t read_sub_nodes = 0;
+#endif
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_node_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource node entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_node_entry->sub_entries_read == 0 )
+	 && ( ( resource_node_entry->offset & 0x80000000UL ) != 0 ) )
+	{
+		read_sub_nodes = 1;
+	}
+	if( read_sub_nodes != 0 )
+	{
+		/* The sub nodes are read under the write lock since reading them
+		 * changes the resource node tree
+		 */
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( libwrc_resource_initialize(
+	     resource,
+	     internal_stream->io_handle,
+	     internal_stream->file_io_handle,
+	     resource_node_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resource.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( read_sub_nodes != 0 )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			libwrc_resource_free(
+			 resource,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			libwrc_resource_free(
+			 resource,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific resource
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_stream_get_resource_by_index(
+     libwrc_stream_t *stream,
+     int resource_index,
+     libwrc_resource_t **resource,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream         = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	static char *function                             = "libwrc_stream_get_resource_by_index";
+	int result                                        = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libwrc_resource_node_entry_get_sub_entry_by_index(
+	     internal_stream->root_node_entry,
+	     resource_index,
+	     &resource_node_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event resource node: %d.",
+		 function,
+		 resource_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		result = libwrc_internal_stream_initialize_resource(
+		          internal_stream,
+		          resource_node_entry,
+		          resource,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create resource.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves a specific resource by identifier
+ * Returns 1 if successful, 0 if no such resource or -1 on error
+ */
+int libwrc_stream_get_resource_by_identifier(
+     libwrc_stream_t *stream,
+     uint32_t identifier,
+     libwrc_resource_t **resource,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream         = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	static char *function                             = "libwrc_stream_get_resource_by_identifier";
+	int result                                        = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_stream->resource_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing resource table.",
 		 function );
 
 		result = -1;
 	}
+	else
+	{
+		result = libwrc_resource_table_get_entry_by_identifier(
+		          internal_stream->resource_table,
+		          identifier,
+		          &resource_node_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource node entry by identifier.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		result = libwrc_internal_stream_initialize_resource(
+		          internal_stream,
+		          resource_node_entry,
+		          resource,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create resource.",
+			 function );
+
+			result = -1;
+		}
+	}
 	return( result );
 }
 
-/* Opens a stream for reading
- * Returns 1 if successful or -1 on error
+/* Retrieves a specific resource by type
+ * Returns 1 if successful, 0 if no such resource or -1 on error
  */
-int libwrc_internal_stream_open_read(
-     libwrc_internal_stream_t *internal_stream,
-     libbfio_handle_t *file_io_handle,
+int libwrc_stream_get_resource_by_type(
+     libwrc_stream_t *stream,
+     int type,
+     libwrc_resource_t **resource,
      libcerror_error_t **error )
 {
-	static char *function = "libwrc_internal_stream_open_read";
+	libwrc_internal_stream_t *internal_stream         = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	static char *function                             = "libwrc_stream_get_resource_by_type";
+	int result                                        = 0;
 
-	if( internal_stream == NULL )
+	if( stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -796,97 +2555,259 @@ int libwrc_internal_stream_open_read(
 
 		return( -1 );
 	}
-	if( internal_stream->io_handle == NULL )
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_stream->resource_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid stream - missing IO handle.",
+		 "%s: invalid stream - missing resource table.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libwrc_resource_table_get_entry_by_type(
+		          internal_stream->resource_table,
+		          type,
+		          &resource_node_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource node entry by type.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_stream->io_handle->abort != 0 )
+#endif
+	if( result == 1 )
 	{
-		internal_stream->io_handle->abort = 0;
+		result = libwrc_internal_stream_initialize_resource(
+		          internal_stream,
+		          resource_node_entry,
+		          resource,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create resource.",
+			 function );
+
+			result = -1;
+		}
 	}
-	internal_stream->io_handle->virtual_address = internal_stream->virtual_address;
+	return( result );
+}
 
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &( internal_stream->io_handle->stream_size ),
-	     error ) == -1 )
+/* Retrieves a specific resource by an UTF-8 formatted name
+ * Returns 1 if successful, 0 if no such resource or -1 on error
+ */
+int libwrc_stream_get_resource_by_utf8_name(
+     libwrc_stream_t *stream,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libwrc_resource_t **resource,
+     libcerror_error_t **error )
+{
+	libwrc_internal_stream_t *internal_stream         = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	static char *function                             = "libwrc_stream_get_resource_by_utf8_name";
+	int result                                        = 0;
+
+	if( stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to retrieve stream size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+	if( resource == NULL )
 	{
-		libcnotify_printf(
-		 "Reading resource node tree:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	if( libcdata_tree_node_initialize(
-	     &( internal_stream->resources_root_node ),
-	     error ) == -1 )
+	if( internal_stream->resource_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create resources root node.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing resource table.",
 		 function );
 
-		goto on_error;
+		result = -1;
+	}
+	else
+	{
+		result = libwrc_resource_table_get_entry_by_utf8_name(
+		          internal_stream->resource_table,
+		          utf8_string,
+		          utf8_string_length,
+		          &resource_node_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource node entry by UTF-8 name.",
+			 function );
+		}
 	}
-	if( libwrc_resource_node_tree_read_node(
-	     internal_stream->resources_root_node,
-	     internal_stream->io_handle,
-	     file_io_handle,
-	     0,
-	     1,
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read resources root node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( internal_stream->resources_root_node != NULL )
+#endif
+	if( result == 1 )
 	{
-		libcdata_tree_node_free(
-		 &( internal_stream->resources_root_node ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
-		 NULL );
+		result = libwrc_internal_stream_initialize_resource(
+		          internal_stream,
+		          resource_node_entry,
+		          resource,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create resource.",
+			 function );
+
+			result = -1;
+		}
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves the stream ASCII codepage
- * Returns 1 if successful or -1 on error
+/* Retrieves a specific resource by an UTF-16 formatted name
+ * Returns 1 if successful, 0 if no such resource or -1 on error
  */
-int libwrc_stream_get_ascii_codepage(
+int libwrc_stream_get_resource_by_utf16_name(
      libwrc_stream_t *stream,
-     int *ascii_codepage,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libwrc_resource_t **resource,
      libcerror_error_t **error )
 {
-	libwrc_internal_stream_t *internal_stream = NULL;
-	static char *function                     = "libwrc_stream_get_ascii_codepage";
+	libwrc_internal_stream_t *internal_stream         = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	static char *function                             = "libwrc_stream_get_resource_by_utf16_name";
+	int result                                        = 0;
 
 	if( stream == NULL )
 	{
@@ -901,110 +2822,136 @@ int libwrc_stream_get_ascii_codepage(
 	}
 	internal_stream = (libwrc_internal_stream_t *) stream;
 
-	if( internal_stream->io_handle == NULL )
+	if( resource == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid stream - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	if( *resource != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource value already set.",
 		 function );
 
 		return( -1 );
 	}
-	*ascii_codepage = internal_stream->io_handle->ascii_codepage;
-
-	return( 1 );
-}
-
-/* Sets the stream ASCII codepage
- * Returns 1 if successful or -1 on error
- */
-int libwrc_stream_set_ascii_codepage(
-     libwrc_stream_t *stream,
-     int ascii_codepage,
-     libcerror_error_t **error )
-{
-	libwrc_internal_stream_t *internal_stream = NULL;
-	static char *function                     = "libwrc_stream_set_ascii_codepage";
-
-	if( stream == NULL )
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_stream = (libwrc_internal_stream_t *) stream;
-
-	if( internal_stream->io_handle == NULL )
+#endif
+	if( internal_stream->resource_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid stream - missing IO handle.",
+		 "%s: invalid stream - missing resource table.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( ( ascii_codepage != LIBWRC_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBWRC_CODEPAGE_WINDOWS_1258 ) )
+	else
+	{
+		result = libwrc_resource_table_get_entry_by_utf16_name(
+		          internal_stream->resource_table,
+		          utf16_string,
+		          utf16_string_length,
+		          &resource_node_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource node entry by UTF-16 name.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_stream->io_handle->ascii_codepage = ascii_codepage;
+#endif
+	if( result == 1 )
+	{
+		result = libwrc_internal_stream_initialize_resource(
+		          internal_stream,
+		          resource_node_entry,
+		          resource,
+		          error );
 
-	return( 1 );
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create resource.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
 }
 
-/* Retrieves the virtual address
- * Returns 1 if successful or -1 on error
+/* Visits the resource items that contain data
+ * The callback is called with a resource item view for every leaf resource item,
+ * it should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if all items were visited, 0 if stopped or aborted or -1 on error
  */
-int libwrc_stream_get_virtual_address(
-     libwrc_stream_t *stream,
-     uint32_t *virtual_address,
+int libwrc_internal_stream_visit_items(
+     libwrc_internal_stream_t *internal_stream,
+     int (*callback)(
+            const libwrc_resource_item_view_t *item_view,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error )
 {
-	libwrc_internal_stream_t *internal_stream = NULL;
-	static char *function                     = "libwrc_stream_get_virtual_address";
+	libwrc_resource_item_view_t item_view;
 
-	if( stream == NULL )
+	libwrc_resource_node_entry_t *identifier_node_entry = NULL;
+	libwrc_resource_node_entry_t *language_node_entry   = NULL;
+	libwrc_resource_node_entry_t *type_node_entry       = NULL;
+	static char *function                               = "libwrc_internal_stream_visit_items";
+	int identifier_entry_index                          = 0;
+	int language_entry_index                            = 0;
+	int result                                          = 0;
+	int type_entry_index                                = 0;
+
+	if( internal_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1015,194 +2962,298 @@ int libwrc_stream_get_virtual_address(
 
 		return( -1 );
 	}
-	internal_stream = (libwrc_internal_stream_t *) stream;
-
-	if( virtual_address == NULL )
+	if( internal_stream->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid virtual address.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	*virtual_address = internal_stream->virtual_address;
-
-	return( 1 );
-}
-
-/* Sets the virtual address
- * Returns 1 if successful or -1 on error
- */
-int libwrc_stream_set_virtual_address(
-     libwrc_stream_t *stream,
-     uint32_t virtual_address,
-     libcerror_error_t **error )
-{
-	libwrc_internal_stream_t *internal_stream = NULL;
-	static char *function                     = "libwrc_stream_set_virtual_address";
-
-	if( stream == NULL )
+	if( internal_stream->root_node_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing root node entry.",
 		 function );
 
 		return( -1 );
 	}
-	internal_stream = (libwrc_internal_stream_t *) stream;
-
-	internal_stream->virtual_address = virtual_address;
-
-	return( 1 );
-}
-
-/* Retrieves the number of resources
- * Returns 1 if successful or -1 on error
- */
-int libwrc_stream_get_number_of_resources(
-     libwrc_stream_t *stream,
-     int *number_of_resources,
-     libcerror_error_t **error )
-{
-	libwrc_internal_stream_t *internal_stream = NULL;
-	static char *function                     = "libwrc_stream_get_number_of_resources";
-
-	if( stream == NULL )
+	if( callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
+		 "%s: invalid callback.",
 		 function );
 
 		return( -1 );
 	}
-	internal_stream = (libwrc_internal_stream_t *) stream;
-
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_stream->resources_root_node,
-	     number_of_resources,
-	     error ) != 1 )
+	if( memory_set(
+	     &item_view,
+	     0,
+	     sizeof( libwrc_resource_item_view_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resources.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item view.",
 		 function );
 
 		return( -1 );
 	}
+	/* The resource node tree consists of a type, an identifier and a language level,
+	 * where the language level contains the data descriptors
+	 */
+	for( type_entry_index = 0;
+	     type_entry_index < internal_stream->root_node_entry->number_of_sub_entries;
+	     type_entry_index++ )
+	{
+		type_node_entry = &( internal_stream->root_node_entry->sub_entries[ type_entry_index ] );
+
+		/* When the stream is read on demand the sub nodes are read
+		 * the first time the type is visited
+		 */
+		if( libwrc_resource_node_tree_read_sub_nodes(
+		     type_node_entry,
+		     internal_stream->io_handle,
+		     internal_stream->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub nodes of type: %d.",
+			 function,
+			 type_entry_index );
+
+			return( -1 );
+		}
+		item_view.type            = type_node_entry->type;
+		item_view.type_identifier = type_node_entry->identifier;
+		item_view.type_name       = type_node_entry->name_string;
+		item_view.type_name_size  = type_node_entry->name_string_size;
+
+		for( identifier_entry_index = 0;
+		     identifier_entry_index < type_node_entry->number_of_sub_entries;
+		     identifier_entry_index++ )
+		{
+			identifier_node_entry = &( type_node_entry->sub_entries[ identifier_entry_index ] );
+
+			item_view.identifier = identifier_node_entry->identifier;
+			item_view.name       = identifier_node_entry->name_string;
+			item_view.name_size  = identifier_node_entry->name_string_size;
+
+			for( language_entry_index = 0;
+			     language_entry_index < identifier_node_entry->number_of_sub_entries;
+			     language_entry_index++ )
+			{
+				language_node_entry = &( identifier_node_entry->sub_entries[ language_entry_index ] );
+
+				if( language_node_entry->data_descriptor == NULL )
+				{
+					continue;
+				}
+				if( internal_stream->io_handle->abort != 0 )
+				{
+					return( 0 );
+				}
+				item_view.language_identifier = language_node_entry->identifier;
+				item_view.virtual_address     = language_node_entry->data_descriptor->virtual_address;
+				item_view.size                = language_node_entry->data_descriptor->size;
+
+				result = callback(
+				          &item_view,
+				          user_data );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: callback failed for type: %d, identifier: %d, language: %d.",
+					 function,
+					 type_entry_index,
+					 identifier_entry_index,
+					 language_entry_index );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					return( 0 );
+				}
+			}
+		}
+	}
 	return( 1 );
 }
 
-/* Retrieves a specific resource
- * Returns 1 if successful or -1 on error
+/* Visits the resource items that contain data
+ * The callback is called with a resource item view for every leaf resource item,
+ * it should return 1 to continue, 0 to stop or -1 on error
+ * The callback is called while the stream is locked and must not call functions of the same stream
+ * Returns 1 if all items were visited, 0 if stopped or aborted or -1 on error
  */
-int libwrc_stream_get_resource_by_index(
+int libwrc_stream_visit_items(
      libwrc_stream_t *stream,
-     int resource_index,
-     libwrc_resource_t **resource,
+     int (*callback)(
+            const libwrc_resource_item_view_t *item_view,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *resource_node       = NULL;
 	libwrc_internal_stream_t *internal_stream = NULL;
-	static char *function                     = "libwrc_stream_get_resource_by_index";
-
-	if( stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
-		 function );
+	static char *function                     = "libwrc_stream_visit_items";
+	int result                                = 0;
 
-		return( -1 );
-	}
-	internal_stream = (libwrc_internal_stream_t *) stream;
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	uint8_t read_on_demand                    = 0;
+#endif
 
-	if( resource == NULL )
+	if( stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource.",
+		 "%s: invalid stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( *resource != NULL )
+	internal_stream = (libwrc_internal_stream_t *) stream;
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid resource value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     internal_stream->resources_root_node,
-	     resource_index,
-	     &resource_node,
-	     error ) != 1 )
+	if( ( internal_stream->io_handle != NULL )
+	 && ( internal_stream->io_handle->read_on_demand != 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event resource node: %d.",
-		 function,
-		 resource_index );
+		read_on_demand = 1;
+	}
+	if( read_on_demand != 0 )
+	{
+		/* A write lock is used since the sub nodes of the resource node entries
+		 * are read on demand
+		 */
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( libwrc_resource_initialize(
-	     resource,
-	     internal_stream->io_handle,
-	     internal_stream->file_io_handle,
-	     resource_node,
-	     error ) != 1 )
+#endif
+	result = libwrc_internal_stream_visit_items(
+	          internal_stream,
+	          callback,
+	          user_data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create resource.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit items.",
 		 function );
+	}
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( read_on_demand != 0 )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	return( 1 );
+	else
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_stream->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
 }
 
-/* Retrieves a specific resource by identifier
- * Returns 1 if successful, 0 if no such resource or -1 on error
+/* Reads data at a specific offset relative to the start of the stream
+ * Returns 1 if successful or -1 on error
  */
-int libwrc_stream_get_resource_by_identifier(
-     libwrc_stream_t *stream,
-     uint32_t identifier,
-     libwrc_resource_t **resource,
+int libwrc_internal_stream_read_data_at_offset(
+     libwrc_internal_stream_t *internal_stream,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *resource_node               = NULL;
-	libwrc_internal_stream_t *internal_stream         = NULL;
-	libwrc_resource_node_entry_t *resource_node_entry = NULL;
-	static char *function                             = "libwrc_stream_get_resource_by_identifier";
-	int number_of_resources                           = 0;
-	int resource_index                                = 0;
+	const uint8_t *stream_data = NULL;
+	static char *function      = "libwrc_internal_stream_read_data_at_offset";
+	size_t stream_data_size    = 0;
+	ssize_t read_count         = 0;
+	int result                 = 0;
 
-	if( stream == NULL )
+	if( internal_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1213,149 +3264,128 @@ int libwrc_stream_get_resource_by_identifier(
 
 		return( -1 );
 	}
-	internal_stream = (libwrc_internal_stream_t *) stream;
-
-	if( resource == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( *resource != NULL )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid resource value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_stream->resources_root_node != NULL )
+	result = libwrc_io_handle_get_stream_data_at_offset(
+	          internal_stream->io_handle,
+	          offset,
+	          &stream_data,
+	          &stream_data_size,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libcdata_tree_node_get_number_of_sub_nodes(
-		     internal_stream->resources_root_node,
-		     &number_of_resources,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( size > stream_data_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of resources.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid size value out of bounds.",
 			 function );
 
 			return( -1 );
 		}
-		if( libcdata_tree_node_get_sub_node_by_index(
-		     internal_stream->resources_root_node,
-		     0,
-		     &resource_node,
-		     error ) != 1 )
+		if( memory_copy(
+		     buffer,
+		     stream_data,
+		     size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve first resource node.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy stream data.",
 			 function );
 
 			return( -1 );
 		}
-		for( resource_index = 0;
-		     resource_index < number_of_resources;
-		     resource_index++ )
-		{
-			if( libcdata_tree_node_get_value(
-			     resource_node,
-			     (intptr_t **) &resource_node_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource node: %d entry.",
-				 function,
-				 resource_index );
-
-				return( -1 );
-			}
-			if( resource_node_entry == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing resource node: %d entry.",
-				 function,
-				 resource_index );
-
-				return( -1 );
-			}
-			if( identifier == resource_node_entry->identifier )
-			{
-				if( libwrc_resource_initialize(
-				     resource,
-				     internal_stream->io_handle,
-				     internal_stream->file_io_handle,
-				     resource_node,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create resource.",
-					 function );
+		return( 1 );
+	}
+	read_count = libwrc_io_handle_read_buffer_at_offset(
+	              internal_stream->io_handle,
+	              internal_stream->file_io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
 
-					return( -1 );
-				}
-				return( 1 );
-			}
-			if( libcdata_tree_node_get_next_node(
-			     resource_node,
-			     &resource_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve next node of resource node: %d.",
-				 function,
-				 resource_index );
+	if( read_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
-				return( -1 );
-			}
-		}
+		return( -1 );
 	}
-	return( 0 );
+	return( 1 );
 }
 
-/* Retrieves a specific resource by type
- * Returns 1 if successful, 0 if no such resource or -1 on error
+/* Reads the data of multiple resource items
+ * The requests are sorted by the offset of their data so that the file is read sequentially,
+ * data of resource items that are adjacent or nearby is read with a single read
+ * Returns 1 if successful or -1 on error
  */
-int libwrc_stream_get_resource_by_type(
-     libwrc_stream_t *stream,
-     int type,
-     libwrc_resource_t **resource,
+int libwrc_internal_stream_read_items(
+     libwrc_internal_stream_t *internal_stream,
+     libwrc_resource_item_read_request_t *requests,
+     int number_of_requests,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *resource_node               = NULL;
-	libwrc_internal_stream_t *internal_stream         = NULL;
-	libwrc_resource_node_entry_t *resource_node_entry = NULL;
-	static char *function                             = "libwrc_stream_get_resource_by_type";
-	int number_of_resources                           = 0;
-	int resource_index                                = 0;
+	libwrc_data_descriptor_t *data_descriptor               = NULL;
+	libwrc_internal_resource_item_t *internal_resource_item = NULL;
+	libwrc_read_range_t *read_ranges                        = NULL;
+	libwrc_resource_item_read_request_t *request            = NULL;
+	uint8_t *read_buffer                                    = NULL;
+	uint8_t *reallocation                                   = NULL;
+	static char *function                                   = "libwrc_internal_stream_read_items";
+	size64_t coalesced_size                                 = 0;
+	size_t read_buffer_size                                 = 0;
+	off64_t data_offset                                     = 0;
+	int number_of_coalesced_ranges                          = 0;
+	int range_index                                         = 0;
+	int read_range_index                                    = 0;
+	int request_index                                       = 0;
 
-	if( stream == NULL )
+	if( internal_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1366,146 +3396,343 @@ int libwrc_stream_get_resource_by_type(
 
 		return( -1 );
 	}
-	internal_stream = (libwrc_internal_stream_t *) stream;
+	if( internal_stream->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing IO handle.",
+		 function );
 
-	if( resource == NULL )
+		return( -1 );
+	}
+	if( internal_stream->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( requests == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource.",
+		 "%s: invalid requests.",
 		 function );
 
 		return( -1 );
 	}
-	if( *resource != NULL )
+	if( ( number_of_requests < 0 )
+	 || ( (size_t) number_of_requests > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwrc_read_range_t ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid resource value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of requests value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_stream->resources_root_node,
-	     &number_of_resources,
-	     error ) != 1 )
+	if( number_of_requests == 0 )
+	{
+		return( 1 );
+	}
+	read_ranges = (libwrc_read_range_t *) memory_allocate(
+	                                      sizeof( libwrc_read_range_t ) * number_of_requests );
+
+	if( read_ranges == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resources.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read ranges.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		request = &( requests[ request_index ] );
+
+		request->read_count = 0;
+
+		if( request->resource_item == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid request: %d - missing resource item.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		internal_resource_item = (libwrc_internal_resource_item_t *) request->resource_item;
+
+		if( internal_resource_item->io_handle != internal_stream->io_handle )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid request: %d - resource item is not of the stream.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		if( ( internal_resource_item->resource_node_entry == NULL )
+		 || ( internal_resource_item->resource_node_entry->data_descriptor == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid request: %d - resource item has no data.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		if( request->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid request: %d - missing buffer.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		if( request->buffer_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid request: %d - buffer size value exceeds maximum.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		data_descriptor = internal_resource_item->resource_node_entry->data_descriptor;
+
+		data_offset  = data_descriptor->virtual_address;
+		data_offset -= internal_stream->io_handle->virtual_address;
+
+		if( data_offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid request: %d - data offset value out of bounds.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		read_ranges[ request_index ].offset        = data_offset;
+		read_ranges[ request_index ].size          = (size_t) data_descriptor->size;
+		read_ranges[ request_index ].request_index = request_index;
+
+		if( read_ranges[ request_index ].size > request->buffer_size )
+		{
+			read_ranges[ request_index ].size = request->buffer_size;
+		}
 	}
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     internal_stream->resources_root_node,
-	     0,
-	     &resource_node,
+	if( libwrc_read_range_sort(
+	     read_ranges,
+	     number_of_requests,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first resource node.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort read ranges.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( resource_index = 0;
-	     resource_index < number_of_resources;
-	     resource_index++ )
+	read_range_index = 0;
+
+	while( read_range_index < number_of_requests )
 	{
-		if( libcdata_tree_node_get_value(
-		     resource_node,
-		     (intptr_t **) &resource_node_entry,
-		     error ) != 1 )
+		/* Data that is available in memory is copied directly
+		 */
+		if( internal_stream->io_handle->stream_data != NULL )
+		{
+			number_of_coalesced_ranges = 1;
+		}
+		else if( libwrc_read_range_get_coalesced_range(
+		          read_ranges,
+		          number_of_requests,
+		          read_range_index,
+		          LIBWRC_MAXIMUM_READ_ITEMS_GAP_SIZE,
+		          LIBWRC_MAXIMUM_READ_ITEMS_READ_SIZE,
+		          &number_of_coalesced_ranges,
+		          &coalesced_size,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource node: %d entry.",
+			 "%s: unable to retrieve coalesced range: %d.",
 			 function,
-			 resource_index );
+			 read_range_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( resource_node_entry == NULL )
+		if( number_of_coalesced_ranges == 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing resource node: %d entry.",
-			 function,
-			 resource_index );
+			request = &( requests[ read_ranges[ read_range_index ].request_index ] );
 
-			return( -1 );
+			if( read_ranges[ read_range_index ].size > 0 )
+			{
+				if( libwrc_internal_stream_read_data_at_offset(
+				     internal_stream,
+				     request->buffer,
+				     read_ranges[ read_range_index ].size,
+				     read_ranges[ read_range_index ].offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read data of request: %d.",
+					 function,
+					 read_ranges[ read_range_index ].request_index );
+
+					goto on_error;
+				}
+			}
+			request->read_count = read_ranges[ read_range_index ].size;
 		}
-		if( type == resource_node_entry->type )
+		else
 		{
-			if( libwrc_resource_initialize(
-			     resource,
-			     internal_stream->io_handle,
-			     internal_stream->file_io_handle,
-			     resource_node,
+			if( (size64_t) read_buffer_size < coalesced_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                            read_buffer,
+				                            sizeof( uint8_t ) * (size_t) coalesced_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize read buffer.",
+					 function );
+
+					goto on_error;
+				}
+				read_buffer      = reallocation;
+				read_buffer_size = (size_t) coalesced_size;
+			}
+			if( libwrc_internal_stream_read_data_at_offset(
+			     internal_stream,
+			     read_buffer,
+			     (size_t) coalesced_size,
+			     read_ranges[ read_range_index ].offset,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create resource.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of requests: %d to %d.",
+				 function,
+				 read_range_index,
+				 read_range_index + number_of_coalesced_ranges - 1 );
 
-				return( -1 );
+				goto on_error;
 			}
-			return( 1 );
-		}
-		if( libcdata_tree_node_get_next_node(
-		     resource_node,
-		     &resource_node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next node of resource node: %d.",
-			 function,
-			 resource_index );
+			for( range_index = read_range_index;
+			     range_index < ( read_range_index + number_of_coalesced_ranges );
+			     range_index++ )
+			{
+				request = &( requests[ read_ranges[ range_index ].request_index ] );
 
-			return( -1 );
+				data_offset = read_ranges[ range_index ].offset - read_ranges[ read_range_index ].offset;
+
+				if( memory_copy(
+				     request->buffer,
+				     &( read_buffer[ data_offset ] ),
+				     read_ranges[ range_index ].size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy data of request: %d.",
+					 function,
+					 read_ranges[ range_index ].request_index );
+
+					goto on_error;
+				}
+				request->read_count = read_ranges[ range_index ].size;
+			}
 		}
+		read_range_index += number_of_coalesced_ranges;
+	}
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	memory_free(
+	 read_ranges );
+
+	return( 1 );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	if( read_ranges != NULL )
+	{
+		memory_free(
+		 read_ranges );
 	}
-	return( 0 );
+	return( -1 );
 }
 
-/* Retrieves a specific resource by an UTF-8 formatted name
- * Returns 1 if successful, 0 if no such resource or -1 on error
+/* Reads the data of multiple resource items
+ * The data of every request is read from the start of the resource item data
+ * and at most buffer size bytes are read
+ * The current offsets of the resource items are not changed
+ * Returns 1 if successful or -1 on error
  */
-int libwrc_stream_get_resource_by_utf8_name(
+int libwrc_stream_read_items(
      libwrc_stream_t *stream,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libwrc_resource_t **resource,
+     libwrc_resource_item_read_request_t *requests,
+     int number_of_requests,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *resource_node               = NULL;
-	libwrc_internal_stream_t *internal_stream         = NULL;
-	libwrc_resource_node_entry_t *resource_node_entry = NULL;
-	static char *function                             = "libwrc_stream_get_resource_by_type";
-	int number_of_resources                           = 0;
-	int resource_index                                = 0;
-	int result                                        = 0;
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_read_items";
+	int result                                = 0;
 
 	if( stream == NULL )
 	{
@@ -1520,167 +3747,71 @@ int libwrc_stream_get_resource_by_utf8_name(
 	}
 	internal_stream = (libwrc_internal_stream_t *) stream;
 
-	if( resource == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource.",
-		 function );
-
-		return( -1 );
-	}
-	if( *resource != NULL )
+	/* A read lock is sufficient since the stream data is only read and
+	 * the file IO handle is read at explicit offsets, which libbfio serializes
+	 */
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid resource value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_stream->resources_root_node,
-	     &number_of_resources,
-	     error ) != 1 )
+#endif
+	result = libwrc_internal_stream_read_items(
+	          internal_stream,
+	          requests,
+	          number_of_requests,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resources.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read items.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     internal_stream->resources_root_node,
-	     0,
-	     &resource_node,
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first resource node.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	for( resource_index = 0;
-	     resource_index < number_of_resources;
-	     resource_index++ )
-	{
-		if( libcdata_tree_node_get_value(
-		     resource_node,
-		     (intptr_t **) &resource_node_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource node: %d entry.",
-			 function,
-			 resource_index );
-
-			return( -1 );
-		}
-		if( resource_node_entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing resource node: %d entry.",
-			 function,
-			 resource_index );
-
-			return( -1 );
-		}
-		if( resource_node_entry->name_string_size > 0 )
-		{
-			result = libuna_utf8_string_compare_with_utf16_stream(
-			          utf8_string,
-			          utf8_string_length + 1,
-			          resource_node_entry->name_string,
-			          resource_node_entry->name_string_size,
-			          LIBUNA_ENDIAN_LITTLE,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare name of resource node: %d.",
-				 function,
-				 resource_index );
-
-				return( -1 );
-			}
-			else if( result == LIBUNA_COMPARE_EQUAL )
-			{
-				if( libwrc_resource_initialize(
-				     resource,
-				     internal_stream->io_handle,
-				     internal_stream->file_io_handle,
-				     resource_node,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create resource.",
-					 function );
-
-					return( -1 );
-				}
-				return( 1 );
-			}
-		}
-		if( libcdata_tree_node_get_next_node(
-		     resource_node,
-		     &resource_node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next node of resource node: %d.",
-			 function,
-			 resource_index );
-
-			return( -1 );
-		}
-	}
-	return( 0 );
+#endif
+	return( result );
 }
 
-/* Retrieves a specific resource by an UTF-16 formatted name
- * Returns 1 if successful, 0 if no such resource or -1 on error
+/* Retrieves the statistics of the stream
+ * The statistics are collected since the stream was opened
+ * Returns 1 if successful or -1 on error
  */
-int libwrc_stream_get_resource_by_utf16_name(
+int libwrc_stream_get_statistics(
      libwrc_stream_t *stream,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libwrc_resource_t **resource,
+     libwrc_statistics_t *statistics,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *resource_node               = NULL;
-	libwrc_internal_stream_t *internal_stream         = NULL;
-	libwrc_resource_node_entry_t *resource_node_entry = NULL;
-	static char *function                             = "libwrc_stream_get_resource_by_type";
-	int number_of_resources                           = 0;
-	int resource_index                                = 0;
-	int result                                        = 0;
+	libwrc_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libwrc_stream_get_statistics";
+	int result                                = 1;
 
 	if( stream == NULL )
 	{
@@ -1695,147 +3826,60 @@ int libwrc_stream_get_resource_by_utf16_name(
 	}
 	internal_stream = (libwrc_internal_stream_t *) stream;
 
-	if( resource == NULL )
+	if( internal_stream->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *resource != NULL )
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid resource value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     internal_stream->resources_root_node,
-	     &number_of_resources,
+#endif
+	if( libwrc_io_handle_get_statistics(
+	     internal_stream->io_handle,
+	     statistics,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resources.",
+		 "%s: unable to retrieve statistics.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libcdata_tree_node_get_sub_node_by_index(
-	     internal_stream->resources_root_node,
-	     0,
-	     &resource_node,
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_stream->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first resource node.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	for( resource_index = 0;
-	     resource_index < number_of_resources;
-	     resource_index++ )
-	{
-		if( libcdata_tree_node_get_value(
-		     resource_node,
-		     (intptr_t **) &resource_node_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource node: %d entry.",
-			 function,
-			 resource_index );
-
-			return( -1 );
-		}
-		if( resource_node_entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing resource node: %d entry.",
-			 function,
-			 resource_index );
-
-			return( -1 );
-		}
-		if( resource_node_entry->name_string_size > 0 )
-		{
-			result = libuna_utf16_string_compare_with_utf16_stream(
-			          utf16_string,
-			          utf16_string_length + 1,
-			          resource_node_entry->name_string,
-			          resource_node_entry->name_string_size,
-			          LIBUNA_ENDIAN_LITTLE,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare name of resource node: %d.",
-				 function,
-				 resource_index );
-
-				return( -1 );
-			}
-			else if( result == LIBUNA_COMPARE_EQUAL )
-			{
-				if( libwrc_resource_initialize(
-				     resource,
-				     internal_stream->io_handle,
-				     internal_stream->file_io_handle,
-				     resource_node,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create resource.",
-					 function );
-
-					return( -1 );
-				}
-				return( 1 );
-			}
-		}
-		if( libcdata_tree_node_get_next_node(
-		     resource_node,
-		     &resource_node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next node of resource node: %d.",
-			 function,
-			 resource_index );
-
-			return( -1 );
-		}
-	}
-	return( 0 );
+#endif
+	return( result );
 }
-
@@ -25,11 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libwrc_arena.h"
 #include "libwrc_extern.h"
 #include "libwrc_io_handle.h"
 #include "libwrc_libbfio.h"
-#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
+#include "libwrc_libcthreads.h"
+#include "libwrc_resource_node_entry.h"
+#include "libwrc_resource_table.h"
 #include "libwrc_types.h"
 
 #if defined( __cplusplus )
@@ -44,14 +47,23 @@ struct libwrc_internal_stream
 	 */
 	uint32_t virtual_address;
 
-	/* The resources (tree) root node
+	/* The resources root node entry
 	 */
-	libcdata_tree_node_t *resources_root_node;
+	libwrc_resource_node_entry_t *root_node_entry;
+
+	/* The resource table of the root node entry
+	 */
+	libwrc_resource_table_t *resource_table;
 
 	/* The IO handle
 	 */
 	libwrc_io_handle_t *io_handle;
 
+	/* The arena from which the resource node tree is allocated
+	 * The arena is reset on close so that its memory is reused by the next open
+	 */
+	libwrc_arena_t *arena;
+
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -63,6 +75,26 @@ struct libwrc_internal_stream
 	/* Value to indicate if the file IO handle was opened inside the library
 	 */
 	uint8_t file_io_handle_opened_in_library;
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	/* The memory mapped file data
+	 */
+	uint8_t *mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size_t mapped_data_size;
+#endif
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The mutex of the statistics
+	 */
+	libcthreads_mutex_t *statistics_mutex;
+#endif
 };
 
 LIBWRC_EXTERN \
@@ -105,11 +137,37 @@ int libwrc_stream_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBWRC_EXTERN \
+int libwrc_stream_open_memory(
+     libwrc_stream_t *stream,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBWRC_EXTERN \
 int libwrc_stream_close(
      libwrc_stream_t *stream,
      libcerror_error_t **error );
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+
+int libwrc_internal_stream_map_file(
+     libwrc_internal_stream_t *internal_stream,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libwrc_internal_stream_map_file_wide(
+     libwrc_internal_stream_t *internal_stream,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+
 int libwrc_internal_stream_open_read(
      libwrc_internal_stream_t *internal_stream,
      libbfio_handle_t *file_io_handle,
@@ -145,6 +203,12 @@ int libwrc_stream_get_number_of_resources(
      int *number_of_resources,
      libcerror_error_t **error );
 
+int libwrc_internal_stream_initialize_resource(
+     libwrc_internal_stream_t *internal_stream,
+     libwrc_resource_node_entry_t *resource_node_entry,
+     libwrc_resource_t **resource,
+     libcerror_error_t **error );
+
 LIBWRC_EXTERN \
 int libwrc_stream_get_resource_by_index(
      libwrc_stream_t *stream,
@@ -182,6 +246,55 @@ int libwrc_stream_get_resource_by_utf16_name(
      libwrc_resource_t **resource,
      libcerror_error_t **error );
 
+int libwrc_internal_stream_visit_items(
+     libwrc_internal_stream_t *internal_stream,
+     int (*callback)(
+            const libwrc_resource_item_view_t *item_view,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_stream_visit_items(
+     libwrc_stream_t *stream,
+     int (*callback)(
+            const libwrc_resource_item_view_t *item_view,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libwrc_internal_stream_read_data_at_offset(
+     libwrc_internal_stream_t *internal_stream,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libwrc_internal_stream_read_items(
+     libwrc_internal_stream_t *internal_stream,
+     libwrc_resource_item_read_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_stream_get_statistics(
+     libwrc_stream_t *stream,
+     libwrc_statistics_t *statistics,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_stream_read_items(
+     libwrc_stream_t *stream,
+     libwrc_resource_item_read_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_stream_get_statistics(
+     libwrc_stream_t *stream,
+     libwrc_statistics_t *statistics,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
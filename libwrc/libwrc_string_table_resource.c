@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libwrc_arena.h"
 #include "libwrc_definitions.h"
 #include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
@@ -163,6 +164,27 @@ int libwrc_string_table_resource_free(
 
 			result = -1;
 		}
+		if( internal_string_table_resource->identifier_slots != NULL )
+		{
+			memory_free(
+			 internal_string_table_resource->identifier_slots );
+		}
+		if( internal_string_table_resource->data_arena != NULL )
+		{
+			if( libwrc_arena_free(
+			     &( internal_string_table_resource->data_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data arena.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_string_table_resource );
 	}
@@ -181,8 +203,10 @@ int libwrc_string_table_resource_read(
 {
 	libwrc_internal_string_table_resource_t *internal_string_table_resource = NULL;
 	libwrc_table_entry_t *table_entry                                       = NULL;
+	uint8_t *string_table_data                                              = NULL;
 	static char *function                                                   = "libwrc_string_table_resource_read";
 	size_t data_offset                                                      = 0;
+	uint32_t string_identifier                                              = 0;
 	uint32_t string_size                                                    = 0;
 	int entry_index                                                         = 0;
 	int string_index                                                        = 0;
@@ -212,7 +236,7 @@ int libwrc_string_table_resource_read(
 		return( -1 );
 	}
 	if( ( data_size < 2 )
-	 || ( data_size > (size_t) SSIZE_MAX ) )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -235,6 +259,54 @@ int libwrc_string_table_resource_read(
 		 0 );
 	}
 #endif
+	/* The data is copied once so that the table entries
+	 * can reference the strings instead of copying them
+	 */
+	if( internal_string_table_resource->data_arena == NULL )
+	{
+		if( libwrc_arena_initialize(
+		     &( internal_string_table_resource->data_arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libwrc_arena_allocate(
+	     internal_string_table_resource->data_arena,
+	     data_size,
+	     (void **) &string_table_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     string_table_data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string table data.",
+		 function );
+
+		return( -1 );
+	}
 	while( data_offset < ( data_size - 2 ) )
 	{
 		byte_stream_copy_to_uint16_little_endian(
@@ -294,9 +366,9 @@ int libwrc_string_table_resource_read(
 
 				goto on_error;
 			}
-			if( libwrc_table_entry_set_string(
+			if( libwrc_table_entry_set_string_reference(
 			     table_entry,
-			     &( data[ data_offset ] ),
+			     &( string_table_data[ data_offset ] ),
 			     (size_t) string_size,
 			     LIBUNA_CODEPAGE_UTF16_LITTLE_ENDIAN,
 			     error ) != 1 )
@@ -310,7 +382,9 @@ int libwrc_string_table_resource_read(
 
 				goto on_error;
 			}
-			table_entry->identifier = ( ( base_identifier - 1 ) << 4 ) | (uint32_t) string_index;
+			string_identifier = ( ( base_identifier - 1 ) << 4 ) | (uint32_t) string_index;
+
+			table_entry->identifier = string_identifier;
 
 			if( libcdata_array_append_entry(
 			     internal_string_table_resource->entries_array,
@@ -329,6 +403,22 @@ int libwrc_string_table_resource_read(
 			}
 			table_entry = NULL;
 
+			if( libwrc_internal_string_table_resource_set_identifier_slot(
+			     internal_string_table_resource,
+			     string_identifier,
+			     entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set identifier slot of string: %d.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
 			data_offset += (size_t) string_size;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -354,9 +444,175 @@ on_error:
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_table_entry_free,
 	 error );
 
+	if( internal_string_table_resource->identifier_slots != NULL )
+	{
+		memory_free(
+		 internal_string_table_resource->identifier_slots );
+
+		internal_string_table_resource->identifier_slots = NULL;
+	}
+	internal_string_table_resource->first_identifier           = 0;
+	internal_string_table_resource->number_of_identifier_slots = 0;
+	internal_string_table_resource->identifier_slots_overflow  = 0;
+
+	libwrc_arena_reset(
+	 internal_string_table_resource->data_arena,
+	 NULL );
+
 	return( -1 );
 }
 
+/* Sets the identifier slot of a specific string identifier
+ * The identifier slots cover consecutive identifiers and are extended to the
+ * 16 identifiers of the string table block that contains the identifier
+ * If the identifier was set before the slot is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_internal_string_table_resource_set_identifier_slot(
+     libwrc_internal_string_table_resource_t *internal_string_table_resource,
+     uint32_t string_identifier,
+     int string_index,
+     libcerror_error_t **error )
+{
+	int *identifier_slots          = NULL;
+	static char *function          = "libwrc_internal_string_table_resource_set_identifier_slot";
+	size_t identifier_slots_size   = 0;
+	uint32_t first_identifier      = 0;
+	uint32_t last_identifier       = 0;
+	uint32_t slot_index            = 0;
+	int number_of_identifier_slots = 0;
+
+	if( internal_string_table_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index == INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_string_table_resource->identifier_slots_overflow != 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_string_table_resource->identifier_slots == NULL )
+	 || ( string_identifier < internal_string_table_resource->first_identifier )
+	 || ( ( string_identifier - internal_string_table_resource->first_identifier ) >= (uint32_t) internal_string_table_resource->number_of_identifier_slots ) )
+	{
+		first_identifier = string_identifier & ~( (uint32_t) 0x0000000fUL );
+		last_identifier  = string_identifier | 0x0000000fUL;
+
+		if( internal_string_table_resource->identifier_slots != NULL )
+		{
+			if( internal_string_table_resource->first_identifier < first_identifier )
+			{
+				first_identifier = internal_string_table_resource->first_identifier;
+			}
+			if( ( internal_string_table_resource->first_identifier + (uint32_t) internal_string_table_resource->number_of_identifier_slots - 1 ) > last_identifier )
+			{
+				last_identifier = internal_string_table_resource->first_identifier + (uint32_t) internal_string_table_resource->number_of_identifier_slots - 1;
+			}
+		}
+		/* Identifiers that are too far apart are looked up by scanning the entries array
+		 */
+		if( ( last_identifier - first_identifier ) >= LIBWRC_MAXIMUM_NUMBER_OF_STRING_IDENTIFIER_SLOTS )
+		{
+			if( internal_string_table_resource->identifier_slots != NULL )
+			{
+				memory_free(
+				 internal_string_table_resource->identifier_slots );
+
+				internal_string_table_resource->identifier_slots = NULL;
+			}
+			internal_string_table_resource->first_identifier           = 0;
+			internal_string_table_resource->number_of_identifier_slots = 0;
+			internal_string_table_resource->identifier_slots_overflow  = 1;
+
+			return( 1 );
+		}
+		number_of_identifier_slots = (int) ( last_identifier - first_identifier + 1 );
+		identifier_slots_size      = sizeof( int ) * number_of_identifier_slots;
+
+		identifier_slots = (int *) memory_allocate(
+		                            identifier_slots_size );
+
+		if( identifier_slots == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create identifier slots.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     identifier_slots,
+		     0,
+		     identifier_slots_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear identifier slots.",
+			 function );
+
+			memory_free(
+			 identifier_slots );
+
+			return( -1 );
+		}
+		if( internal_string_table_resource->identifier_slots != NULL )
+		{
+			if( memory_copy(
+			     &( identifier_slots[ internal_string_table_resource->first_identifier - first_identifier ] ),
+			     internal_string_table_resource->identifier_slots,
+			     sizeof( int ) * internal_string_table_resource->number_of_identifier_slots ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy identifier slots.",
+				 function );
+
+				memory_free(
+				 identifier_slots );
+
+				return( -1 );
+			}
+			memory_free(
+			 internal_string_table_resource->identifier_slots );
+		}
+		internal_string_table_resource->identifier_slots           = identifier_slots;
+		internal_string_table_resource->first_identifier           = first_identifier;
+		internal_string_table_resource->number_of_identifier_slots = number_of_identifier_slots;
+	}
+	slot_index = string_identifier - internal_string_table_resource->first_identifier;
+
+	if( internal_string_table_resource->identifier_slots[ slot_index ] == 0 )
+	{
+		internal_string_table_resource->identifier_slots[ slot_index ] = string_index + 1;
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of strings
  * Returns 1 if successful or -1 on error
  */
@@ -469,6 +725,7 @@ int libwrc_string_table_resource_get_identifier(
 }
 
 /* Retrieves the string index for a specific identifier
+ * The string index is retrieved from the identifier slots if available
  * Returns 1 if successful, 0 if no such string identifier or -1 on error
  */
 int libwrc_string_table_resource_get_index_by_identifier(
@@ -480,6 +737,7 @@ int libwrc_string_table_resource_get_index_by_identifier(
 	libwrc_internal_string_table_resource_t *internal_string_table_resource = NULL;
 	libwrc_table_entry_t *table_entry                                       = NULL;
 	static char *function                                                   = "libwrc_string_table_resource_get_index_by_identifier";
+	uint32_t slot_index                                                     = 0;
 	int number_of_strings                                                   = 0;
 	int safe_string_index                                                   = 0;
 
@@ -507,6 +765,24 @@ int libwrc_string_table_resource_get_index_by_identifier(
 
 		return( -1 );
 	}
+	if( internal_string_table_resource->identifier_slots_overflow == 0 )
+	{
+		if( ( internal_string_table_resource->identifier_slots == NULL )
+		 || ( string_identifier < internal_string_table_resource->first_identifier ) )
+		{
+			return( 0 );
+		}
+		slot_index = string_identifier - internal_string_table_resource->first_identifier;
+
+		if( ( slot_index >= (uint32_t) internal_string_table_resource->number_of_identifier_slots )
+		 || ( internal_string_table_resource->identifier_slots[ slot_index ] == 0 ) )
+		{
+			return( 0 );
+		}
+		*string_index = internal_string_table_resource->identifier_slots[ slot_index ] - 1;
+
+		return( 1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_string_table_resource->entries_array,
 	     &number_of_strings,
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libwrc_arena.h"
 #include "libwrc_extern.h"
 #include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
@@ -41,6 +42,29 @@ struct libwrc_internal_string_table_resource
 	/* The entries array
 	 */
 	libcdata_array_t *entries_array;
+
+	/* The data arena
+	 * Contains a copy of the data of every read, which the table entries reference
+	 */
+	libwrc_arena_t *data_arena;
+
+	/* The identifier of the first identifier slot
+	 */
+	uint32_t first_identifier;
+
+	/* The number of identifier slots
+	 */
+	int number_of_identifier_slots;
+
+	/* The identifier slots
+	 * Each slot contains the string index + 1 or 0 if not used
+	 */
+	int *identifier_slots;
+
+	/* Value to indicate the identifiers span too many slots
+	 * and are looked up by scanning the entries array
+	 */
+	uint8_t identifier_slots_overflow;
 };
 
 LIBWRC_EXTERN \
@@ -61,6 +85,12 @@ int libwrc_string_table_resource_read(
      uint32_t base_identifier,
      libcerror_error_t **error );
 
+int libwrc_internal_string_table_resource_set_identifier_slot(
+     libwrc_internal_string_table_resource_t *internal_string_table_resource,
+     uint32_t string_identifier,
+     int string_index,
+     libcerror_error_t **error );
+
 LIBWRC_EXTERN \
 int libwrc_string_table_resource_get_number_of_strings(
      libwrc_string_table_resource_t *string_table_resource,
@@ -44,17 +44,16 @@ int libwrc_string_values_read(
      libwrc_data_descriptor_t *data_descriptor,
      libcerror_error_t **error )
 {
-	libfvalue_value_t *string_value = NULL;
-	uint8_t *resource_data          = NULL;
-	uint8_t *string_resource_data   = NULL;
-	static char *function           = "libwrc_string_values_read";
-	off64_t file_offset             = 0;
-	size_t resource_data_size       = 0;
-	ssize_t read_count              = 0;
-	uint32_t string_identifier      = 0;
-	uint32_t string_index           = 0;
-	uint32_t string_size            = 0;
-	int value_index                 = 0;
+	libfvalue_value_t *string_value     = NULL;
+	const uint8_t *resource_data        = NULL;
+	uint8_t *resource_data_buffer       = NULL;
+	const uint8_t *string_resource_data = NULL;
+	static char *function               = "libwrc_string_values_read";
+	size_t resource_data_size           = 0;
+	uint32_t string_identifier          = 0;
+	uint32_t string_index               = 0;
+	uint32_t string_size                = 0;
+	int value_index                     = 0;
 
 	if( language_entry == NULL )
 	{
@@ -89,56 +88,25 @@ int libwrc_string_values_read(
 
 		return( -1 );
 	}
-	resource_data_size = (size_t) data_descriptor->size;
-
-	if( ( resource_data_size == 0 )
-	 || ( resource_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource data size value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-	resource_data = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * resource_data_size );
-
-	if( resource_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create resource data.",
-		 function );
-
-		goto on_error;
-	}
-	file_offset = data_descriptor->virtual_address - io_handle->virtual_address;
-
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              resource_data,
-	              resource_data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) resource_data_size )
+	if( libwrc_io_handle_read_resource_data(
+	     io_handle,
+	     file_io_handle,
+	     data_descriptor,
+	     &resource_data,
+	     &resource_data_buffer,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read resource data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 "%s: unable to read resource data.",
+		 function );
 
 		goto on_error;
 	}
+	resource_data_size = (size_t) data_descriptor->size;
+
 	string_resource_data = resource_data;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -305,9 +273,21 @@ int libwrc_string_values_read(
 #endif
 		string_index++;
 	}
-	memory_free(
-	 resource_data );
+	if( libwrc_io_handle_free_resource_data(
+	     io_handle,
+	     data_descriptor,
+	     &resource_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource data.",
+		 function );
 
+		goto on_error;
+	}
 /* TODO validate if number of strings is 16 ? */
 
 	return( 1 );
@@ -319,10 +299,13 @@ on_error:
 		 &string_value,
 		 NULL );
 	}
-	if( resource_data != NULL )
+	if( resource_data_buffer != NULL )
 	{
-		memory_free(
-		 resource_data );
+		libwrc_io_handle_free_resource_data(
+		 io_handle,
+		 data_descriptor,
+		 &resource_data_buffer,
+		 NULL );
 	}
 	return( -1 );
 }
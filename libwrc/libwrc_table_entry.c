@@ -26,6 +26,7 @@
 #include "libwrc_libcerror.h"
 #include "libwrc_libuna.h"
 #include "libwrc_table_entry.h"
+#include "libwrc_utf8_string.h"
 
 /* Creates a table entry
  * Make sure the value table_entry is referencing, is set to NULL
@@ -122,7 +123,8 @@ int libwrc_table_entry_free(
 	}
 	if( *table_entry != NULL )
 	{
-		if( ( *table_entry )->string != NULL )
+		if( ( ( *table_entry )->string != NULL )
+		 && ( ( *table_entry )->string_is_reference == 0 ) )
 		{
 			memory_free(
 			 ( *table_entry )->string );
@@ -239,6 +241,72 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the string as a reference
+ * The string is not copied and must remain valid for the lifetime of the table entry
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_table_entry_set_string_reference(
+     libwrc_table_entry_t *table_entry,
+     const uint8_t *string,
+     size_t string_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_table_entry_set_string_reference";
+
+	if( table_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_entry->string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table entry - string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	table_entry->string              = (uint8_t *) string;
+	table_entry->string_size         = string_size;
+	table_entry->codepage            = codepage;
+	table_entry->string_is_reference = 1;
+
+	return( 1 );
+}
+
 /* Retrieves the size of a specific UTF-8 formatted string
  * Returns 1 if successful or -1 on error
  */
@@ -263,10 +331,9 @@ int libwrc_table_entry_get_utf8_string_size(
 	}
 	if( table_entry->codepage == LIBUNA_CODEPAGE_UTF16_LITTLE_ENDIAN )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = libwrc_utf8_string_size_from_utf16_stream(
 		          table_entry->string,
 		          table_entry->string_size,
-		          LIBUNA_ENDIAN_LITTLE,
 		          utf8_string_size,
 		          error );
 	}
@@ -318,12 +385,11 @@ int libwrc_table_entry_get_utf8_string(
 	}
 	if( table_entry->codepage == LIBUNA_CODEPAGE_UTF16_LITTLE_ENDIAN )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
+		result = libwrc_utf8_string_copy_from_utf16_stream(
 		          utf8_string,
 		          utf8_string_size,
 		          table_entry->string,
 		          table_entry->string_size,
-		          LIBUNA_ENDIAN_LITTLE,
 		          error );
 	}
 	else
@@ -47,9 +47,14 @@ struct libwrc_table_entry
 	 */
 	size_t string_size;
 
+
 	/* The codepage
 	 */
 	int codepage;
+
+	/* Value to indicate the string references data owned by the resource
+	 */
+	uint8_t string_is_reference;
 };
 
 int libwrc_table_entry_initialize(
@@ -67,6 +72,13 @@ int libwrc_table_entry_set_string(
      int codepage,
      libcerror_error_t **error );
 
+int libwrc_table_entry_set_string_reference(
+     libwrc_table_entry_t *table_entry,
+     const uint8_t *string,
+     size_t string_size,
+     int codepage,
+     libcerror_error_t **error );
+
 int libwrc_table_entry_get_utf8_string_size(
      libwrc_table_entry_t *table_entry,
      size_t *utf8_string_size,
@@ -55,6 +55,140 @@ typedef intptr_t libwrc_version_information_resource_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The read-only view of a resource item that contains data
+ * The names are little-endian UTF-16 strings without end of string character
+ * and are only valid during the callback of libwrc_stream_visit_items
+ */
+typedef struct libwrc_resource_item_view libwrc_resource_item_view_t;
+
+struct libwrc_resource_item_view
+{
+	/* The resource type
+	 */
+	int type;
+
+	/* The resource type identifier
+	 */
+	uint32_t type_identifier;
+
+	/* The resource type name or NULL if not available
+	 */
+	const uint8_t *type_name;
+
+	/* The resource type name size
+	 */
+	size_t type_name_size;
+
+	/* The identifier
+	 */
+	uint32_t identifier;
+
+	/* The name or NULL if not available
+	 */
+	const uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The language identifier
+	 */
+	uint32_t language_identifier;
+
+	/* The (relative) virtual address of the data
+	 */
+	uint32_t virtual_address;
+
+	/* The size of the data
+	 */
+	uint32_t size;
+};
+
+/* A request to read the data of a resource item
+ * Used by libwrc_stream_read_items
+ */
+typedef struct libwrc_resource_item_read_request libwrc_resource_item_read_request_t;
+
+struct libwrc_resource_item_read_request
+{
+	/* The resource item
+	 */
+	libwrc_resource_item_t *resource_item;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The number of bytes read
+	 * Set by libwrc_stream_read_items
+	 */
+	size_t read_count;
+};
+
+/* The statistics of a stream
+ * Used by libwrc_stream_get_statistics
+ */
+typedef struct libwrc_statistics libwrc_statistics_t;
+
+struct libwrc_statistics
+{
+	/* The number of reads from the file IO handle
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read from the file IO handle
+	 */
+	uint64_t read_size;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The maximum (peak) number of bytes allocated
+	 */
+	uint64_t maximum_allocated_size;
+
+	/* The number of resource nodes (directories) parsed
+	 */
+	uint64_t number_of_nodes;
+
+	/* The number of resource node entries parsed
+	 */
+	uint64_t number_of_node_entries;
+
+	/* The number of data descriptors (leaves) parsed
+	 */
+	uint64_t number_of_data_descriptors;
+
+	/* The time spent reading the resource node tree in nanoseconds
+	 */
+	uint64_t node_tree_read_time;
+
+	/* The time spent reading string values in nanoseconds
+	 */
+	uint64_t string_values_read_time;
+
+	/* The time spent reading message table values in nanoseconds
+	 */
+	uint64_t message_table_values_read_time;
+
+	/* The time spent reading manifest values in nanoseconds
+	 */
+	uint64_t manifest_values_read_time;
+
+	/* The time spent reading MUI values in nanoseconds
+	 */
+	uint64_t mui_values_read_time;
+
+	/* The time spent reading version values in nanoseconds
+	 */
+	uint64_t version_values_read_time;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBWRC ) */
 
 #endif /* !defined( _LIBWRC_INTERNAL_TYPES_H ) */
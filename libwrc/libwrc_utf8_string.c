@@ -0,0 +1,242 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_libuna.h"
+#include "libwrc_utf8_string.h"
+
+/* Determines the size of an UTF-8 string from a little-endian UTF-16 stream
+ * Strings that only contain ASCII characters are handled directly,
+ * other strings are passed to libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwrc_utf8_string_size_from_utf16_stream";
+	size_t utf16_stream_index = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size >= 2 )
+	 && ( ( utf16_stream_size % 2 ) == 0 ) )
+	{
+		while( utf16_stream_index < utf16_stream_size )
+		{
+			if( ( utf16_stream[ utf16_stream_index + 1 ] != 0 )
+			 || ( utf16_stream[ utf16_stream_index ] > 0x7f ) )
+			{
+				break;
+			}
+			if( utf16_stream[ utf16_stream_index ] == 0 )
+			{
+				break;
+			}
+			utf16_stream_index += 2;
+		}
+		if( ( utf16_stream_index >= utf16_stream_size )
+		 || ( ( utf16_stream[ utf16_stream_index ] == 0 )
+		  &&  ( utf16_stream[ utf16_stream_index + 1 ] == 0 ) ) )
+		{
+			/* Each ASCII character is stored in a single byte and
+			 * the UTF-8 string is terminated by an end-of-string character
+			 */
+			*utf8_string_size = ( utf16_stream_index / 2 ) + 1;
+
+			return( 1 );
+		}
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from a little-endian UTF-16 stream
+ * Strings that only contain ASCII characters are handled directly,
+ * other strings are passed to libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwrc_utf8_string_copy_from_utf16_stream";
+	size_t utf16_stream_index = 0;
+	size_t utf8_string_index  = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size >= 2 )
+	 && ( ( utf16_stream_size % 2 ) == 0 ) )
+	{
+		while( ( utf16_stream_index < utf16_stream_size )
+		    && ( utf8_string_index < utf8_string_size ) )
+		{
+			if( ( utf16_stream[ utf16_stream_index + 1 ] != 0 )
+			 || ( utf16_stream[ utf16_stream_index ] > 0x7f ) )
+			{
+				break;
+			}
+			utf8_string[ utf8_string_index++ ] = utf16_stream[ utf16_stream_index ];
+
+			if( utf16_stream[ utf16_stream_index ] == 0 )
+			{
+				return( 1 );
+			}
+			utf16_stream_index += 2;
+		}
+		if( utf16_stream_index >= utf16_stream_size )
+		{
+			if( utf8_string_index >= utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ utf8_string_index ] = 0;
+
+			return( 1 );
+		}
+	}
+	/* Strings that contain non-ASCII characters and strings that do not fit
+	 * are converted by libuna, which also provides the corresponding error
+	 */
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
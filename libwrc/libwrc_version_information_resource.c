@@ -26,10 +26,13 @@
 
 #include "libwrc_debug.h"
 #include "libwrc_definitions.h"
+#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
 #include "libwrc_libcnotify.h"
 #include "libwrc_libuna.h"
+#include "libwrc_utf8_string.h"
 #include "libwrc_version_information_resource.h"
+#include "libwrc_version_string_table.h"
 
 #include "wrc_version_information_resource.h"
 
@@ -37,6 +40,10 @@ uint8_t libwrc_version_information_resource_signature[ 32 ] = {
 	'V', 0, 'S', 0, '_', 0, 'V', 0, 'E', 0, 'R', 0, 'S', 0, 'I', 0,
 	'O', 0, 'N', 0, '_', 0, 'I', 0, 'N', 0, 'F', 0, 'O', 0, 0, 0 };
 
+uint8_t libwrc_version_information_resource_translation_key[ 24 ] = {
+	'T', 0, 'r', 0, 'a', 0, 'n', 0, 's', 0, 'l', 0, 'a', 0, 't', 0,
+	'i', 0, 'o', 0, 'n', 0, 0, 0 };
+
 /* Creates a version information resource
  * Make sure the value version_information_resource is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -96,6 +103,23 @@ int libwrc_version_information_resource_initialize(
 		 "%s: unable to clear version information resource.",
 		 function );
 
+		memory_free(
+		 internal_version_information_resource );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_version_information_resource->string_tables_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string tables array.",
+		 function );
+
 		goto on_error;
 	}
 	*version_information_resource = (libwrc_version_information_resource_t *) internal_version_information_resource;
@@ -120,6 +144,7 @@ int libwrc_version_information_resource_free(
 {
 	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
 	static char *function                                                                 = "libwrc_version_information_resource_free";
+	int result                                                                            = 1;
 
 	if( version_information_resource == NULL )
 	{
@@ -137,9 +162,264 @@ int libwrc_version_information_resource_free(
 		internal_version_information_resource = (libwrc_internal_version_information_resource_t *) *version_information_resource;
 		*version_information_resource         = NULL;
 
+		if( libcdata_array_free(
+		     &( internal_version_information_resource->string_tables_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_version_string_table_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string tables array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_version_information_resource->translations != NULL )
+		{
+			memory_free(
+			 internal_version_information_resource->translations );
+		}
+		if( internal_version_information_resource->data != NULL )
+		{
+			memory_free(
+			 internal_version_information_resource->data );
+		}
 		memory_free(
 		 internal_version_information_resource );
 	}
+	return( result );
+}
+
+/* Reads the fixed file information
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_internal_version_information_resource_read_fixed_file_information(
+     libwrc_internal_version_information_resource_t *internal_version_information_resource,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_internal_version_information_resource_read_fixed_file_information";
+	uint32_t value_32bit  = 0;
+
+	if( internal_version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( wrc_version_fixed_file_information_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: fixed file information data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 data_size,
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_version_upper,
+	 internal_version_information_resource->file_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_version_lower,
+	 value_32bit );
+
+	internal_version_information_resource->file_version <<= 32;
+	internal_version_information_resource->file_version  |= value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->product_version_upper,
+	 internal_version_information_resource->product_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->product_version_lower,
+	 value_32bit );
+
+	internal_version_information_resource->product_version <<= 32;
+	internal_version_information_resource->product_version  |= value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_flags_bitmask,
+	 internal_version_information_resource->file_flags_bitmask );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_flags,
+	 internal_version_information_resource->file_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_operating_system,
+	 internal_version_information_resource->file_operating_system );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_type,
+	 internal_version_information_resource->file_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_sub_type,
+	 internal_version_information_resource->file_sub_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_time_upper,
+	 internal_version_information_resource->file_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (wrc_version_fixed_file_information_t *) data )->file_time_lower,
+	 value_32bit );
+
+	internal_version_information_resource->file_time <<= 32;
+	internal_version_information_resource->file_time  |= value_32bit;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->signature,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: signature\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->version,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: version\t\t\t: %" PRIu32 ".%" PRIu32 "\n",
+		 function,
+		 value_32bit >> 16,
+		 value_32bit & 0x0000ffffUL );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_version_upper,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file version upper\t\t: %" PRIu32 ".%" PRIu32 "\n",
+		 function,
+		 value_32bit >> 16,
+		 value_32bit & 0x0000ffffUL );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_version_lower,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file version lower\t\t: %" PRIu32 ".%" PRIu32 "\n",
+		 function,
+		 value_32bit >> 16,
+		 value_32bit & 0x0000ffffUL );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->product_version_upper,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: product version upper\t\t: %" PRIu32 ".%" PRIu32 "\n",
+		 function,
+		 value_32bit >> 16,
+		 value_32bit & 0x0000ffffUL );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->product_version_lower,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: product version lower\t\t: %" PRIu32 ".%" PRIu32 "\n",
+		 function,
+		 value_32bit >> 16,
+		 value_32bit & 0x0000ffffUL );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_flags_bitmask,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file flags bitmask\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_flags,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file flags\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_operating_system,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file operating system\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_type,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file type\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_sub_type,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file sub type\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_time_upper,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file time upper\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wrc_version_fixed_file_information_t *) data )->file_time_lower,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file time lower\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
 	return( 1 );
 }
 
@@ -342,25 +622,45 @@ ssize_t libwrc_internal_version_information_resource_read_string_file_informatio
 		if( value_data_type == 1 )
 		{
 /* TODO check value_data_size == 0 ? */
-			read_count = libwrc_internal_version_information_resource_read_string_table(
-				      internal_version_information_resource,
-				      data,
-				      data_size,
-				      data_offset,
-				      error );
-
-			if( read_count == -1 )
+			/* A string table is stored for every language and codepage
+			 */
+			while( ( data_offset + 2 ) < ( data_start_offset + string_data_size ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read string table.",
-				 function );
+				read_count = libwrc_internal_version_information_resource_read_string_table(
+					      internal_version_information_resource,
+					      data,
+					      data_size,
+					      data_offset,
+					      error );
 
-				return( -1 );
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read string table.",
+					 function );
+
+					return( -1 );
+				}
+				else if( read_count == 0 )
+				{
+					break;
+				}
+				data_offset += read_count;
+
+				if( ( data_offset % 4 ) != 0 )
+				{
+					alignment_padding_size = 4 - ( data_offset % 4 );
+
+					if( ( data_offset + alignment_padding_size ) >= ( data_start_offset + string_data_size ) )
+					{
+						break;
+					}
+					data_offset += alignment_padding_size;
+				}
 			}
-			data_offset += read_count;
 		}
 /* TODO print unsupported type warning */
 		calculated_value_data_size = data_offset - data_start_offset;
@@ -397,19 +697,23 @@ ssize_t libwrc_internal_version_information_resource_read_string_table(
          size_t data_offset,
          libcerror_error_t **error )
 {
-	static char *function                  = "libwrc_internal_version_information_resource_read_string_table";
-	size_t alignment_padding_size          = 0;
-	size_t calculated_value_data_size      = 0;
-	size_t data_start_offset               = 0;
-	ssize_t read_count                     = 0;
-	uint16_t string_data_size              = 0;
-	uint16_t value_data_size               = 0;
-	uint16_t value_data_type               = 0;
+	libwrc_version_string_table_t *string_table = NULL;
+	const uint8_t *value_identifier_string      = NULL;
+	static char *function                       = "libwrc_internal_version_information_resource_read_string_table";
+	size_t alignment_padding_size               = 0;
+	size_t calculated_value_data_size           = 0;
+	size_t data_start_offset                    = 0;
+	size_t value_identifier_string_size         = 0;
+	ssize_t read_count                          = 0;
+	uint32_t string_table_identifier            = 0;
+	uint16_t string_data_size                   = 0;
+	uint16_t value_data_size                    = 0;
+	uint16_t value_data_type                    = 0;
+	int entry_index                             = 0;
+	int result                                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	const uint8_t *value_identifier_string = NULL;
-	size_t trailing_data_size              = 0;
-	size_t value_identifier_string_size    = 0;
+	size_t trailing_data_size                   = 0;
 #endif
 
 	if( internal_version_information_resource == NULL )
@@ -523,14 +827,14 @@ ssize_t libwrc_internal_version_information_resource_read_string_table(
 			 function,
 			 value_data_type );
 		}
+#endif
 		value_identifier_string      = &( data[ data_offset ] );
 		value_identifier_string_size = 0;
-#endif
+
 		while( ( data_offset + 2 ) < data_size )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
 			value_identifier_string_size += 2;
-#endif
+
 			if( ( data[ data_offset ] == 0 )
 			 && ( data[ data_offset + 1 ] == 0 ) )
 			{
@@ -552,21 +856,73 @@ ssize_t libwrc_internal_version_information_resource_read_string_table(
 			 0 );
 		}
 #endif
-/* TODO convert string */
-		if( ( data_offset % 4 ) != 0 )
+		/* The key of a string table contains the language identifier
+		 * and codepage as hexadecimal digits
+		 */
+		result = libwrc_version_string_table_get_identifier_from_utf16_stream(
+		          value_identifier_string,
+		          value_identifier_string_size,
+		          &string_table_identifier,
+		          error );
+
+		if( result == -1 )
 		{
-			alignment_padding_size = 4 - ( data_offset % 4 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string table identifier.",
+			 function );
 
-			if( alignment_padding_size > ( data_size - data_offset ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid data size value too small.",
-				 function );
+			return( -1 );
+		}
+		if( libwrc_version_string_table_initialize(
+		     &string_table,
+		     string_table_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create string table.",
+			 function );
 
-				return( -1 );
+			return( -1 );
+		}
+		if( libcdata_array_append_entry(
+		     internal_version_information_resource->string_tables_array,
+		     &entry_index,
+		     (intptr_t *) string_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string table to array.",
+			 function );
+
+			libwrc_version_string_table_free(
+			 &string_table,
+			 NULL );
+
+			return( -1 );
+		}
+		if( ( data_offset % 4 ) != 0 )
+		{
+			alignment_padding_size = 4 - ( data_offset % 4 );
+
+			if( alignment_padding_size > ( data_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				return( -1 );
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -606,6 +962,7 @@ ssize_t libwrc_internal_version_information_resource_read_string_table(
 			{
 				read_count = libwrc_internal_version_information_resource_read_string(
 					      internal_version_information_resource,
+					      string_table,
 					      data,
 					      data_size,
 					      data_offset,
@@ -688,25 +1045,30 @@ ssize_t libwrc_internal_version_information_resource_read_string_table(
 }
 
 /* Reads the version information resource string
+ * The key and value of the string are added to the string table
  * Returns number of bytes read if successful or -1 on error
  */
 ssize_t libwrc_internal_version_information_resource_read_string(
          libwrc_internal_version_information_resource_t *internal_version_information_resource,
+         libwrc_version_string_table_t *string_table,
          const uint8_t *data,
          size_t data_size,
          size_t data_offset,
          libcerror_error_t **error )
 {
+	const uint8_t *key_string     = NULL;
+	const uint8_t *value_string   = NULL;
 	static char *function         = "libwrc_internal_version_information_resource_read_string";
-	uint16_t string_data_size     = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
 	size_t alignment_padding_size = 0;
+	size_t data_end_offset        = 0;
 	size_t data_start_offset      = 0;
-	size_t trailing_data_size     = 0;
-	size_t value_string_offset    = 0;
+	size_t key_string_size        = 0;
 	size_t value_string_size      = 0;
+	uint16_t string_data_size     = 0;
 	uint16_t value_data_size      = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	size_t trailing_data_size     = 0;
 	uint16_t value_data_type      = 0;
 #endif
 
@@ -721,6 +1083,17 @@ ssize_t libwrc_internal_version_information_resource_read_string(
 
 		return( -1 );
 	}
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -765,9 +1138,7 @@ ssize_t libwrc_internal_version_information_resource_read_string(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
 	data_start_offset = data_offset;
-#endif
 
 	byte_stream_copy_to_uint16_little_endian(
 	 &( data[ data_offset ] ),
@@ -798,11 +1169,12 @@ ssize_t libwrc_internal_version_information_resource_read_string(
 
 			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
+		data_end_offset = data_start_offset + string_data_size;
+
 		byte_stream_copy_to_uint16_little_endian(
 		 &( data[ data_offset ] ),
 		 value_data_size );
-#endif
+
 		data_offset += 2;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -826,17 +1198,14 @@ ssize_t libwrc_internal_version_information_resource_read_string(
 			 value_data_type );
 		}
 #endif
-/* TODO check value_data_size == 0 ? */
 /* TODO handle value_data_type != 1 */
-#if defined( HAVE_DEBUG_OUTPUT )
-		value_string_offset = data_offset;
-		value_string_size = 0;
-#endif
-		while( ( data_offset + 2 ) < data_size )
+		key_string      = &( data[ data_offset ] );
+		key_string_size = 0;
+
+		while( ( data_offset + 2 ) <= data_end_offset )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			value_string_size += 2;
-#endif
+			key_string_size += 2;
+
 			if( ( data[ data_offset ] == 0 )
 			 && ( data[ data_offset + 1 ] == 0 ) )
 			{
@@ -853,28 +1222,22 @@ ssize_t libwrc_internal_version_information_resource_read_string(
 			 "%s: value identifier string data:\n",
 			 function );
 			libcnotify_print_data(
-			 &( data[ value_string_offset ] ),
-			 value_string_size,
+			 key_string,
+			 key_string_size,
 			 0 );
 		}
 #endif
-/* TODO convert string */
 		if( ( data_offset % 4 ) != 0 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( alignment_padding_size > ( data_size - data_offset ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid data size value too small.",
-				 function );
-
-				return( -1 );
-			}
 			alignment_padding_size = 4 - ( data_offset % 4 );
 
+			/* A string without a value can end before the alignment padding
+			 */
+			if( alignment_padding_size > ( data_end_offset - data_offset ) )
+			{
+				alignment_padding_size = data_end_offset - data_offset;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
@@ -885,42 +1248,48 @@ ssize_t libwrc_internal_version_information_resource_read_string(
 				 alignment_padding_size,
 				 0 );
 			}
-			data_offset += alignment_padding_size;
 #endif
+			data_offset += alignment_padding_size;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		value_string_offset = data_offset;
-		value_string_size   = 0;
-
-		while( ( data_offset + 2 ) < data_size )
+		/* The value data size is not used to determine the size of the value string
+		 * since it contains the number of bytes instead of characters in some files
+		 */
+		if( value_data_size > 0 )
 		{
-			value_string_size += 2;
+			value_string      = &( data[ data_offset ] );
+			value_string_size = 0;
 
-			if( ( data[ data_offset ] == 0 )
-			 && ( data[ data_offset + 1 ] == 0 ) )
+			while( ( data_offset + 2 ) <= data_end_offset )
 			{
-				data_offset += 2;
+				value_string_size += 2;
 
-				break;
+				if( ( data[ data_offset ] == 0 )
+				 && ( data[ data_offset + 1 ] == 0 ) )
+				{
+					data_offset += 2;
+
+					break;
+				}
+				data_offset += 2;
+			}
+			if( value_string_size == 0 )
+			{
+				value_string = NULL;
 			}
-			data_offset += 2;
-		}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: value string data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( data[ value_string_offset ] ),
-			 value_string_size,
-			 0 );
 		}
-#endif
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
+			if( value_string != NULL )
+			{
+				libcnotify_printf(
+				 "%s: value string data:\n",
+				 function );
+				libcnotify_print_data(
+				 value_string,
+				 value_string_size,
+				 0 );
+			}
 			trailing_data_size = data_offset - data_start_offset;
 
 			if( trailing_data_size < string_data_size )
@@ -937,6 +1306,26 @@ ssize_t libwrc_internal_version_information_resource_read_string(
 			}
 		}
 #endif
+		if( key_string_size > 0 )
+		{
+			if( libwrc_version_string_table_append_string(
+			     string_table,
+			     key_string,
+			     key_string_size,
+			     value_string,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append string to string table.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
 	return( (ssize_t) string_data_size );
 }
@@ -1191,6 +1580,7 @@ ssize_t libwrc_internal_version_information_resource_read_variable_file_informat
 }
 
 /* Reads the version information resource variable
+ * The language identifiers and codepages of a translation variable are added to the translations
  * Returns number of bytes read if successful or -1 on error
  */
 ssize_t libwrc_internal_version_information_resource_read_variable(
@@ -1200,17 +1590,22 @@ ssize_t libwrc_internal_version_information_resource_read_variable(
          size_t data_offset,
          libcerror_error_t **error )
 {
+	const uint8_t *key_string     = NULL;
+	void *reallocation            = NULL;
 	static char *function         = "libwrc_internal_version_information_resource_read_variable";
-	uint16_t string_data_size     = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
 	size_t alignment_padding_size = 0;
+	size_t data_end_offset        = 0;
 	size_t data_start_offset      = 0;
-	size_t trailing_data_size     = 0;
-	size_t value_string_offset    = 0;
-	size_t value_string_size      = 0;
+	size_t key_string_size        = 0;
+	size_t translations_size      = 0;
+	uint16_t string_data_size     = 0;
 	uint16_t value_data_size      = 0;
 	uint16_t value_data_type      = 0;
+	int number_of_translations    = 0;
+	int translation_index         = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	size_t trailing_data_size     = 0;
 #endif
 
 	if( internal_version_information_resource == NULL )
@@ -1268,9 +1663,7 @@ ssize_t libwrc_internal_version_information_resource_read_variable(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
 	data_start_offset = data_offset;
-#endif
 
 	byte_stream_copy_to_uint16_little_endian(
 	 &( data[ data_offset ] ),
@@ -1301,18 +1694,18 @@ ssize_t libwrc_internal_version_information_resource_read_variable(
 
 			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
+		data_end_offset = data_start_offset + string_data_size;
+
 		byte_stream_copy_to_uint16_little_endian(
 		 &( data[ data_offset ] ),
 		 value_data_size );
-#endif
+
 		data_offset += 2;
 
-#if defined( HAVE_DEBUG_OUTPUT )
 		byte_stream_copy_to_uint16_little_endian(
 		 &( data[ data_offset ] ),
 		 value_data_type );
-#endif
+
 		data_offset += 2;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1329,17 +1722,13 @@ ssize_t libwrc_internal_version_information_resource_read_variable(
 			 value_data_type );
 		}
 #endif
-/* TODO check value_data_size == 0 ? */
-/* TODO handle value_data_type != 1 */
-#if defined( HAVE_DEBUG_OUTPUT )
-		value_string_offset = data_offset;
-		value_string_size = 0;
-#endif
-		while( ( data_offset + 2 ) < data_size )
+		key_string      = &( data[ data_offset ] );
+		key_string_size = 0;
+
+		while( ( data_offset + 2 ) <= data_end_offset )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			value_string_size += 2;
-#endif
+			key_string_size += 2;
+
 			if( ( data[ data_offset ] == 0 )
 			 && ( data[ data_offset + 1 ] == 0 ) )
 			{
@@ -1356,28 +1745,20 @@ ssize_t libwrc_internal_version_information_resource_read_variable(
 			 "%s: value identifier string data:\n",
 			 function );
 			libcnotify_print_data(
-			 &( data[ value_string_offset ] ),
-			 value_string_size,
+			 key_string,
+			 key_string_size,
 			 0 );
 		}
 #endif
-/* TODO convert string */
 		if( ( data_offset % 4 ) != 0 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
 			alignment_padding_size = 4 - ( data_offset % 4 );
 
-			if( alignment_padding_size > ( data_size - data_offset ) )
+			if( alignment_padding_size > ( data_end_offset - data_offset ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid data size value too small.",
-				 function );
-
-				return( -1 );
+				alignment_padding_size = data_end_offset - data_offset;
 			}
+#if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
@@ -1388,11 +1769,66 @@ ssize_t libwrc_internal_version_information_resource_read_variable(
 				 alignment_padding_size,
 				 0 );
 			}
-			data_offset += alignment_padding_size;
 #endif
+			data_offset += alignment_padding_size;
 		}
-/* TODO */
+		/* The translation variable contains 32-bit values with the language identifier
+		 * in the lower 16-bit and the codepage in the upper 16-bit
+		 */
+		if( ( value_data_type == 0 )
+		 && ( value_data_size > 0 )
+		 && ( value_data_size <= ( data_end_offset - data_offset ) )
+		 && ( ( value_data_size % 4 ) == 0 )
+		 && ( key_string_size == 24 )
+		 && ( memory_compare(
+		       key_string,
+		       libwrc_version_information_resource_translation_key,
+		       24 ) == 0 ) )
+		{
+			number_of_translations = internal_version_information_resource->number_of_translations + ( value_data_size / 4 );
+
+			translations_size = sizeof( uint32_t ) * number_of_translations;
+
+			reallocation = memory_reallocate(
+			                internal_version_information_resource->translations,
+			                translations_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize translations.",
+				 function );
+
+				return( -1 );
+			}
+			internal_version_information_resource->translations = (uint32_t *) reallocation;
+
+			for( translation_index = internal_version_information_resource->number_of_translations;
+			     translation_index < number_of_translations;
+			     translation_index++ )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( data[ data_offset ] ),
+				 internal_version_information_resource->translations[ translation_index ] );
 
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: translation: %d\t\t\t: 0x%04" PRIx32 " 0x%04" PRIx32 "\n",
+					 function,
+					 translation_index,
+					 internal_version_information_resource->translations[ translation_index ] & 0x0000ffffUL,
+					 internal_version_information_resource->translations[ translation_index ] >> 16 );
+				}
+#endif
+				data_offset += 4;
+			}
+			internal_version_information_resource->number_of_translations = number_of_translations;
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -1432,7 +1868,6 @@ int libwrc_version_information_resource_read(
 	size_t data_offset                                                                    = 0;
 	size_t value_identifier_string_size                                                   = 0;
 	ssize_t read_count                                                                    = 0;
-	uint32_t value_32bit                                                                  = 0;
 	uint16_t value_data_size                                                              = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1452,6 +1887,17 @@ int libwrc_version_information_resource_read(
 	}
 	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
 
+	if( internal_version_information_resource->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid version information resource - data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -1464,7 +1910,8 @@ int libwrc_version_information_resource_read(
 		return( -1 );
 	}
 	if( ( data_size < sizeof( wrc_version_value_header_t ) )
-	 || ( data_size > (size_t) SSIZE_MAX ) )
+	 || ( data_size > (size_t) SSIZE_MAX )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1487,6 +1934,40 @@ int libwrc_version_information_resource_read(
 		 0 );
 	}
 #endif
+	/* The resource data is retained so that the string tables
+	 * can reference the keys and values instead of copying them
+	 */
+	internal_version_information_resource->data = (uint8_t *) memory_allocate(
+	                                                           sizeof( uint8_t ) * data_size );
+
+	if( internal_version_information_resource->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_version_information_resource->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_version_information_resource->data_size = data_size;
+
+	data = internal_version_information_resource->data;
 
 	byte_stream_copy_to_uint16_little_endian(
 	 ( (wrc_version_value_header_t *) data )->value_data_size,
@@ -1564,7 +2045,7 @@ int libwrc_version_information_resource_read(
 		 "%s: unsupported version resource value signature.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1584,7 +2065,7 @@ int libwrc_version_information_resource_read(
 			 "%s: unable to print UTF-16 string value.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
@@ -1602,7 +2083,7 @@ int libwrc_version_information_resource_read(
 			 "%s: invalid data size value too small.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -1618,10 +2099,9 @@ int libwrc_version_information_resource_read(
 #endif
 		data_offset += alignment_padding_size;
 	}
-/* TODO refactor to separate function? */
 	if( value_data_size > 0 )
 	{
-		if( ( value_data_size < 52 )
+		if( ( value_data_size < sizeof( wrc_version_fixed_file_information_t ) )
 		 || ( value_data_size > ( data_size - data_offset ) ) )
 		{
 			libcerror_error_set(
@@ -1631,185 +2111,49 @@ int libwrc_version_information_resource_read(
 			 "%s: invalid value data size value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libwrc_internal_version_information_resource_read_fixed_file_information(
+		     internal_version_information_resource,
+		     &( data[ data_offset ] ),
+		     (size_t) value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read fixed file information.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += value_data_size;
+	}
+	if( ( data_offset % 4 ) != 0 )
+	{
+		alignment_padding_size = 4 - ( data_offset % 4 );
+
+		if( alignment_padding_size > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: value data:\n",
+			 "%s: alignment padding:\n",
 			 function );
 			libcnotify_print_data(
 			 &( data[ data_offset ] ),
-			 value_data_size,
-			 0 );
-		}
-#endif
-		byte_stream_copy_to_uint32_little_endian(
-		 &( data[ data_offset + 8 ] ),
-		 internal_version_information_resource->file_version );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 &( data[ data_offset + 12 ] ),
-		 value_32bit );
-
-		internal_version_information_resource->file_version <<= 32;
-		internal_version_information_resource->file_version  |= value_32bit;
-
-		byte_stream_copy_to_uint32_little_endian(
-		 &( data[ data_offset + 16 ] ),
-		 internal_version_information_resource->product_version );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 &( data[ data_offset + 20 ] ),
-		 value_32bit );
-
-		internal_version_information_resource->product_version <<= 32;
-		internal_version_information_resource->product_version  |= value_32bit;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: signature\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 4 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: version\t\t\t: %" PRIu32 ".%" PRIu32 "\n",
-			 function,
-			 value_32bit >> 16,
-			 value_32bit & 0x0000ffffUL );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 8 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file version upper\t\t: %" PRIu32 ".%" PRIu32 "\n",
-			 function,
-			 value_32bit >> 16,
-			 value_32bit & 0x0000ffffUL );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 12 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file version lower\t\t: %" PRIu32 ".%" PRIu32 "\n",
-			 function,
-			 value_32bit >> 16,
-			 value_32bit & 0x0000ffffUL );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 16 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: product version upper\t\t: %" PRIu32 ".%" PRIu32 "\n",
-			 function,
-			 value_32bit >> 16,
-			 value_32bit & 0x0000ffffUL );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 20 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: product version lower\t\t: %" PRIu32 ".%" PRIu32 "\n",
-			 function,
-			 value_32bit >> 16,
-			 value_32bit & 0x0000ffffUL );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 24 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file flags bitmask\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 28 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file flags\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 32 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file operating system\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 36 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file type\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 40 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file sub type\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 44 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file time upper\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset + 48 ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: file time lower\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		data_offset += value_data_size;
-	}
-	if( ( data_offset % 4 ) != 0 )
-	{
-		alignment_padding_size = 4 - ( data_offset % 4 );
-
-		if( alignment_padding_size > ( data_size - data_offset ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid data size value too small.",
-			 function );
-
-			return( -1 );
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: alignment padding:\n",
-			 function );
-			libcnotify_print_data(
-			 &( data[ data_offset ] ),
-			 alignment_padding_size,
+			 alignment_padding_size,
 			 0 );
 		}
 #endif
@@ -1831,7 +2175,7 @@ int libwrc_version_information_resource_read(
 		 "%s: unable to read string file information.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	data_offset += read_count;
 
@@ -1851,6 +2195,161 @@ int libwrc_version_information_resource_read(
 		 "%s: unable to read variable file information.",
 		 function );
 
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcdata_array_empty(
+	 internal_version_information_resource->string_tables_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_version_string_table_free,
+	 NULL );
+
+	if( internal_version_information_resource->translations != NULL )
+	{
+		memory_free(
+		 internal_version_information_resource->translations );
+
+		internal_version_information_resource->translations = NULL;
+	}
+	internal_version_information_resource->number_of_translations = 0;
+
+	if( internal_version_information_resource->data != NULL )
+	{
+		memory_free(
+		 internal_version_information_resource->data );
+
+		internal_version_information_resource->data = NULL;
+	}
+	internal_version_information_resource->data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the fixed file information of the version information resource
+ * Only the value header, the signature and the fixed file information are read,
+ * which are contained in the first LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE bytes of the data
+ * The string and variable file information are not read
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_read_fixed_file_information(
+     libwrc_version_information_resource_t *version_information_resource,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_read_fixed_file_information";
+	size_t data_offset                                                                    = 0;
+	uint16_t value_data_size                                                              = 0;
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < ( sizeof( wrc_version_value_header_t ) + 32 ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (wrc_version_value_header_t *) data )->value_data_size,
+	 value_data_size );
+
+	data_offset = sizeof( wrc_version_value_header_t );
+
+	/* The value identifier string is expected to be the signature
+	 * hence its size is known and does not need to be scanned
+	 */
+	if( memory_compare(
+	     &( data[ data_offset ] ),
+	     libwrc_version_information_resource_signature,
+	     32 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported version resource value signature.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset += 32;
+
+	if( ( data_offset % 4 ) != 0 )
+	{
+		data_offset += 4 - ( data_offset % 4 );
+	}
+	if( value_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( value_data_size < sizeof( wrc_version_fixed_file_information_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the fixed file information needs to be contained in the data
+	 */
+	if( ( data_offset > data_size )
+	 || ( sizeof( wrc_version_fixed_file_information_t ) > ( data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_internal_version_information_resource_read_fixed_file_information(
+	     internal_version_information_resource,
+	     &( data[ data_offset ] ),
+	     sizeof( wrc_version_fixed_file_information_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fixed file information.",
+		 function );
+
 		return( -1 );
 	}
 	return( 1 );
@@ -1936,3 +2435,950 @@ int libwrc_version_information_resource_get_product_version(
 	return( 1 );
 }
 
+/* Retrieves the file flags bitmask
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_file_flags_bitmask(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_flags_bitmask,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_file_flags_bitmask";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( file_flags_bitmask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file flags bitmask.",
+		 function );
+
+		return( -1 );
+	}
+	*file_flags_bitmask = internal_version_information_resource->file_flags_bitmask;
+
+	return( 1 );
+}
+
+/* Retrieves the file flags
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_file_flags(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_flags,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_file_flags";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( file_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file flags.",
+		 function );
+
+		return( -1 );
+	}
+	*file_flags = internal_version_information_resource->file_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the file operating system
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_file_operating_system(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_operating_system,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_file_operating_system";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( file_operating_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file operating system.",
+		 function );
+
+		return( -1 );
+	}
+	*file_operating_system = internal_version_information_resource->file_operating_system;
+
+	return( 1 );
+}
+
+/* Retrieves the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_file_type(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_type,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_file_type";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	*file_type = internal_version_information_resource->file_type;
+
+	return( 1 );
+}
+
+/* Retrieves the file sub type
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_file_sub_type(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_sub_type,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_file_sub_type";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( file_sub_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file sub type.",
+		 function );
+
+		return( -1 );
+	}
+	*file_sub_type = internal_version_information_resource->file_sub_type;
+
+	return( 1 );
+}
+
+/* Retrieves the file time
+ * The file time is stored as a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_file_time(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint64_t *file_time,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_file_time";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( file_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file time.",
+		 function );
+
+		return( -1 );
+	}
+	*file_time = internal_version_information_resource->file_time;
+
+	return( 1 );
+}
+
+/* Retrieves a specific string of a specific string table by an UTF-8 formatted key
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_internal_version_information_resource_get_string_by_utf8_key(
+     libwrc_internal_version_information_resource_t *internal_version_information_resource,
+     int string_table_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error )
+{
+	libwrc_version_string_table_t *string_table = NULL;
+	static char *function                       = "libwrc_internal_version_information_resource_get_string_by_utf8_key";
+	int result                                  = 0;
+
+	if( internal_version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_version_information_resource->string_tables_array,
+	     string_table_index,
+	     (intptr_t **) &string_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string table: %d.",
+		 function,
+		 string_table_index );
+
+		return( -1 );
+	}
+	result = libwrc_version_string_table_get_string_by_utf8_key(
+	          string_table,
+	          utf8_key,
+	          utf8_key_length,
+	          string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string from string table: %d.",
+		 function,
+		 string_table_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific string of a specific string table by an UTF-16 formatted key
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_internal_version_information_resource_get_string_by_utf16_key(
+     libwrc_internal_version_information_resource_t *internal_version_information_resource,
+     int string_table_index,
+     const uint16_t *utf16_key,
+     size_t utf16_key_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error )
+{
+	libwrc_version_string_table_t *string_table = NULL;
+	static char *function                       = "libwrc_internal_version_information_resource_get_string_by_utf16_key";
+	int result                                  = 0;
+
+	if( internal_version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_version_information_resource->string_tables_array,
+	     string_table_index,
+	     (intptr_t **) &string_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string table: %d.",
+		 function,
+		 string_table_index );
+
+		return( -1 );
+	}
+	result = libwrc_version_string_table_get_string_by_utf16_key(
+	          string_table,
+	          utf16_key,
+	          utf16_key_length,
+	          string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string from string table: %d.",
+		 function,
+		 string_table_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of string tables
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_number_of_string_tables(
+     libwrc_version_information_resource_t *version_information_resource,
+     int *number_of_string_tables,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_number_of_string_tables";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_version_information_resource->string_tables_array,
+	     number_of_string_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of string tables.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier of a specific string table
+ * The identifier contains the language identifier in the upper 16-bit and the codepage in the lower 16-bit
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_string_table_identifier(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	libwrc_version_string_table_t *string_table                                           = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_string_table_identifier";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_version_information_resource->string_tables_array,
+	     string_table_index,
+	     (intptr_t **) &string_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string table: %d.",
+		 function,
+		 string_table_index );
+
+		return( -1 );
+	}
+	*identifier = string_table->identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded string of a specific string table by an UTF-8 formatted key
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_version_information_resource_get_utf8_string_size_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	libwrc_version_string_t *string                                                       = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_utf8_string_size_by_key";
+	int result                                                                            = 0;
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwrc_internal_version_information_resource_get_string_by_utf8_key(
+	          internal_version_information_resource,
+	          string_table_index,
+	          utf8_key,
+	          utf8_key_length,
+	          &string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( string->value == NULL )
+	{
+		*utf8_string_size = 1;
+	}
+	else if( libwrc_utf8_string_size_from_utf16_stream(
+	          string->value,
+	          string->value_size,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded string of a specific string table by an UTF-8 formatted key
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_version_information_resource_get_utf8_string_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	libwrc_version_string_t *string                                                       = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_utf8_string_by_key";
+	int result                                                                            = 0;
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwrc_internal_version_information_resource_get_string_by_utf8_key(
+	          internal_version_information_resource,
+	          string_table_index,
+	          utf8_key,
+	          utf8_key_length,
+	          &string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( string->value == NULL )
+	{
+		if( utf8_string_size < 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ 0 ] = 0;
+	}
+	else if( libwrc_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          utf8_string_size,
+	          string->value,
+	          string->value_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded string of a specific string table by an UTF-16 formatted key
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_version_information_resource_get_utf16_string_size_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint16_t *utf16_key,
+     size_t utf16_key_length,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	libwrc_version_string_t *string                                                       = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_utf16_string_size_by_key";
+	int result                                                                            = 0;
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwrc_internal_version_information_resource_get_string_by_utf16_key(
+	          internal_version_information_resource,
+	          string_table_index,
+	          utf16_key,
+	          utf16_key_length,
+	          &string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( string->value == NULL )
+	{
+		*utf16_string_size = 1;
+	}
+	else if( libuna_utf16_string_size_from_utf16_stream(
+	          string->value,
+	          string->value_size,
+	          LIBUNA_ENDIAN_LITTLE,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded string of a specific string table by an UTF-16 formatted key
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_version_information_resource_get_utf16_string_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint16_t *utf16_key,
+     size_t utf16_key_length,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	libwrc_version_string_t *string                                                       = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_utf16_string_by_key";
+	int result                                                                            = 0;
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwrc_internal_version_information_resource_get_string_by_utf16_key(
+	          internal_version_information_resource,
+	          string_table_index,
+	          utf16_key,
+	          utf16_key_length,
+	          &string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( string->value == NULL )
+	{
+		if( utf16_string_size < 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string[ 0 ] = 0;
+	}
+	else if( libuna_utf16_string_copy_from_utf16_stream(
+	          utf16_string,
+	          utf16_string_size,
+	          string->value,
+	          string->value_size,
+	          LIBUNA_ENDIAN_LITTLE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of translations
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_number_of_translations(
+     libwrc_version_information_resource_t *version_information_resource,
+     int *number_of_translations,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_number_of_translations";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( number_of_translations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of translations.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_translations = internal_version_information_resource->number_of_translations;
+
+	return( 1 );
+}
+
+/* Retrieves a specific translation
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_information_resource_get_translation(
+     libwrc_version_information_resource_t *version_information_resource,
+     int translation_index,
+     uint16_t *language_identifier,
+     uint16_t *codepage,
+     libcerror_error_t **error )
+{
+	libwrc_internal_version_information_resource_t *internal_version_information_resource = NULL;
+	static char *function                                                                 = "libwrc_version_information_resource_get_translation";
+
+	if( version_information_resource == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid version information resource.",
+		 function );
+
+		return( -1 );
+	}
+	internal_version_information_resource = (libwrc_internal_version_information_resource_t *) version_information_resource;
+
+	if( ( translation_index < 0 )
+	 || ( translation_index >= internal_version_information_resource->number_of_translations ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid translation index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( language_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid language identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*language_identifier = (uint16_t) ( internal_version_information_resource->translations[ translation_index ] & 0x0000ffffUL );
+	*codepage            = (uint16_t) ( internal_version_information_resource->translations[ translation_index ] >> 16 );
+
+	return( 1 );
+}
+
@@ -26,8 +26,10 @@
 #include <types.h>
 
 #include "libwrc_extern.h"
+#include "libwrc_libcdata.h"
 #include "libwrc_libcerror.h"
 #include "libwrc_types.h"
+#include "libwrc_version_string_table.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -44,6 +46,54 @@ struct libwrc_internal_version_information_resource
 	/* The product version
 	 */
 	uint64_t product_version;
+
+	/* The file flags bitmask
+	 */
+	uint32_t file_flags_bitmask;
+
+	/* The file flags
+	 */
+	uint32_t file_flags;
+
+	/* The file operating system
+	 */
+	uint32_t file_operating_system;
+
+	/* The file type
+	 */
+	uint32_t file_type;
+
+	/* The file sub type
+	 */
+	uint32_t file_sub_type;
+
+	/* The file time
+	 * Contains a FILETIME
+	 */
+	uint64_t file_time;
+
+	/* The resource data
+	 * The string tables reference the keys and values in the resource data
+	 */
+	uint8_t *data;
+
+	/* The resource data size
+	 */
+	size_t data_size;
+
+	/* The string tables array
+	 */
+	libcdata_array_t *string_tables_array;
+
+	/* The translations
+	 * Each translation contains the language identifier in the lower 16-bit
+	 * and the codepage in the upper 16-bit
+	 */
+	uint32_t *translations;
+
+	/* The number of translations
+	 */
+	int number_of_translations;
 };
 
 LIBWRC_EXTERN \
@@ -51,6 +101,12 @@ int libwrc_version_information_resource_initialize(
      libwrc_version_information_resource_t **version_information_resource,
      libcerror_error_t **error );
 
+int libwrc_internal_version_information_resource_read_fixed_file_information(
+     libwrc_internal_version_information_resource_t *internal_version_information_resource,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 ssize_t libwrc_internal_version_information_resource_read_string_file_information(
          libwrc_internal_version_information_resource_t *internal_version_information_resource,
          const uint8_t *data,
@@ -67,6 +123,7 @@ ssize_t libwrc_internal_version_information_resource_read_string_table(
 
 ssize_t libwrc_internal_version_information_resource_read_string(
          libwrc_internal_version_information_resource_t *internal_version_information_resource,
+         libwrc_version_string_table_t *string_table,
          const uint8_t *data,
          size_t data_size,
          size_t data_offset,
@@ -98,6 +155,13 @@ int libwrc_version_information_resource_read(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_read_fixed_file_information(
+     libwrc_version_information_resource_t *version_information_resource,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBWRC_EXTERN \
 int libwrc_version_information_resource_get_file_version(
      libwrc_version_information_resource_t *version_information_resource,
@@ -110,6 +174,123 @@ int libwrc_version_information_resource_get_product_version(
      uint64_t *product_version,
      libcerror_error_t **error );
 
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_file_flags_bitmask(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_flags_bitmask,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_file_flags(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_flags,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_file_operating_system(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_operating_system,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_file_type(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_type,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_file_sub_type(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint32_t *file_sub_type,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_file_time(
+     libwrc_version_information_resource_t *version_information_resource,
+     uint64_t *file_time,
+     libcerror_error_t **error );
+
+int libwrc_internal_version_information_resource_get_string_by_utf8_key(
+     libwrc_internal_version_information_resource_t *internal_version_information_resource,
+     int string_table_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error );
+
+int libwrc_internal_version_information_resource_get_string_by_utf16_key(
+     libwrc_internal_version_information_resource_t *internal_version_information_resource,
+     int string_table_index,
+     const uint16_t *utf16_key,
+     size_t utf16_key_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_number_of_string_tables(
+     libwrc_version_information_resource_t *version_information_resource,
+     int *number_of_string_tables,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_string_table_identifier(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_utf8_string_size_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_utf8_string_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_utf16_string_size_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint16_t *utf16_key,
+     size_t utf16_key_length,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_utf16_string_by_key(
+     libwrc_version_information_resource_t *version_information_resource,
+     int string_table_index,
+     const uint16_t *utf16_key,
+     size_t utf16_key_length,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_number_of_translations(
+     libwrc_version_information_resource_t *version_information_resource,
+     int *number_of_translations,
+     libcerror_error_t **error );
+
+LIBWRC_EXTERN \
+int libwrc_version_information_resource_get_translation(
+     libwrc_version_information_resource_t *version_information_resource,
+     int translation_index,
+     uint16_t *language_identifier,
+     uint16_t *codepage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,859 @@
+/*
+ * Version (VERSIONINFO) string table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+#include "libwrc_libuna.h"
+#include "libwrc_resource_table.h"
+#include "libwrc_version_string_table.h"
+
+/* The key slots use open addressing with linear probing, like the resource
+ * table. The slots are rebuilt when more than half of them are used.
+ */
+
+/* Creates a string table
+ * Make sure the value string_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_string_table_initialize(
+     libwrc_version_string_table_t **string_table,
+     uint32_t identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_version_string_table_initialize";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_table = memory_allocate_structure(
+	                 libwrc_version_string_table_t );
+
+	if( *string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_table,
+	     0,
+	     sizeof( libwrc_version_string_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string table.",
+		 function );
+
+		goto on_error;
+	}
+	( *string_table )->identifier = identifier;
+
+	return( 1 );
+
+on_error:
+	if( *string_table != NULL )
+	{
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string table
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_string_table_free(
+     libwrc_version_string_table_t **string_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_version_string_table_free";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+		/* The key and value strings are freed elsewhere
+		 */
+		if( ( *string_table )->key_slots != NULL )
+		{
+			memory_free(
+			 ( *string_table )->key_slots );
+		}
+		if( ( *string_table )->strings != NULL )
+		{
+			memory_free(
+			 ( *string_table )->strings );
+		}
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier from the key of a string table
+ * The key is an UTF-16 little-endian string of 8 hexadecimal digits, such as "040904B0"
+ * Returns 1 if successful, 0 if the key is not an identifier or -1 on error
+ */
+int libwrc_version_string_table_get_identifier_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwrc_version_string_table_get_identifier_from_utf16_stream";
+	size_t utf16_stream_index = 0;
+	uint32_t safe_identifier  = 0;
+	uint8_t character_value   = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size < 16 )
+	{
+		return( 0 );
+	}
+	if( ( utf16_stream_size > 16 )
+	 && ( ( utf16_stream_size < 18 )
+	  || ( utf16_stream[ 16 ] != 0 )
+	  || ( utf16_stream[ 17 ] != 0 ) ) )
+	{
+		return( 0 );
+	}
+	for( utf16_stream_index = 0;
+	     utf16_stream_index < 16;
+	     utf16_stream_index += 2 )
+	{
+		if( utf16_stream[ utf16_stream_index + 1 ] != 0 )
+		{
+			return( 0 );
+		}
+		character_value = utf16_stream[ utf16_stream_index ];
+
+		if( ( character_value >= (uint8_t) '0' )
+		 && ( character_value <= (uint8_t) '9' ) )
+		{
+			character_value -= (uint8_t) '0';
+		}
+		else if( ( character_value >= (uint8_t) 'A' )
+		      && ( character_value <= (uint8_t) 'F' ) )
+		{
+			character_value -= (uint8_t) 'A' - 10;
+		}
+		else if( ( character_value >= (uint8_t) 'a' )
+		      && ( character_value <= (uint8_t) 'f' ) )
+		{
+			character_value -= (uint8_t) 'a' - 10;
+		}
+		else
+		{
+			return( 0 );
+		}
+		safe_identifier <<= 4;
+		safe_identifier  |= character_value;
+	}
+	*identifier = safe_identifier;
+
+	return( 1 );
+}
+
+/* Rebuilds the key slots of a string table
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_string_table_rebuild_key_slots(
+     libwrc_version_string_table_t *string_table,
+     uint32_t number_of_slots,
+     libcerror_error_t **error )
+{
+	int *key_slots        = NULL;
+	static char *function = "libwrc_version_string_table_rebuild_key_slots";
+	size_t slots_size     = 0;
+	uint32_t slot         = 0;
+	uint32_t slot_mask    = 0;
+	int string_index      = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots == 0 )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( number_of_slots > (uint32_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots_size = sizeof( int ) * number_of_slots;
+
+	key_slots = (int *) memory_allocate(
+	                     slots_size );
+
+	if( key_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     key_slots,
+	     0,
+	     slots_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key slots.",
+		 function );
+
+		memory_free(
+		 key_slots );
+
+		return( -1 );
+	}
+	slot_mask = number_of_slots - 1;
+
+	/* The strings are added in order so that a lookup returns
+	 * the first matching string
+	 */
+	for( string_index = 0;
+	     string_index < string_table->number_of_strings;
+	     string_index++ )
+	{
+		slot = string_table->strings[ string_index ].key_hash & slot_mask;
+
+		while( key_slots[ slot ] != 0 )
+		{
+			slot = ( slot + 1 ) & slot_mask;
+		}
+		key_slots[ slot ] = string_index + 1;
+	}
+	if( string_table->key_slots != NULL )
+	{
+		memory_free(
+		 string_table->key_slots );
+	}
+	string_table->key_slots       = key_slots;
+	string_table->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Appends a string to a string table
+ * The key and value are referenced and must remain valid while the string table is used
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_string_table_append_string(
+     libwrc_version_string_table_t *string_table,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	libwrc_version_string_t *string = NULL;
+	void *reallocation              = NULL;
+	static char *function           = "libwrc_version_string_table_append_string";
+	size_t strings_size             = 0;
+	uint32_t number_of_slots        = 0;
+	uint32_t slot                   = 0;
+	uint32_t slot_mask              = 0;
+	int number_of_allocated_strings = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value == NULL )
+	 && ( value_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_table->number_of_strings >= string_table->number_of_allocated_strings )
+	{
+		if( string_table->number_of_allocated_strings == 0 )
+		{
+			number_of_allocated_strings = 16;
+		}
+		else if( string_table->number_of_allocated_strings <= ( INT_MAX / 4 ) )
+		{
+			number_of_allocated_strings = string_table->number_of_allocated_strings * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string table - number of allocated strings value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		strings_size = sizeof( libwrc_version_string_t ) * number_of_allocated_strings;
+
+		if( strings_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid strings size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                string_table->strings,
+		                strings_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize strings.",
+			 function );
+
+			return( -1 );
+		}
+		string_table->strings                     = (libwrc_version_string_t *) reallocation;
+		string_table->number_of_allocated_strings = number_of_allocated_strings;
+	}
+	string = &( string_table->strings[ string_table->number_of_strings ] );
+
+	if( libwrc_resource_table_get_name_hash_from_utf16_stream(
+	     key,
+	     key_size,
+	     &( string->key_hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hash.",
+		 function );
+
+		return( -1 );
+	}
+	string->key        = key;
+	string->key_size   = key_size;
+	string->value      = value;
+	string->value_size = value_size;
+
+	string_table->number_of_strings += 1;
+
+	if( (uint32_t) ( 2 * string_table->number_of_strings ) > string_table->number_of_slots )
+	{
+		if( string_table->number_of_slots == 0 )
+		{
+			number_of_slots = 32;
+		}
+		else
+		{
+			number_of_slots = string_table->number_of_slots * 2;
+		}
+		if( libwrc_version_string_table_rebuild_key_slots(
+		     string_table,
+		     number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rebuild key slots.",
+			 function );
+
+			string_table->number_of_strings -= 1;
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		slot_mask = string_table->number_of_slots - 1;
+		slot      = string->key_hash & slot_mask;
+
+		while( string_table->key_slots[ slot ] != 0 )
+		{
+			slot = ( slot + 1 ) & slot_mask;
+		}
+		string_table->key_slots[ slot ] = string_table->number_of_strings;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_string_table_get_number_of_strings(
+     libwrc_version_string_table_t *string_table,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_version_string_table_get_number_of_strings";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_strings = string_table->number_of_strings;
+
+	return( 1 );
+}
+
+/* Retrieves a specific string
+ * Returns 1 if successful or -1 on error
+ */
+int libwrc_version_string_table_get_string_by_index(
+     libwrc_version_string_table_t *string_table,
+     int string_index,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error )
+{
+	static char *function = "libwrc_version_string_table_get_string_by_index";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= string_table->number_of_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	*string = &( string_table->strings[ string_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves a specific string by an UTF-8 formatted key
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_version_string_table_get_string_by_utf8_key(
+     libwrc_version_string_table_t *string_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error )
+{
+	libwrc_version_string_t *safe_string = NULL;
+	static char *function                = "libwrc_version_string_table_get_string_by_utf8_key";
+	uint32_t key_hash                    = 0;
+	uint32_t slot                        = 0;
+	uint32_t slot_mask                   = 0;
+	int result                           = 0;
+	int string_index                     = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_resource_table_get_name_hash_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     &key_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_table->number_of_slots == 0 )
+	{
+		return( 0 );
+	}
+	slot_mask = string_table->number_of_slots - 1;
+	slot      = key_hash & slot_mask;
+
+	string_index = string_table->key_slots[ slot ];
+
+	while( string_index != 0 )
+	{
+		safe_string = &( string_table->strings[ string_index - 1 ] );
+
+		if( safe_string->key_hash == key_hash )
+		{
+			result = libuna_utf8_string_compare_with_utf16_stream(
+			          utf8_string,
+			          utf8_string_length + 1,
+			          safe_string->key,
+			          safe_string->key_size,
+			          LIBUNA_ENDIAN_LITTLE,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key of string: %d.",
+				 function,
+				 string_index - 1 );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*string = safe_string;
+
+				return( 1 );
+			}
+		}
+		slot = ( slot + 1 ) & slot_mask;
+
+		string_index = string_table->key_slots[ slot ];
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific string by an UTF-16 formatted key
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libwrc_version_string_table_get_string_by_utf16_key(
+     libwrc_version_string_table_t *string_table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error )
+{
+	libwrc_version_string_t *safe_string = NULL;
+	static char *function                = "libwrc_version_string_table_get_string_by_utf16_key";
+	uint32_t key_hash                    = 0;
+	uint32_t slot                        = 0;
+	uint32_t slot_mask                   = 0;
+	int result                           = 0;
+	int string_index                     = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_resource_table_get_name_hash_from_utf16_string(
+	     utf16_string,
+	     utf16_string_length,
+	     &key_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_table->number_of_slots == 0 )
+	{
+		return( 0 );
+	}
+	slot_mask = string_table->number_of_slots - 1;
+	slot      = key_hash & slot_mask;
+
+	string_index = string_table->key_slots[ slot ];
+
+	while( string_index != 0 )
+	{
+		safe_string = &( string_table->strings[ string_index - 1 ] );
+
+		if( safe_string->key_hash == key_hash )
+		{
+			result = libuna_utf16_string_compare_with_utf16_stream(
+			          utf16_string,
+			          utf16_string_length + 1,
+			          safe_string->key,
+			          safe_string->key_size,
+			          LIBUNA_ENDIAN_LITTLE,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key of string: %d.",
+				 function,
+				 string_index - 1 );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*string = safe_string;
+
+				return( 1 );
+			}
+		}
+		slot = ( slot + 1 ) & slot_mask;
+
+		string_index = string_table->key_slots[ slot ];
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,150 @@
+/*
+ * Version (VERSIONINFO) string table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWRC_VERSION_STRING_TABLE_H )
+#define _LIBWRC_VERSION_STRING_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwrc_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwrc_version_string libwrc_version_string_t;
+
+struct libwrc_version_string
+{
+	/* The key
+	 * Contains an UTF-16 little-endian string that is not owned by the string
+	 */
+	const uint8_t *key;
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The value
+	 * Contains an UTF-16 little-endian string that is not owned by the string
+	 */
+	const uint8_t *value;
+
+	/* The value size
+	 */
+	size_t value_size;
+
+	/* The key hash
+	 */
+	uint32_t key_hash;
+};
+
+typedef struct libwrc_version_string_table libwrc_version_string_table_t;
+
+struct libwrc_version_string_table
+{
+	/* The identifier
+	 * Contains the language identifier in the upper 16-bit and the codepage in the lower 16-bit
+	 */
+	uint32_t identifier;
+
+	/* The strings
+	 */
+	libwrc_version_string_t *strings;
+
+	/* The number of strings
+	 */
+	int number_of_strings;
+
+	/* The number of allocated strings
+	 */
+	int number_of_allocated_strings;
+
+	/* The number of slots, which is a power of 2
+	 */
+	uint32_t number_of_slots;
+
+	/* The key slots
+	 * Each slot contains the string index + 1 or 0 if not used
+	 */
+	int *key_slots;
+};
+
+int libwrc_version_string_table_initialize(
+     libwrc_version_string_table_t **string_table,
+     uint32_t identifier,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_free(
+     libwrc_version_string_table_t **string_table,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_get_identifier_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_rebuild_key_slots(
+     libwrc_version_string_table_t *string_table,
+     uint32_t number_of_slots,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_append_string(
+     libwrc_version_string_table_t *string_table,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_get_number_of_strings(
+     libwrc_version_string_table_t *string_table,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_get_string_by_index(
+     libwrc_version_string_table_t *string_table,
+     int string_index,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_get_string_by_utf8_key(
+     libwrc_version_string_table_t *string_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error );
+
+int libwrc_version_string_table_get_string_by_utf16_key(
+     libwrc_version_string_table_t *string_table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libwrc_version_string_t **string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWRC_VERSION_STRING_TABLE_H ) */
+
@@ -157,10 +157,10 @@ int libwrc_version_values_read(
 {
 	libwrc_version_values_t *version_values = NULL;
 	libfvalue_value_t *value_identifier     = NULL;
-	uint8_t *resource_data                  = NULL;
-	uint8_t *version_resource_data          = NULL;
+	const uint8_t *resource_data            = NULL;
+	uint8_t *resource_data_buffer           = NULL;
+	const uint8_t *version_resource_data    = NULL;
 	static char *function                   = "libwrc_version_values_read";
-	off64_t file_offset                     = 0;
 	size_t alignment_padding_size           = 0;
 	size_t resource_data_offset             = 0;
 	size_t resource_data_size               = 0;
@@ -219,56 +219,36 @@ int libwrc_version_values_read(
 
 		goto on_error;
 	}
-	resource_data_size = (size_t) data_descriptor->size;
-
-	if( ( resource_data_size == 0 )
-	 || ( resource_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( libwrc_io_handle_read_resource_data(
+	     io_handle,
+	     file_io_handle,
+	     data_descriptor,
+	     &resource_data,
+	     &resource_data_buffer,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resource data.",
 		 function );
 
 		goto on_error;
 	}
-	resource_data = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * resource_data_size );
+	resource_data_size = (size_t) data_descriptor->size;
 
-	if( resource_data == NULL )
+	if( resource_data_size < sizeof( wrc_version_value_header_t ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create resource data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource data size value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	file_offset = data_descriptor->virtual_address - io_handle->virtual_address;
-
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              resource_data,
-	              resource_data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) resource_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read resource data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
-
-		goto on_error;
-	}
 	version_resource_data = resource_data;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -335,7 +315,7 @@ int libwrc_version_values_read(
 	read_count = libfvalue_value_type_set_data_string(
 	              value_identifier,
 	              &( version_resource_data[ resource_data_offset ] ),
-	              resource_data_size,
+	              resource_data_size - resource_data_offset,
 	              LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
 	              LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
 	              error );
@@ -428,7 +408,9 @@ int libwrc_version_values_read(
 /* TODO refactor to separate function? */
 	if( value_data_size > 0 )
 	{
-		if( value_data_size > resource_data_size )
+		if( ( (size_t) value_data_size < sizeof( wrc_version_fixed_file_information_t ) )
+		 || ( resource_data_offset > resource_data_size )
+		 || ( (size_t) value_data_size > ( resource_data_size - resource_data_offset ) ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -669,9 +651,21 @@ int libwrc_version_values_read(
 	}
 	version_values = NULL;
 
-	memory_free(
-	 resource_data );
+	if( libwrc_io_handle_free_resource_data(
+	     io_handle,
+	     data_descriptor,
+	     &resource_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource data.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -681,10 +675,13 @@ on_error:
 		 &value_identifier,
 		 NULL );
 	}
-	if( resource_data != NULL )
+	if( resource_data_buffer != NULL )
 	{
-		memory_free(
-		 resource_data );
+		libwrc_io_handle_free_resource_data(
+		 io_handle,
+		 data_descriptor,
+		 &resource_data_buffer,
+		 NULL );
 	}
 	if( version_values != NULL )
 	{
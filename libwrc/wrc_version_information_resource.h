@@ -49,6 +49,76 @@ struct wrc_version_value_header
 	uint8_t value_data_type[ 2 ];
 };
 
+typedef struct wrc_version_fixed_file_information wrc_version_fixed_file_information_t;
+
+struct wrc_version_fixed_file_information
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The version
+	 * Consists of 4 bytes
+	 */
+	uint8_t version[ 4 ];
+
+	/* The file version upper 32-bit
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_version_upper[ 4 ];
+
+	/* The file version lower 32-bit
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_version_lower[ 4 ];
+
+	/* The product version upper 32-bit
+	 * Consists of 4 bytes
+	 */
+	uint8_t product_version_upper[ 4 ];
+
+	/* The product version lower 32-bit
+	 * Consists of 4 bytes
+	 */
+	uint8_t product_version_lower[ 4 ];
+
+	/* The file flags bitmask
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_flags_bitmask[ 4 ];
+
+	/* The file flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_flags[ 4 ];
+
+	/* The file operating system
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_operating_system[ 4 ];
+
+	/* The file type
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_type[ 4 ];
+
+	/* The file sub type
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_sub_type[ 4 ];
+
+	/* The file time upper 32-bit
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_time_upper[ 4 ];
+
+	/* The file time lower 32-bit
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_time_lower[ 4 ];
+};
+
 #if defined( __cplusplus )
 }
 #endif
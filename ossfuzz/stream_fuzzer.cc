@@ -21,6 +21,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 /* Note that some of the OSS-Fuzz engines use C++
  */
@@ -43,12 +44,28 @@ int libwrc_stream_open_file_io_handle(
 
 #endif /* !defined( LIBWRC_HAVE_BFIO ) */
 
+/* The size of a resource node entry
+ * Shared nodes are not parsed again, hence without overlapping nodes
+ * every parsed node entry occupies 8 bytes of distinct data
+ */
+#define STREAM_FUZZER_NODE_ENTRY_SIZE		8
+
+/* The factor by which the number of parsed node entries may exceed
+ * the number of node entries that fit in the data, to allow for nodes
+ * that partially overlap
+ */
+#define STREAM_FUZZER_NODE_ENTRIES_FACTOR	8
+
 int LLVMFuzzerTestOneInput(
      const uint8_t *data,
      size_t size )
 {
+	libwrc_statistics_t statistics;
+
 	libbfio_handle_t *file_io_handle = NULL;
 	libwrc_stream_t *stream          = NULL;
+	uint64_t maximum_node_entries    = 0;
+	int result                       = 0;
 
 	if( libbfio_memory_range_initialize(
 	     &file_io_handle,
@@ -70,11 +87,28 @@ int LLVMFuzzerTestOneInput(
 	{
 		goto on_error_libbfio;
 	}
-	if( libwrc_stream_open_file_io_handle(
+	result = libwrc_stream_open_file_io_handle(
+	          stream,
+	          file_io_handle,
+	          LIBWRC_OPEN_READ,
+	          NULL );
+
+	/* Resource node trees with shared or cyclic references should not cause
+	 * the same node entries to be parsed repeatedly, also when opening fails
+	 */
+	if( libwrc_stream_get_statistics(
 	     stream,
-	     file_io_handle,
-	     LIBWRC_OPEN_READ,
-	     NULL ) != 1 )
+	     &statistics,
+	     NULL ) == 1 )
+	{
+		maximum_node_entries = 1 + ( ( (uint64_t) size / STREAM_FUZZER_NODE_ENTRY_SIZE ) * STREAM_FUZZER_NODE_ENTRIES_FACTOR );
+
+		if( statistics.number_of_node_entries > maximum_node_entries )
+		{
+			abort();
+		}
+	}
+	if( result != 1 )
 	{
 		goto on_error_libwrc;
 	}
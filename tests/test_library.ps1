@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "data_descriptor error io_handle language_entry language_table manifest_resource message_table_resource mui_resource mui_values notify resource resource_item resource_node_entry resource_node_header string_table_resource support table_entry version_information_resource version_values"
+$LibraryTests = "arena data_descriptor error io_handle language_entry language_table manifest_resource message_table_resource message_table_values mui_resource mui_values node_offset_table node_read_queue notify read_range resource resource_item resource_node_entry resource_node_header resource_table scaling string_table_resource support table_entry utf8_string version_information_resource version_string_table version_values"
 $LibraryTestsWithInput = "stream"
 $OptionSets = "virtual_address" -split " "
 
@@ -0,0 +1,2875 @@
+/*
+ * Library benchmark program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_functions.h"
+#include "wrc_test_generator.h"
+#include "wrc_test_getopt.h"
+#include "wrc_test_libbfio.h"
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+
+enum WRC_BENCH_FLAGS
+{
+	WRC_BENCH_FLAG_STREAM_OPEN		= 0x01,
+	WRC_BENCH_FLAG_TREE_WALK		= 0x02,
+	WRC_BENCH_FLAG_STRING_TABLE		= 0x04,
+	WRC_BENCH_FLAG_MESSAGE_TABLE		= 0x08,
+	WRC_BENCH_FLAG_VERSION			= 0x10,
+
+	WRC_BENCH_FLAG_ALL			= 0x1f
+};
+
+typedef struct wrc_bench_result wrc_bench_result_t;
+
+struct wrc_bench_result
+{
+	/* The number of operations
+	 */
+	uint64_t number_of_operations;
+
+	/* The number of bytes processed
+	 */
+	uint64_t number_of_bytes;
+
+	/* The elapsed time in nano seconds
+	 */
+	uint64_t elapsed_time;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The maximum allocated size
+	 */
+	uint64_t maximum_allocated_size;
+};
+
+typedef struct wrc_bench_buffers wrc_bench_buffers_t;
+
+struct wrc_bench_buffers
+{
+	/* The resource data
+	 */
+	uint8_t *resource_data;
+
+	/* The resource data size
+	 */
+	size_t resource_data_size;
+
+	/* The UTF-8 string
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string size
+	 */
+	size_t utf8_string_size;
+};
+
+/* Prints usage information
+ */
+void wrc_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use wrc_bench to measure the performance of libwrc.\n\n" );
+
+	fprintf( stream, "Usage: wrc_bench [ -b benchmark ] [ -g scale_factor ] [ -i iterations ]\n"
+	                 "                 [ -v virtual_address ] [ -fh ] [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: one or more resource (.rsrc) section files, required\n"
+	                 "\t        unless -g is used\n\n" );
+
+	fprintf( stream, "\t-b:     benchmark to run, options: all (default), open, walk,\n"
+	                 "\t        string_table, message_table, version\n" );
+	fprintf( stream, "\t-f:     open the source as a file instead of from memory\n" );
+	fprintf( stream, "\t-g:     benchmark a generated resource section, the scale factor\n"
+	                 "\t        multiplies the number of string tables, messages and\n"
+	                 "\t        named types\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations per benchmark, default is 10\n" );
+	fprintf( stream, "\t-v:     virtual address of the resource section, default is 0\n" );
+}
+
+/* Resizes a buffer if it is smaller than the requested size
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_buffer_resize(
+     uint8_t **buffer,
+     size_t *buffer_size,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_buffer = NULL;
+	static char *function       = "wrc_bench_buffer_resize";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size <= *buffer_size )
+	{
+		return( 1 );
+	}
+	reallocated_buffer = (uint8_t *) memory_reallocate(
+	                                  *buffer,
+	                                  sizeof( uint8_t ) * size );
+
+	if( reallocated_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer      = reallocated_buffer;
+	*buffer_size = size;
+
+	return( 1 );
+}
+
+/* Reads the data of the source into memory
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_read_source(
+     const system_character_t *source,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	uint8_t *safe_data               = NULL;
+	static char *function            = "wrc_bench_read_source";
+	size64_t file_size               = 0;
+	size_t source_length             = 0;
+	ssize_t read_count               = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	source_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     source,
+	     source_length + 1,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     source,
+	     source_length + 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * (size_t) file_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              safe_data,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	*data      = safe_data;
+	*data_size = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a stream
+ * The stream is opened from the data, or from the source if use_file is set
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_stream_open(
+     libwrc_stream_t **stream,
+     const system_character_t *source,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t virtual_address,
+     uint8_t use_file,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_bench_stream_open";
+	int result            = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_stream_initialize(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_stream_set_virtual_address(
+	     *stream,
+	     virtual_address,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set virtual address.",
+		 function );
+
+		goto on_error;
+	}
+	if( use_file != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libwrc_stream_open_wide(
+		          *stream,
+		          source,
+		          LIBWRC_OPEN_READ,
+		          error );
+#else
+		result = libwrc_stream_open(
+		          *stream,
+		          source,
+		          LIBWRC_OPEN_READ,
+		          error );
+#endif
+	}
+	else
+	{
+		result = libwrc_stream_open_memory(
+		          *stream,
+		          data,
+		          data_size,
+		          LIBWRC_OPEN_READ,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *stream != NULL )
+	{
+		libwrc_stream_free(
+		 stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a stream
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_stream_close(
+     libwrc_stream_t **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_bench_stream_close";
+	int result            = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_stream_close(
+	     *stream,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close stream.",
+		 function );
+
+		result = -1;
+	}
+	if( libwrc_stream_free(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Adds the allocation statistics of the stream to the benchmark result
+ * The number of allocations since the previous statistics are added
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_result_add_statistics(
+     wrc_bench_result_t *bench_result,
+     libwrc_statistics_t *previous_statistics,
+     libwrc_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libwrc_statistics_t statistics;
+
+	static char *function = "wrc_bench_result_add_statistics";
+
+	if( bench_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_stream_get_statistics(
+	     stream,
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	bench_result->number_of_allocations += statistics.number_of_allocations;
+
+	if( previous_statistics != NULL )
+	{
+		bench_result->number_of_allocations -= previous_statistics->number_of_allocations;
+	}
+	if( statistics.maximum_allocated_size > bench_result->maximum_allocated_size )
+	{
+		bench_result->maximum_allocated_size = statistics.maximum_allocated_size;
+	}
+	return( 1 );
+}
+
+/* Prints a benchmark result
+ */
+void wrc_bench_result_fprint(
+      FILE *stream,
+      const char *name,
+      wrc_bench_result_t *bench_result )
+{
+	uint64_t elapsed_time = 0;
+	uint64_t value_64bit  = 0;
+
+	if( ( stream == NULL )
+	 || ( name == NULL )
+	 || ( bench_result == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "%s:\n",
+	 name );
+
+	fprintf(
+	 stream,
+	 "\tnumber of operations\t: %" PRIu64 "\n",
+	 bench_result->number_of_operations );
+
+	if( bench_result->number_of_operations == 0 )
+	{
+		fprintf(
+		 stream,
+		 "\n" );
+
+		return;
+	}
+	/* Prevent a division by zero if the clock has a coarse resolution
+	 */
+	elapsed_time = bench_result->elapsed_time;
+
+	if( elapsed_time == 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf(
+	 stream,
+	 "\ttime\t\t\t: %" PRIu64 " ns/op\n",
+	 bench_result->elapsed_time / bench_result->number_of_operations );
+
+	if( bench_result->number_of_bytes > 0 )
+	{
+		/* Bytes per nano second * 10^9 / 10^6 with 2 decimals
+		 */
+		value_64bit = ( bench_result->number_of_bytes * 100000 ) / elapsed_time;
+
+		fprintf(
+		 stream,
+		 "\tthroughput\t\t: %" PRIu64 ".%02" PRIu64 " MB/s\n",
+		 value_64bit / 100,
+		 value_64bit % 100 );
+	}
+	value_64bit = ( bench_result->number_of_allocations * 100 ) / bench_result->number_of_operations;
+
+	fprintf(
+	 stream,
+	 "\tstream allocations\t: %" PRIu64 ".%02" PRIu64 " /op\n",
+	 value_64bit / 100,
+	 value_64bit % 100 );
+
+	fprintf(
+	 stream,
+	 "\tmaximum allocated size\t: %" PRIu64 " bytes\n",
+	 bench_result->maximum_allocated_size );
+
+	fprintf(
+	 stream,
+	 "\n" );
+}
+
+/* Benchmarks opening and closing a stream
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_run_stream_open(
+     const system_character_t *source,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t virtual_address,
+     uint8_t use_file,
+     int number_of_iterations,
+     wrc_bench_result_t *bench_result,
+     libcerror_error_t **error )
+{
+	libwrc_stream_t *stream = NULL;
+	static char *function   = "wrc_bench_run_stream_open";
+	uint64_t end_time       = 0;
+	uint64_t start_time     = 0;
+	int iteration           = 0;
+
+	if( bench_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench result.",
+		 function );
+
+		return( -1 );
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( wrc_test_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_bench_stream_open(
+		     &stream,
+		     source,
+		     data,
+		     data_size,
+		     virtual_address,
+		     use_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_test_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			goto on_error;
+		}
+		bench_result->elapsed_time         += end_time - start_time;
+		bench_result->number_of_operations += 1;
+		bench_result->number_of_bytes      += data_size;
+
+		if( wrc_bench_result_add_statistics(
+		     bench_result,
+		     NULL,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to add statistics.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_bench_stream_close(
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		wrc_bench_stream_close(
+		 &stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Walks a resource item and its sub items
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_walk_resource_item(
+     libwrc_resource_item_t *resource_item,
+     uint64_t *number_of_items,
+     libcerror_error_t **error )
+{
+	libwrc_resource_item_t *sub_resource_item = NULL;
+	static char *function                     = "wrc_bench_walk_resource_item";
+	size_t name_size                          = 0;
+	uint32_t identifier                       = 0;
+	uint32_t size                             = 0;
+	int number_of_sub_items                   = 0;
+	int sub_item_index                        = 0;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_resource_item_get_identifier(
+	     resource_item,
+	     &identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_resource_item_get_utf8_name_size(
+	     resource_item,
+	     &name_size,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_resource_item_get_number_of_sub_items(
+	     resource_item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_items += 1;
+
+	if( number_of_sub_items == 0 )
+	{
+		if( libwrc_resource_item_get_size(
+		     resource_item,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libwrc_resource_item_get_sub_item_by_index(
+		     resource_item,
+		     sub_item_index,
+		     &sub_resource_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( wrc_bench_walk_resource_item(
+		     sub_resource_item,
+		     number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to walk sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_item_free(
+		     &sub_resource_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_resource_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &sub_resource_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Walks all resources of a stream and their items
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_walk_stream(
+     libwrc_stream_t *stream,
+     uint64_t *number_of_items,
+     libcerror_error_t **error )
+{
+	libwrc_resource_t *resource           = NULL;
+	libwrc_resource_item_t *resource_item = NULL;
+	static char *function                 = "wrc_bench_walk_stream";
+	size_t name_size                      = 0;
+	uint32_t identifier                   = 0;
+	int item_index                        = 0;
+	int number_of_items_in_resource       = 0;
+	int number_of_resources               = 0;
+	int resource_index                    = 0;
+	int type                              = 0;
+
+	if( libwrc_stream_get_number_of_resources(
+	     stream,
+	     &number_of_resources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resources.",
+		 function );
+
+		goto on_error;
+	}
+	for( resource_index = 0;
+	     resource_index < number_of_resources;
+	     resource_index++ )
+	{
+		if( libwrc_stream_get_resource_by_index(
+		     stream,
+		     resource_index,
+		     &resource,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource: %d.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_get_identifier(
+		     resource,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource: %d identifier.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_get_type(
+		     resource,
+		     &type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource: %d type.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_get_utf8_name_size(
+		     resource,
+		     &name_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource: %d name size.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_get_number_of_items(
+		     resource,
+		     &number_of_items_in_resource,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource: %d number of items.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+		for( item_index = 0;
+		     item_index < number_of_items_in_resource;
+		     item_index++ )
+		{
+			if( libwrc_resource_get_item_by_index(
+			     resource,
+			     item_index,
+			     &resource_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve resource: %d item: %d.",
+				 function,
+				 resource_index,
+				 item_index );
+
+				goto on_error;
+			}
+			if( wrc_bench_walk_resource_item(
+			     resource_item,
+			     number_of_items,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to walk resource: %d item: %d.",
+				 function,
+				 resource_index,
+				 item_index );
+
+				goto on_error;
+			}
+			if( libwrc_resource_item_free(
+			     &resource_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free resource: %d item: %d.",
+				 function,
+				 resource_index,
+				 item_index );
+
+				goto on_error;
+			}
+		}
+		if( libwrc_resource_free(
+		     &resource,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free resource: %d.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( resource_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &resource_item,
+		 NULL );
+	}
+	if( resource != NULL )
+	{
+		libwrc_resource_free(
+		 &resource,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes a string table resource and converts its strings to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_decode_string_table(
+     wrc_bench_buffers_t *buffers,
+     size_t resource_data_size,
+     uint32_t identifier,
+     libcerror_error_t **error )
+{
+	libwrc_string_table_resource_t *string_table_resource = NULL;
+	static char *function                                 = "wrc_bench_decode_string_table";
+	size_t utf8_string_size                               = 0;
+	int number_of_strings                                 = 0;
+	int string_index                                      = 0;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_string_table_resource_initialize(
+	     &string_table_resource,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize string table resource.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_string_table_resource_read(
+	     string_table_resource,
+	     buffers->resource_data,
+	     resource_data_size,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string table resource.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_string_table_resource_get_number_of_strings(
+	     string_table_resource,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( libwrc_string_table_resource_get_utf8_string_size(
+		     string_table_resource,
+		     string_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d size.",
+			 function,
+			 string_index );
+
+			goto on_error;
+		}
+		if( utf8_string_size == 0 )
+		{
+			continue;
+		}
+		if( wrc_bench_buffer_resize(
+		     &( buffers->utf8_string ),
+		     &( buffers->utf8_string_size ),
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_string_table_resource_get_utf8_string(
+		     string_table_resource,
+		     string_index,
+		     buffers->utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 string_index );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_string_table_resource_free(
+	     &string_table_resource,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free string table resource.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( string_table_resource != NULL )
+	{
+		libwrc_string_table_resource_free(
+		 &string_table_resource,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes a message table resource and converts its messages to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_decode_message_table(
+     wrc_bench_buffers_t *buffers,
+     size_t resource_data_size,
+     libcerror_error_t **error )
+{
+	libwrc_message_table_resource_t *message_table_resource = NULL;
+	static char *function                                   = "wrc_bench_decode_message_table";
+	size_t utf8_string_size                                 = 0;
+	int message_index                                       = 0;
+	int number_of_messages                                  = 0;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_message_table_resource_initialize(
+	     &message_table_resource,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize message table resource.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_message_table_resource_read(
+	     message_table_resource,
+	     buffers->resource_data,
+	     resource_data_size,
+	     LIBWRC_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message table resource.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_message_table_resource_get_number_of_messages(
+	     message_table_resource,
+	     &number_of_messages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of messages.",
+		 function );
+
+		goto on_error;
+	}
+	for( message_index = 0;
+	     message_index < number_of_messages;
+	     message_index++ )
+	{
+		if( libwrc_message_table_resource_get_utf8_string_size(
+		     message_table_resource,
+		     message_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message: %d size.",
+			 function,
+			 message_index );
+
+			goto on_error;
+		}
+		if( utf8_string_size == 0 )
+		{
+			continue;
+		}
+		if( wrc_bench_buffer_resize(
+		     &( buffers->utf8_string ),
+		     &( buffers->utf8_string_size ),
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_message_table_resource_get_utf8_string(
+		     message_table_resource,
+		     message_index,
+		     buffers->utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message: %d.",
+			 function,
+			 message_index );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_message_table_resource_free(
+	     &message_table_resource,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free message table resource.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( message_table_resource != NULL )
+	{
+		libwrc_message_table_resource_free(
+		 &message_table_resource,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes a version information resource and extracts the versions and file version string
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_decode_version(
+     wrc_bench_buffers_t *buffers,
+     size_t resource_data_size,
+     libcerror_error_t **error )
+{
+	libwrc_version_information_resource_t *version_information_resource = NULL;
+	static char *function                                               = "wrc_bench_decode_version";
+	size_t utf8_string_size                                             = 0;
+	uint64_t file_version                                               = 0;
+	uint64_t product_version                                            = 0;
+	int number_of_string_tables                                         = 0;
+	int result                                                          = 0;
+	int string_table_index                                              = 0;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_version_information_resource_initialize(
+	     &version_information_resource,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize version information resource.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_version_information_resource_read(
+	     version_information_resource,
+	     buffers->resource_data,
+	     resource_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read version information resource.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_version_information_resource_get_file_version(
+	     version_information_resource,
+	     &file_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_version_information_resource_get_product_version(
+	     version_information_resource,
+	     &product_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve product version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwrc_version_information_resource_get_number_of_string_tables(
+	     version_information_resource,
+	     &number_of_string_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of string tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( string_table_index = 0;
+	     string_table_index < number_of_string_tables;
+	     string_table_index++ )
+	{
+		result = libwrc_version_information_resource_get_utf8_string_size_by_key(
+		          version_information_resource,
+		          string_table_index,
+		          (uint8_t *) "FileVersion",
+		          11,
+		          &utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string table: %d file version string size.",
+			 function,
+			 string_table_index );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( utf8_string_size == 0 ) )
+		{
+			continue;
+		}
+		if( wrc_bench_buffer_resize(
+		     &( buffers->utf8_string ),
+		     &( buffers->utf8_string_size ),
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_version_information_resource_get_utf8_string_by_key(
+		     version_information_resource,
+		     string_table_index,
+		     (uint8_t *) "FileVersion",
+		     11,
+		     buffers->utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string table: %d file version string.",
+			 function,
+			 string_table_index );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_version_information_resource_free(
+	     &version_information_resource,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free version information resource.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( version_information_resource != NULL )
+	{
+		libwrc_version_information_resource_free(
+		 &version_information_resource,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads and decodes a resource sub item
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_decode_resource_sub_item(
+     wrc_bench_buffers_t *buffers,
+     uint32_t resource_identifier,
+     uint32_t identifier,
+     libwrc_resource_item_t *resource_sub_item,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function       = "wrc_bench_decode_resource_sub_item";
+	ssize_t read_count          = 0;
+	uint32_t resource_data_size = 0;
+	int result                  = 0;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_resource_item_get_size(
+	     resource_sub_item,
+	     &resource_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource item size.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( wrc_bench_buffer_resize(
+	     &( buffers->resource_data ),
+	     &( buffers->resource_data_size ),
+	     (size_t) resource_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize resource data.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libwrc_resource_item_read_buffer_at_offset(
+	              resource_sub_item,
+	              buffers->resource_data,
+	              (size_t) resource_data_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) resource_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resource data.",
+		 function );
+
+		return( -1 );
+	}
+	switch( resource_identifier )
+	{
+		case LIBWRC_RESOURCE_IDENTIFIER_STRING_TABLE:
+			result = wrc_bench_decode_string_table(
+			          buffers,
+			          (size_t) resource_data_size,
+			          identifier,
+			          error );
+			break;
+
+		case LIBWRC_RESOURCE_IDENTIFIER_MESSAGE_TABLE:
+			result = wrc_bench_decode_message_table(
+			          buffers,
+			          (size_t) resource_data_size,
+			          error );
+			break;
+
+		case LIBWRC_RESOURCE_IDENTIFIER_VERSION_INFORMATION:
+			result = wrc_bench_decode_version(
+			          buffers,
+			          (size_t) resource_data_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported resource identifier: 0x%08" PRIx32 ".",
+			 function,
+			 resource_identifier );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode resource data.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bytes += resource_data_size;
+
+	return( 1 );
+}
+
+/* Reads and decodes all the items of a specific resource
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_decode_resource(
+     wrc_bench_buffers_t *buffers,
+     libwrc_stream_t *stream,
+     uint32_t resource_identifier,
+     uint64_t *number_of_resources,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	libwrc_resource_t *resource               = NULL;
+	libwrc_resource_item_t *resource_item     = NULL;
+	libwrc_resource_item_t *resource_sub_item = NULL;
+	static char *function                     = "wrc_bench_decode_resource";
+	uint32_t identifier                       = 0;
+	int number_of_items                       = 0;
+	int number_of_sub_items                   = 0;
+	int item_index                            = 0;
+	int result                                = 0;
+	int sub_item_index                        = 0;
+
+	if( number_of_resources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of resources.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwrc_stream_get_resource_by_identifier(
+	          stream,
+	          resource_identifier,
+	          &resource,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( libwrc_resource_get_number_of_items(
+	     resource,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resource items.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libwrc_resource_get_item_by_index(
+		     resource,
+		     item_index,
+		     &resource_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_item_get_identifier(
+		     resource_item,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource item: %d identifier.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_item_get_number_of_sub_items(
+		     resource_item,
+		     &number_of_sub_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource item: %d number of sub items.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		for( sub_item_index = 0;
+		     sub_item_index < number_of_sub_items;
+		     sub_item_index++ )
+		{
+			if( libwrc_resource_item_get_sub_item_by_index(
+			     resource_item,
+			     sub_item_index,
+			     &resource_sub_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve resource item: %d sub item: %d.",
+				 function,
+				 item_index,
+				 sub_item_index );
+
+				goto on_error;
+			}
+			if( wrc_bench_decode_resource_sub_item(
+			     buffers,
+			     resource_identifier,
+			     identifier,
+			     resource_sub_item,
+			     number_of_bytes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to decode resource item: %d sub item: %d.",
+				 function,
+				 item_index,
+				 sub_item_index );
+
+				goto on_error;
+			}
+			*number_of_resources += 1;
+
+			if( libwrc_resource_item_free(
+			     &resource_sub_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free resource item: %d sub item: %d.",
+				 function,
+				 item_index,
+				 sub_item_index );
+
+				goto on_error;
+			}
+		}
+		if( libwrc_resource_item_free(
+		     &resource_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free resource item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_resource_free(
+	     &resource,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( resource_sub_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &resource_sub_item,
+		 NULL );
+	}
+	if( resource_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &resource_item,
+		 NULL );
+	}
+	if( resource != NULL )
+	{
+		libwrc_resource_free(
+		 &resource,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks an operation on an open stream
+ * A resource identifier of 0 walks the full resource tree, otherwise
+ * the resources of the specific type are read and decoded
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_run_stream_operation(
+     wrc_bench_buffers_t *buffers,
+     libwrc_stream_t *stream,
+     uint32_t resource_identifier,
+     int number_of_iterations,
+     wrc_bench_result_t *bench_result,
+     libcerror_error_t **error )
+{
+	libwrc_statistics_t statistics;
+
+	static char *function    = "wrc_bench_run_stream_operation";
+	uint64_t end_time        = 0;
+	uint64_t number_of_bytes = 0;
+	uint64_t number_of_items = 0;
+	uint64_t start_time      = 0;
+	int iteration            = 0;
+	int result               = 0;
+
+	if( bench_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_stream_get_statistics(
+	     stream,
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		number_of_bytes = 0;
+		number_of_items = 0;
+
+		if( wrc_test_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			return( -1 );
+		}
+		if( resource_identifier == 0 )
+		{
+			result = wrc_bench_walk_stream(
+			          stream,
+			          &number_of_items,
+			          error );
+		}
+		else
+		{
+			result = wrc_bench_decode_resource(
+			          buffers,
+			          stream,
+			          resource_identifier,
+			          &number_of_items,
+			          &number_of_bytes,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run operation.",
+			 function );
+
+			return( -1 );
+		}
+		if( wrc_test_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		bench_result->elapsed_time    += end_time - start_time;
+		bench_result->number_of_bytes += number_of_bytes;
+
+		/* A tree walk is a single operation, decoding counts every resource as an operation
+		 */
+		if( resource_identifier == 0 )
+		{
+			bench_result->number_of_operations += 1;
+		}
+		else
+		{
+			bench_result->number_of_operations += number_of_items;
+		}
+	}
+	if( wrc_bench_result_add_statistics(
+	     bench_result,
+	     &statistics,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to add statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Runs the benchmarks on a specific source
+ * If the scale factor is non-zero a generated resource section is used instead of the source
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_bench_run(
+     const system_character_t *source,
+     int scale_factor,
+     uint32_t virtual_address,
+     uint8_t use_file,
+     int benchmark_flags,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	wrc_bench_buffers_t buffers;
+	wrc_bench_result_t bench_result;
+	wrc_test_generator_parameters_t generator_parameters;
+
+	libwrc_stream_t *stream = NULL;
+	uint8_t *data           = NULL;
+	static char *function   = "wrc_bench_run";
+	size_t data_size        = 0;
+
+	if( memory_set(
+	     &buffers,
+	     0,
+	     sizeof( wrc_bench_buffers_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( scale_factor != 0 )
+	{
+		if( wrc_test_generator_parameters_set_defaults(
+		     &generator_parameters,
+		     scale_factor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set generator parameters.",
+			 function );
+
+			goto on_error;
+		}
+		generator_parameters.virtual_address = virtual_address;
+
+		if( wrc_test_generate_resource_section(
+		     &generator_parameters,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to generate resource section.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Source: generated with scale factor: %d (%" PRIzd " bytes)\n\n",
+		 scale_factor,
+		 data_size );
+	}
+	else
+	{
+		if( wrc_bench_read_source(
+		     source,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Source: %" PRIs_SYSTEM " (%" PRIzd " bytes)\n\n",
+		 source,
+		 data_size );
+	}
+
+	if( ( benchmark_flags & WRC_BENCH_FLAG_STREAM_OPEN ) != 0 )
+	{
+		if( memory_set(
+		     &bench_result,
+		     0,
+		     sizeof( wrc_bench_result_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear bench result.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_bench_run_stream_open(
+		     source,
+		     data,
+		     data_size,
+		     virtual_address,
+		     use_file,
+		     number_of_iterations,
+		     &bench_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run stream open benchmark.",
+			 function );
+
+			goto on_error;
+		}
+		wrc_bench_result_fprint(
+		 stdout,
+		 "stream open",
+		 &bench_result );
+	}
+	if( ( benchmark_flags & ~WRC_BENCH_FLAG_STREAM_OPEN ) != 0 )
+	{
+		if( wrc_bench_stream_open(
+		     &stream,
+		     source,
+		     data,
+		     data_size,
+		     virtual_address,
+		     use_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( benchmark_flags & WRC_BENCH_FLAG_TREE_WALK ) != 0 )
+	{
+		if( memory_set(
+		     &bench_result,
+		     0,
+		     sizeof( wrc_bench_result_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear bench result.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_bench_run_stream_operation(
+		     &buffers,
+		     stream,
+		     0,
+		     number_of_iterations,
+		     &bench_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run tree walk benchmark.",
+			 function );
+
+			goto on_error;
+		}
+		wrc_bench_result_fprint(
+		 stdout,
+		 "tree walk",
+		 &bench_result );
+	}
+	if( ( benchmark_flags & WRC_BENCH_FLAG_STRING_TABLE ) != 0 )
+	{
+		if( memory_set(
+		     &bench_result,
+		     0,
+		     sizeof( wrc_bench_result_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear bench result.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_bench_run_stream_operation(
+		     &buffers,
+		     stream,
+		     LIBWRC_RESOURCE_IDENTIFIER_STRING_TABLE,
+		     number_of_iterations,
+		     &bench_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run string table benchmark.",
+			 function );
+
+			goto on_error;
+		}
+		wrc_bench_result_fprint(
+		 stdout,
+		 "string table decode and UTF-8 conversion",
+		 &bench_result );
+	}
+	if( ( benchmark_flags & WRC_BENCH_FLAG_MESSAGE_TABLE ) != 0 )
+	{
+		if( memory_set(
+		     &bench_result,
+		     0,
+		     sizeof( wrc_bench_result_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear bench result.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_bench_run_stream_operation(
+		     &buffers,
+		     stream,
+		     LIBWRC_RESOURCE_IDENTIFIER_MESSAGE_TABLE,
+		     number_of_iterations,
+		     &bench_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run message table benchmark.",
+			 function );
+
+			goto on_error;
+		}
+		wrc_bench_result_fprint(
+		 stdout,
+		 "message table decode and UTF-8 conversion",
+		 &bench_result );
+	}
+	if( ( benchmark_flags & WRC_BENCH_FLAG_VERSION ) != 0 )
+	{
+		if( memory_set(
+		     &bench_result,
+		     0,
+		     sizeof( wrc_bench_result_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear bench result.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_bench_run_stream_operation(
+		     &buffers,
+		     stream,
+		     LIBWRC_RESOURCE_IDENTIFIER_VERSION_INFORMATION,
+		     number_of_iterations,
+		     &bench_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run version benchmark.",
+			 function );
+
+			goto on_error;
+		}
+		wrc_bench_result_fprint(
+		 stdout,
+		 "version extraction",
+		 &bench_result );
+	}
+	if( stream != NULL )
+	{
+		if( wrc_bench_stream_close(
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( buffers.utf8_string != NULL )
+	{
+		memory_free(
+		 buffers.utf8_string );
+	}
+	if( buffers.resource_data != NULL )
+	{
+		memory_free(
+		 buffers.resource_data );
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		wrc_bench_stream_close(
+		 &stream,
+		 NULL );
+	}
+	if( buffers.utf8_string != NULL )
+	{
+		memory_free(
+		 buffers.utf8_string );
+	}
+	if( buffers.resource_data != NULL )
+	{
+		memory_free(
+		 buffers.resource_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Determines the benchmark flags from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int wrc_bench_get_benchmark_flags(
+     const system_character_t *string,
+     int *benchmark_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_bench_get_benchmark_flags";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( benchmark_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark flags.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "all" ),
+		     3 ) == 0 )
+		{
+			*benchmark_flags = WRC_BENCH_FLAG_ALL;
+			result           = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "open" ),
+		     4 ) == 0 )
+		{
+			*benchmark_flags = WRC_BENCH_FLAG_STREAM_OPEN;
+			result           = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "walk" ),
+		          4 ) == 0 )
+		{
+			*benchmark_flags = WRC_BENCH_FLAG_TREE_WALK;
+			result           = 1;
+		}
+	}
+	else if( string_length == 7 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "version" ),
+		     7 ) == 0 )
+		{
+			*benchmark_flags = WRC_BENCH_FLAG_VERSION;
+			result           = 1;
+		}
+	}
+	else if( string_length == 12 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "string_table" ),
+		     12 ) == 0 )
+		{
+			*benchmark_flags = WRC_BENCH_FLAG_STRING_TABLE;
+			result           = 1;
+		}
+	}
+	else if( string_length == 13 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "message_table" ),
+		     13 ) == 0 )
+		{
+			*benchmark_flags = WRC_BENCH_FLAG_MESSAGE_TABLE;
+			result           = 1;
+		}
+	}
+	return( result );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                   = NULL;
+	system_character_t *option_benchmark       = NULL;
+	system_character_t *option_iterations      = NULL;
+	system_character_t *option_scale_factor    = NULL;
+	system_character_t *option_virtual_address = NULL;
+	system_integer_t option                    = 0;
+	size_t string_length                       = 0;
+	uint64_t value_64bit                       = 0;
+	uint32_t virtual_address                   = 0;
+	uint8_t use_file                           = 0;
+	int benchmark_flags                        = WRC_BENCH_FLAG_ALL;
+	int number_of_iterations                   = 10;
+	int result                                 = 0;
+	int scale_factor                           = 0;
+
+	while( ( option = wrc_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:fg:hi:v:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				wrc_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_benchmark = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				use_file = 1;
+
+				break;
+
+			case (system_integer_t) 'g':
+				option_scale_factor = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				wrc_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				option_virtual_address = optarg;
+
+				break;
+		}
+	}
+	if( ( option_scale_factor == NULL )
+	 && ( optind >= argc ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		wrc_bench_usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_benchmark != NULL )
+	{
+		result = wrc_bench_get_benchmark_flags(
+		          option_benchmark,
+		          &benchmark_flags,
+		          &error );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported benchmark: %" PRIs_SYSTEM ".\n",
+			 option_benchmark );
+
+			goto on_error;
+		}
+	}
+	if( option_iterations != NULL )
+	{
+		string_length = system_string_length(
+		                 option_iterations );
+
+		if( wrc_test_system_string_copy_from_64_bit_in_decimal(
+		     option_iterations,
+		     string_length + 1,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations: %" PRIs_SYSTEM ".\n",
+			 option_iterations );
+
+			goto on_error;
+		}
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Number of iterations value out of bounds.\n" );
+
+			goto on_error;
+		}
+		number_of_iterations = (int) value_64bit;
+	}
+	if( option_virtual_address != NULL )
+	{
+		string_length = system_string_length(
+		                 option_virtual_address );
+
+		if( wrc_test_system_string_copy_from_64_bit_in_decimal(
+		     option_virtual_address,
+		     string_length + 1,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported virtual address: %" PRIs_SYSTEM ".\n",
+			 option_virtual_address );
+
+			goto on_error;
+		}
+		if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Virtual address value out of bounds.\n" );
+
+			goto on_error;
+		}
+		virtual_address = (uint32_t) value_64bit;
+	}
+	if( option_scale_factor != NULL )
+	{
+		if( use_file != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Generated resource section cannot be opened as a file.\n" );
+
+			goto on_error;
+		}
+		string_length = system_string_length(
+		                 option_scale_factor );
+
+		if( wrc_test_system_string_copy_from_64_bit_in_decimal(
+		     option_scale_factor,
+		     string_length + 1,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported scale factor: %" PRIs_SYSTEM ".\n",
+			 option_scale_factor );
+
+			goto on_error;
+		}
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > 1024 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Scale factor value out of bounds.\n" );
+
+			goto on_error;
+		}
+		scale_factor = (int) value_64bit;
+
+		if( wrc_bench_run(
+		     NULL,
+		     scale_factor,
+		     virtual_address,
+		     use_file,
+		     benchmark_flags,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmarks on generated resource section.\n" );
+
+			goto on_error;
+		}
+	}
+	while( optind < argc )
+	{
+		if( wrc_bench_run(
+		     argv[ optind ],
+		     0,
+		     virtual_address,
+		     use_file,
+		     benchmark_flags,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmarks on: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			goto on_error;
+		}
+		optind++;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
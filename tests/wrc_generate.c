@@ -0,0 +1,588 @@
+/*
+ * Synthetic resource section generator program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_functions.h"
+#include "wrc_test_generator.h"
+#include "wrc_test_getopt.h"
+#include "wrc_test_libbfio.h"
+#include "wrc_test_libcerror.h"
+
+/* Prints usage information
+ */
+void wrc_generate_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use wrc_generate to generate a synthetic resource (.rsrc) section.\n\n" );
+
+	fprintf( stream, "Usage: wrc_generate [ -d depth ] [ -g scale_factor ] [ -l languages ]\n"
+	                 "                    [ -m messages ] [ -n named_types ] [ -s string_tables ]\n"
+	                 "                    [ -v virtual_address ] [ -w width ] [ -hx ] target\n\n" );
+
+	fprintf( stream, "\ttarget: the resource (.rsrc) section file to write\n\n" );
+
+	fprintf( stream, "\t-d:     depth of a nested resource tree, default is 0 (none), the maximum\n"
+	                 "\t        is %d\n", WRC_TEST_GENERATOR_MAXIMUM_TREE_DEPTH );
+	fprintf( stream, "\t-g:     scale factor of the default number of string tables, messages\n"
+	                 "\t        and named types, default is 1\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-l:     number of languages, default is 2\n" );
+	fprintf( stream, "\t-m:     number of messages, default is 256 times the scale factor\n" );
+	fprintf( stream, "\t-n:     number of named types, default is 16 times the scale factor\n" );
+	fprintf( stream, "\t-s:     number of string table blocks, default is 64 times the scale\n"
+	                 "\t        factor\n" );
+	fprintf( stream, "\t-v:     virtual address of the resource section, default is 0\n" );
+	fprintf( stream, "\t-w:     number of entries per nested resource tree node, default is 1,\n"
+	                 "\t        all entries of a node reference the same sub node\n" );
+	fprintf( stream, "\t-x:     do not generate version information\n" );
+}
+
+/* Determines an integer value from a string
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_generate_get_integer_value(
+     const system_character_t *string,
+     uint64_t maximum_value,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_generate_get_integer_value";
+	size_t string_length  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( wrc_test_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_64bit > maximum_value )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data to a target file
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_generate_write_target(
+     const system_character_t *target,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "wrc_generate_write_target";
+	size_t target_length             = 0;
+	ssize_t write_count              = 0;
+
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	target_length = system_string_length(
+	                 target );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     target,
+	     target_length + 1,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     target,
+	     target_length + 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	wrc_test_generator_parameters_t parameters;
+
+	libcerror_error_t *error                   = NULL;
+	system_character_t *option_depth           = NULL;
+	system_character_t *option_languages       = NULL;
+	system_character_t *option_messages        = NULL;
+	system_character_t *option_named_types     = NULL;
+	system_character_t *option_scale_factor    = NULL;
+	system_character_t *option_string_tables   = NULL;
+	system_character_t *option_virtual_address = NULL;
+	system_character_t *option_width           = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_size                           = 0;
+	system_integer_t option                    = 0;
+	uint64_t value_64bit                       = 0;
+	uint8_t has_version_information            = 1;
+	int scale_factor                           = 1;
+
+	while( ( option = wrc_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "d:g:hl:m:n:s:v:w:x" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				wrc_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'd':
+				option_depth = optarg;
+
+				break;
+
+			case (system_integer_t) 'g':
+				option_scale_factor = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				wrc_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'l':
+				option_languages = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_messages = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_named_types = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_string_tables = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				option_virtual_address = optarg;
+
+				break;
+
+			case (system_integer_t) 'w':
+				option_width = optarg;
+
+				break;
+
+			case (system_integer_t) 'x':
+				has_version_information = 0;
+
+				break;
+		}
+	}
+	if( optind >= argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		wrc_generate_usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_scale_factor != NULL )
+	{
+		if( ( wrc_generate_get_integer_value(
+		       option_scale_factor,
+		       1024,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit == 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported scale factor: %" PRIs_SYSTEM ".\n",
+			 option_scale_factor );
+
+			goto on_error;
+		}
+		scale_factor = (int) value_64bit;
+	}
+	if( wrc_test_generator_parameters_set_defaults(
+	     &parameters,
+	     scale_factor,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set default parameters.\n" );
+
+		goto on_error;
+	}
+	parameters.has_version_information = has_version_information;
+
+	if( option_depth != NULL )
+	{
+		if( wrc_generate_get_integer_value(
+		     option_depth,
+		     WRC_TEST_GENERATOR_MAXIMUM_TREE_DEPTH,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported depth: %" PRIs_SYSTEM ".\n",
+			 option_depth );
+
+			goto on_error;
+		}
+		parameters.tree_depth = (int) value_64bit;
+	}
+	if( option_languages != NULL )
+	{
+		if( ( wrc_generate_get_integer_value(
+		       option_languages,
+		       UINT16_MAX,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit == 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of languages: %" PRIs_SYSTEM ".\n",
+			 option_languages );
+
+			goto on_error;
+		}
+		parameters.number_of_languages = (int) value_64bit;
+	}
+	if( option_messages != NULL )
+	{
+		if( wrc_generate_get_integer_value(
+		     option_messages,
+		     INT_MAX,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of messages: %" PRIs_SYSTEM ".\n",
+			 option_messages );
+
+			goto on_error;
+		}
+		parameters.number_of_messages = (int) value_64bit;
+	}
+	if( option_named_types != NULL )
+	{
+		if( wrc_generate_get_integer_value(
+		     option_named_types,
+		     99999,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of named types: %" PRIs_SYSTEM ".\n",
+			 option_named_types );
+
+			goto on_error;
+		}
+		parameters.number_of_named_types = (int) value_64bit;
+	}
+	if( option_string_tables != NULL )
+	{
+		if( wrc_generate_get_integer_value(
+		     option_string_tables,
+		     UINT16_MAX,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of string tables: %" PRIs_SYSTEM ".\n",
+			 option_string_tables );
+
+			goto on_error;
+		}
+		parameters.number_of_string_tables = (int) value_64bit;
+	}
+	if( option_virtual_address != NULL )
+	{
+		if( wrc_generate_get_integer_value(
+		     option_virtual_address,
+		     UINT32_MAX,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported virtual address: %" PRIs_SYSTEM ".\n",
+			 option_virtual_address );
+
+			goto on_error;
+		}
+		parameters.virtual_address = (uint32_t) value_64bit;
+	}
+	if( option_width != NULL )
+	{
+		if( ( wrc_generate_get_integer_value(
+		       option_width,
+		       UINT16_MAX,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit == 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported width: %" PRIs_SYSTEM ".\n",
+			 option_width );
+
+			goto on_error;
+		}
+		parameters.tree_width = (int) value_64bit;
+	}
+	if( wrc_test_generate_resource_section(
+	     &parameters,
+	     &data,
+	     &data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate resource section.\n" );
+
+		goto on_error;
+	}
+	if( wrc_generate_write_target(
+	     argv[ optind ],
+	     data,
+	     data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write target: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Generated resource section of %" PRIzd " bytes.\n",
+	 data_size );
+
+	memory_free(
+	 data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,709 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+#include "../libwrc/libwrc_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+/* Tests the libwrc_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libwrc_arena_t *arena    = NULL;
+	int result               = 0;
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwrc_arena_initialize(
+	          &arena,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_arena_free(
+	          &arena,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_arena_initialize(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libwrc_arena_t *) 0x12345678UL;
+
+	result = libwrc_arena_initialize(
+	          &arena,
+	          &error );
+
+	arena = NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_arena_initialize with malloc failing
+		 */
+		wrc_test_malloc_attempts_before_fail = test_number;
+
+		result = libwrc_arena_initialize(
+		          &arena,
+		          &error );
+
+		if( wrc_test_malloc_attempts_before_fail != -1 )
+		{
+			wrc_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libwrc_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_arena_initialize with memset failing
+		 */
+		wrc_test_memset_attempts_before_fail = test_number;
+
+		result = libwrc_arena_initialize(
+		          &arena,
+		          &error );
+
+		if( wrc_test_memset_attempts_before_fail != -1 )
+		{
+			wrc_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libwrc_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WRC_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libwrc_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwrc_arena_free(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libwrc_arena_t *arena    = NULL;
+	uint8_t *data            = NULL;
+	uint8_t *previous_data   = NULL;
+	int allocation_index     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_arena_initialize(
+	          &arena,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_arena_allocate(
+	          arena,
+	          3,
+	          (void **) &previous_data,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "previous_data",
+	 previous_data );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "previous_data[ 0 ]",
+	 (int) previous_data[ 0 ],
+	 0 );
+
+	result = libwrc_arena_allocate(
+	          arena,
+	          16,
+	          (void **) &data,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The allocated memory is aligned
+	 */
+	WRC_TEST_ASSERT_EQUAL_INTPTR(
+	 "data",
+	 (intptr_t) data,
+	 (intptr_t) &( previous_data[ LIBWRC_ARENA_ALIGNMENT ] ) );
+
+	/* Test allocations that exceed the block size
+	 */
+	for( allocation_index = 0;
+	     allocation_index < 64;
+	     allocation_index++ )
+	{
+		result = libwrc_arena_allocate(
+		          arena,
+		          1000,
+		          (void **) &data,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwrc_arena_allocate(
+	          arena,
+	          LIBWRC_ARENA_MAXIMUM_BLOCK_SIZE + 1,
+	          (void **) &data,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ LIBWRC_ARENA_MAXIMUM_BLOCK_SIZE ] = 0xff;
+
+	/* Test error cases
+	 */
+	result = libwrc_arena_allocate(
+	          NULL,
+	          16,
+	          (void **) &data,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_arena_allocate(
+	          arena,
+	          0,
+	          (void **) &data,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_arena_allocate(
+	          arena,
+	          (size_t) SSIZE_MAX + 1,
+	          (void **) &data,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_arena_allocate(
+	          arena,
+	          16,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_arena_free(
+	          &arena,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libwrc_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_arena_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_arena_reset(
+     void )
+{
+	uint8_t *first_data[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	libwrc_arena_t *arena    = NULL;
+	uint8_t *data            = NULL;
+	size64_t allocated_size  = 0;
+	int allocation_index     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_arena_initialize(
+	          &arena,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( allocation_index = 0;
+	     allocation_index < 32;
+	     allocation_index++ )
+	{
+		result = libwrc_arena_allocate(
+		          arena,
+		          1000,
+		          (void **) &( first_data[ allocation_index ] ),
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		first_data[ allocation_index ][ 0 ] = 0xff;
+	}
+	allocated_size = arena->allocated_size;
+
+	/* Test regular cases
+	 */
+	result = libwrc_arena_reset(
+	          arena,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The same allocations after a reset reuse the blocks
+	 */
+	for( allocation_index = 0;
+	     allocation_index < 32;
+	     allocation_index++ )
+	{
+		result = libwrc_arena_allocate(
+		          arena,
+		          1000,
+		          (void **) &data,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WRC_TEST_ASSERT_EQUAL_INTPTR(
+		 "data",
+		 (intptr_t) data,
+		 (intptr_t) first_data[ allocation_index ] );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "data[ 0 ]",
+		 (int) data[ 0 ],
+		 0 );
+	}
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "allocated_size",
+	 (uint64_t) arena->allocated_size,
+	 (uint64_t) allocated_size );
+
+	/* Test error cases
+	 */
+	result = libwrc_arena_reset(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_arena_free(
+	          &arena,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libwrc_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+	WRC_TEST_RUN(
+	 "libwrc_arena_initialize",
+	 wrc_test_arena_initialize );
+
+	WRC_TEST_RUN(
+	 "libwrc_arena_free",
+	 wrc_test_arena_free );
+
+	WRC_TEST_RUN(
+	 "libwrc_arena_allocate",
+	 wrc_test_arena_allocate );
+
+	WRC_TEST_RUN(
+	 "libwrc_arena_reset",
+	 wrc_test_arena_reset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+}
+
@@ -64,6 +64,10 @@ int wrc_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int wrc_test_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,2137 @@
+/*
+ * Synthetic resource section generator for testing
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "wrc_test_generator.h"
+#include "wrc_test_libcerror.h"
+
+/* The resource type identifiers used by the generator
+ */
+#define WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_NAMED		0x00
+#define WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_STRING_TABLE	0x06
+#define WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_RAW_DATA		0x0a
+#define WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_MESSAGE_TABLE	0x0b
+#define WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_VERSION		0x10
+
+/* The number of messages per message table block
+ */
+#define WRC_TEST_GENERATOR_MESSAGES_PER_BLOCK			64
+
+/* Common language identifiers in ascending order, used for the first languages
+ */
+static uint16_t wrc_test_generator_language_identifiers[ 24 ] = {
+	0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040b, 0x040c,
+	0x040e, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416,
+	0x0418, 0x0419, 0x041b, 0x041d, 0x041f, 0x0804, 0x0816, 0x0c0a };
+
+/* Sets the default parameters
+ * The number of string tables, messages and named types are multiplied by the scale factor
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_parameters_set_defaults(
+     wrc_test_generator_parameters_t *parameters,
+     int scale_factor,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_parameters_set_defaults";
+
+	if( parameters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parameters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scale_factor <= 0 )
+	 || ( scale_factor > 1024 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scale factor value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	parameters->virtual_address         = 0;
+	parameters->number_of_string_tables = 64 * scale_factor;
+	parameters->number_of_messages      = 256 * scale_factor;
+	parameters->number_of_named_types   = 16 * scale_factor;
+	parameters->number_of_languages     = 2;
+	parameters->has_version_information = 1;
+	parameters->tree_depth              = 0;
+	parameters->tree_width              = 1;
+
+	return( 1 );
+}
+
+/* Appends data to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_buffer_append(
+     wrc_test_generator_buffer_t *buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_data = NULL;
+	static char *function     = "wrc_test_generator_buffer_append";
+	size_t allocated_size     = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - buffer->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer->data_size + data_size ) > buffer->allocated_size )
+	{
+		/* Grow the buffer exponentially so appending is amortized linear
+		 */
+		allocated_size = buffer->allocated_size * 2;
+
+		if( allocated_size < 4096 )
+		{
+			allocated_size = 4096;
+		}
+		if( allocated_size < ( buffer->data_size + data_size ) )
+		{
+			allocated_size = buffer->data_size + data_size;
+		}
+		if( allocated_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			allocated_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+		}
+		reallocated_data = (uint8_t *) memory_reallocate(
+		                                buffer->data,
+		                                sizeof( uint8_t ) * allocated_size );
+
+		if( reallocated_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data           = reallocated_data;
+		buffer->allocated_size = allocated_size;
+	}
+	if( data == NULL )
+	{
+		if( memory_set(
+		     &( buffer->data[ buffer->data_size ] ),
+		     0,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( buffer->data[ buffer->data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	buffer->data_size += data_size;
+
+	return( 1 );
+}
+
+/* Appends a 16-bit little-endian value to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_buffer_append_uint16(
+     wrc_test_generator_buffer_t *buffer,
+     uint16_t value_16bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 2 ];
+
+	static char *function = "wrc_test_generator_buffer_append_uint16";
+
+	byte_stream_copy_from_uint16_little_endian(
+	 value_data,
+	 value_16bit );
+
+	if( wrc_test_generator_buffer_append(
+	     buffer,
+	     value_data,
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 32-bit little-endian value to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_buffer_append_uint32(
+     wrc_test_generator_buffer_t *buffer,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 4 ];
+
+	static char *function = "wrc_test_generator_buffer_append_uint32";
+
+	byte_stream_copy_from_uint32_little_endian(
+	 value_data,
+	 value_32bit );
+
+	if( wrc_test_generator_buffer_append(
+	     buffer,
+	     value_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an ASCII string as an UTF-16 little-endian string to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_buffer_append_utf16_string(
+     wrc_test_generator_buffer_t *buffer,
+     const char *string,
+     size_t string_length,
+     uint8_t include_end_of_string,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_buffer_append_utf16_string";
+	size_t string_index   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( wrc_test_generator_buffer_append_uint16(
+		     buffer,
+		     (uint16_t) (uint8_t) string[ string_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append character: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+	}
+	if( include_end_of_string != 0 )
+	{
+		if( wrc_test_generator_buffer_append_uint16(
+		     buffer,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of string character.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends zero bytes to a buffer until its size is a multiple of the alignment
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_buffer_align(
+     wrc_test_generator_buffer_t *buffer,
+     size_t alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_buffer_align";
+	size_t padding_size   = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid alignment value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer->data_size % alignment ) != 0 )
+	{
+		padding_size = alignment - ( buffer->data_size % alignment );
+
+		if( wrc_test_generator_buffer_append(
+		     buffer,
+		     NULL,
+		     padding_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append alignment padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Allocates space in a region of the output
+ * When the generator has no output data only the size of the region is determined
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_allocate(
+     wrc_test_generator_t *generator,
+     int region,
+     size_t size,
+     uint32_t *offset,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_allocate";
+	size_t safe_offset    = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region < 0 )
+	 || ( region >= WRC_TEST_GENERATOR_NUMBER_OF_REGIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_offset = generator->region_offsets[ region ] + generator->region_sizes[ region ];
+
+	/* The offsets are stored as 31-bit values
+	 */
+	if( ( safe_offset > (size_t) 0x7fffffffUL )
+	 || ( size > ( (size_t) 0x7fffffffUL - safe_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( generator->data != NULL )
+	 && ( ( safe_offset + size ) > generator->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	generator->region_sizes[ region ] += size;
+
+	*offset = (uint32_t) safe_offset;
+
+	return( 1 );
+}
+
+/* Sets a 16-bit little-endian value in the output data
+ */
+void wrc_test_generator_set_uint16(
+      wrc_test_generator_t *generator,
+      uint32_t offset,
+      uint16_t value_16bit )
+{
+	if( ( generator == NULL )
+	 || ( generator->data == NULL ) )
+	{
+		return;
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( generator->data[ offset ] ),
+	 value_16bit );
+}
+
+/* Sets a 32-bit little-endian value in the output data
+ */
+void wrc_test_generator_set_uint32(
+      wrc_test_generator_t *generator,
+      uint32_t offset,
+      uint32_t value_32bit )
+{
+	if( ( generator == NULL )
+	 || ( generator->data == NULL ) )
+	{
+		return;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( generator->data[ offset ] ),
+	 value_32bit );
+}
+
+/* Writes a resource node header
+ * The entries of the node are set by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_write_node(
+     wrc_test_generator_t *generator,
+     int number_of_named_entries,
+     int number_of_unnamed_entries,
+     uint32_t *node_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_write_node";
+
+	if( ( number_of_named_entries < 0 )
+	 || ( number_of_named_entries > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of named entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_unnamed_entries < 0 )
+	 || ( number_of_unnamed_entries > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of unnamed entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( wrc_test_generator_allocate(
+	     generator,
+	     WRC_TEST_GENERATOR_REGION_DIRECTORIES,
+	     16 + ( 8 * (size_t) ( number_of_named_entries + number_of_unnamed_entries ) ),
+	     node_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to allocate node.",
+		 function );
+
+		return( -1 );
+	}
+	/* The characteristics and creation time are 0 and the version is 4.0
+	 */
+	wrc_test_generator_set_uint16(
+	 generator,
+	 *node_offset + 8,
+	 4 );
+
+	wrc_test_generator_set_uint16(
+	 generator,
+	 *node_offset + 12,
+	 (uint16_t) number_of_named_entries );
+
+	wrc_test_generator_set_uint16(
+	 generator,
+	 *node_offset + 14,
+	 (uint16_t) number_of_unnamed_entries );
+
+	return( 1 );
+}
+
+/* Sets a resource node entry
+ */
+void wrc_test_generator_set_node_entry(
+      wrc_test_generator_t *generator,
+      uint32_t node_offset,
+      int entry_index,
+      uint32_t identifier,
+      uint32_t offset )
+{
+	uint32_t entry_offset = node_offset + 16 + ( 8 * (uint32_t) entry_index );
+
+	wrc_test_generator_set_uint32(
+	 generator,
+	 entry_offset,
+	 identifier );
+
+	wrc_test_generator_set_uint32(
+	 generator,
+	 entry_offset + 4,
+	 offset );
+}
+
+/* Writes a resource name
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_write_name(
+     wrc_test_generator_t *generator,
+     const char *name,
+     size_t name_length,
+     uint32_t *name_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_write_name";
+	size_t name_index     = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( wrc_test_generator_allocate(
+	     generator,
+	     WRC_TEST_GENERATOR_REGION_NAMES,
+	     2 + ( 2 * name_length ),
+	     name_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to allocate name.",
+		 function );
+
+		return( -1 );
+	}
+	wrc_test_generator_set_uint16(
+	 generator,
+	 *name_offset,
+	 (uint16_t) name_length );
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		wrc_test_generator_set_uint16(
+		 generator,
+		 *name_offset + 2 + ( 2 * (uint32_t) name_index ),
+		 (uint16_t) (uint8_t) name[ name_index ] );
+	}
+	return( 1 );
+}
+
+/* Writes the resource data in the resource data buffer and its data descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_write_resource_data(
+     wrc_test_generator_t *generator,
+     uint32_t *data_descriptor_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_write_resource_data";
+	size_t aligned_size   = 0;
+	uint32_t data_offset  = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	/* Resource data is stored 8-byte aligned
+	 */
+	aligned_size = generator->resource_data.data_size;
+
+	if( ( aligned_size % 8 ) != 0 )
+	{
+		aligned_size += 8 - ( aligned_size % 8 );
+	}
+	if( wrc_test_generator_allocate(
+	     generator,
+	     WRC_TEST_GENERATOR_REGION_DATA,
+	     aligned_size,
+	     &data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to allocate resource data.",
+		 function );
+
+		return( -1 );
+	}
+	if( wrc_test_generator_allocate(
+	     generator,
+	     WRC_TEST_GENERATOR_REGION_DATA_DESCRIPTORS,
+	     16,
+	     data_descriptor_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to allocate data descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator->data == NULL )
+	{
+		return( 1 );
+	}
+	if( ( generator->resource_data.data_size > 0 )
+	 && ( memory_copy(
+	       &( generator->data[ data_offset ] ),
+	       generator->resource_data.data,
+	       generator->resource_data.data_size ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy resource data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The codepage and reserved values are 0
+	 */
+	wrc_test_generator_set_uint32(
+	 generator,
+	 *data_descriptor_offset,
+	 generator->parameters->virtual_address + data_offset );
+
+	wrc_test_generator_set_uint32(
+	 generator,
+	 *data_descriptor_offset + 4,
+	 (uint32_t) generator->resource_data.data_size );
+
+	return( 1 );
+}
+
+/* Retrieves the language identifier of a specific language
+ * Returns the language identifier
+ */
+uint32_t wrc_test_generator_get_language_identifier(
+          int language_index )
+{
+	if( language_index < 24 )
+	{
+		return( (uint32_t) wrc_test_generator_language_identifiers[ language_index ] );
+	}
+	/* Beyond the common languages use identifiers that do not overlap with them
+	 */
+	return( 0x00001000UL + (uint32_t) language_index );
+}
+
+/* Builds the resource data of a string table block
+ * Every fourth string of the block is empty
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_build_string_table(
+     wrc_test_generator_t *generator,
+     uint32_t identifier,
+     int language_index,
+     libcerror_error_t **error )
+{
+	char string[ 64 ];
+
+	static char *function = "wrc_test_generator_build_string_table";
+	size_t string_length  = 0;
+	int print_count       = 0;
+	int string_index      = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	generator->resource_data.data_size = 0;
+
+	for( string_index = 0;
+	     string_index < 16;
+	     string_index++ )
+	{
+		string_length = 0;
+
+		if( ( string_index % 4 ) != 3 )
+		{
+			print_count = narrow_string_snprintf(
+			               string,
+			               64,
+			               "String 0x%04" PRIx32 " of language %d",
+			               ( ( identifier - 1 ) << 4 ) | (uint32_t) string_index,
+			               language_index );
+
+			if( ( print_count < 0 )
+			 || ( print_count >= 64 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set string.",
+				 function );
+
+				return( -1 );
+			}
+			string_length = (size_t) print_count;
+		}
+		if( wrc_test_generator_buffer_append_uint16(
+		     &( generator->resource_data ),
+		     (uint16_t) string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string: %d size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( wrc_test_generator_buffer_append_utf16_string(
+		     &( generator->resource_data ),
+		     string,
+		     string_length,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the resource data of a message table
+ * The messages are stored in blocks of consecutive identifiers with gaps between the blocks
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_build_message_table(
+     wrc_test_generator_t *generator,
+     int language_index,
+     libcerror_error_t **error )
+{
+	char string[ 64 ];
+
+	static char *function       = "wrc_test_generator_build_message_table";
+	size_t descriptor_offset    = 0;
+	size_t string_length        = 0;
+	size_t string_size          = 0;
+	uint32_t first_identifier   = 0;
+	uint32_t message_identifier = 0;
+	int block_index             = 0;
+	int message_index           = 0;
+	int number_of_blocks        = 0;
+	int number_of_messages      = 0;
+	int print_count             = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	generator->resource_data.data_size = 0;
+
+	number_of_blocks = ( generator->parameters->number_of_messages + WRC_TEST_GENERATOR_MESSAGES_PER_BLOCK - 1 )
+	                 / WRC_TEST_GENERATOR_MESSAGES_PER_BLOCK;
+
+	if( wrc_test_generator_buffer_append_uint32(
+	     &( generator->resource_data ),
+	     (uint32_t) number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block descriptors are set when the messages of the block are appended
+	 */
+	if( wrc_test_generator_buffer_append(
+	     &( generator->resource_data ),
+	     NULL,
+	     12 * (size_t) number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append block descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		number_of_messages = generator->parameters->number_of_messages - ( block_index * WRC_TEST_GENERATOR_MESSAGES_PER_BLOCK );
+
+		if( number_of_messages > WRC_TEST_GENERATOR_MESSAGES_PER_BLOCK )
+		{
+			number_of_messages = WRC_TEST_GENERATOR_MESSAGES_PER_BLOCK;
+		}
+		first_identifier  = ( (uint32_t) block_index * 0x100 ) + 1;
+		descriptor_offset = 4 + ( 12 * (size_t) block_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( generator->resource_data.data[ descriptor_offset ] ),
+		 first_identifier );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( generator->resource_data.data[ descriptor_offset + 4 ] ),
+		 first_identifier + (uint32_t) number_of_messages - 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( generator->resource_data.data[ descriptor_offset + 8 ] ),
+		 (uint32_t) generator->resource_data.data_size );
+
+		for( message_index = 0;
+		     message_index < number_of_messages;
+		     message_index++ )
+		{
+			message_identifier = first_identifier + (uint32_t) message_index;
+
+			print_count = narrow_string_snprintf(
+			               string,
+			               64,
+			               "Message 0x%08" PRIx32 " of language %d\r\n",
+			               message_identifier,
+			               language_index );
+
+			if( ( print_count < 0 )
+			 || ( print_count >= 64 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set message string.",
+				 function );
+
+				return( -1 );
+			}
+			string_length = (size_t) print_count;
+
+			/* The message entry consists of the size, flags and the UTF-16 string
+			 * including the end of string character, padded to a multiple of 4
+			 */
+			string_size = 4 + ( 2 * ( string_length + 1 ) );
+
+			if( ( string_size % 4 ) != 0 )
+			{
+				string_size += 4 - ( string_size % 4 );
+			}
+			if( wrc_test_generator_buffer_append_uint16(
+			     &( generator->resource_data ),
+			     (uint16_t) string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message: 0x%08" PRIx32 " size.",
+				 function,
+				 message_identifier );
+
+				return( -1 );
+			}
+			if( wrc_test_generator_buffer_append_uint16(
+			     &( generator->resource_data ),
+			     0x0001,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message: 0x%08" PRIx32 " flags.",
+				 function,
+				 message_identifier );
+
+				return( -1 );
+			}
+			if( wrc_test_generator_buffer_append_utf16_string(
+			     &( generator->resource_data ),
+			     string,
+			     string_length,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message: 0x%08" PRIx32 " string.",
+				 function,
+				 message_identifier );
+
+				return( -1 );
+			}
+			if( wrc_test_generator_buffer_align(
+			     &( generator->resource_data ),
+			     4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to align message: 0x%08" PRIx32 ".",
+				 function,
+				 message_identifier );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Begins a version information block
+ * The size of the block is set by wrc_test_generator_end_version_block
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_begin_version_block(
+     wrc_test_generator_buffer_t *buffer,
+     const char *key,
+     uint16_t value_size,
+     uint16_t value_type,
+     size_t *block_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "wrc_test_generator_begin_version_block";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( wrc_test_generator_buffer_align(
+	     buffer,
+	     4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*block_offset = buffer->data_size;
+
+	if( wrc_test_generator_buffer_append_uint16(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( wrc_test_generator_buffer_append_uint16(
+	     buffer,
+	     value_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( wrc_test_generator_buffer_append_uint16(
+	     buffer,
+	     value_type,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( wrc_test_generator_buffer_append_utf16_string(
+	     buffer,
+	     key,
+	     narrow_string_length(
+	      key ),
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( wrc_test_generator_buffer_align(
+	     buffer,
+	     4,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append block: %s header.",
+	 function,
+	 key );
+
+	return( -1 );
+}
+
+/* Ends a version information block
+ */
+void wrc_test_generator_end_version_block(
+      wrc_test_generator_buffer_t *buffer,
+      size_t block_offset )
+{
+	if( buffer == NULL )
+	{
+		return;
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( buffer->data[ block_offset ] ),
+	 (uint16_t) ( buffer->data_size - block_offset ) );
+}
+
+/* Builds the resource data of a version information resource
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_build_version_information(
+     wrc_test_generator_t *generator,
+     int language_index,
+     libcerror_error_t **error )
+{
+	char string[ 32 ];
+
+	const char *keys[ 5 ]             = {
+		"CompanyName", "FileDescription", "FileVersion", "ProductName", "ProductVersion" };
+
+	const char *values[ 5 ]           = {
+		"libwrc", "Synthetic resource", NULL, "wrc_test_generator", "1.0" };
+
+	wrc_test_generator_buffer_t *buffer = NULL;
+	const char *value                   = NULL;
+	static char *function               = "wrc_test_generator_build_version_information";
+	size_t string_block_offset          = 0;
+	size_t string_file_info_offset      = 0;
+	size_t string_table_offset          = 0;
+	size_t translation_offset           = 0;
+	size_t value_length                 = 0;
+	size_t var_file_info_offset         = 0;
+	size_t version_information_offset   = 0;
+	uint32_t language_identifier        = 0;
+	int key_index                       = 0;
+	int print_count                     = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	buffer              = &( generator->resource_data );
+	buffer->data_size   = 0;
+	language_identifier = wrc_test_generator_get_language_identifier(
+	                       language_index );
+
+	if( wrc_test_generator_begin_version_block(
+	     buffer,
+	     "VS_VERSION_INFO",
+	     52,
+	     0,
+	     &version_information_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The fixed file information, the file version contains the language index
+	 */
+	if( ( wrc_test_generator_buffer_append_uint32( buffer, 0xfeef04bdUL, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0x00010000UL, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0x00010000UL, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, (uint32_t) language_index, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0x00010000UL, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0x0000003fUL, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0x00040004UL, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0x00000002UL, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint32( buffer, 0, error ) != 1 ) )
+	{
+		goto on_error;
+	}
+	if( wrc_test_generator_begin_version_block(
+	     buffer,
+	     "StringFileInfo",
+	     0,
+	     1,
+	     &string_file_info_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	print_count = narrow_string_snprintf(
+	               string,
+	               32,
+	               "%04" PRIx32 "04b0",
+	               language_identifier & (uint32_t) 0x0000ffffUL );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		goto on_error;
+	}
+	if( wrc_test_generator_begin_version_block(
+	     buffer,
+	     string,
+	     0,
+	     1,
+	     &string_table_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( key_index = 0;
+	     key_index < 5;
+	     key_index++ )
+	{
+		value = values[ key_index ];
+
+		if( value == NULL )
+		{
+			print_count = narrow_string_snprintf(
+			               string,
+			               32,
+			               "1.0.%d",
+			               language_index );
+
+			if( ( print_count < 0 )
+			 || ( print_count >= 32 ) )
+			{
+				goto on_error;
+			}
+			value = string;
+		}
+		value_length = narrow_string_length(
+		                value );
+
+		if( wrc_test_generator_begin_version_block(
+		     buffer,
+		     keys[ key_index ],
+		     (uint16_t) ( value_length + 1 ),
+		     1,
+		     &string_block_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( wrc_test_generator_buffer_append_utf16_string(
+		     buffer,
+		     value,
+		     value_length,
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		wrc_test_generator_end_version_block(
+		 buffer,
+		 string_block_offset );
+	}
+	wrc_test_generator_end_version_block(
+	 buffer,
+	 string_table_offset );
+
+	wrc_test_generator_end_version_block(
+	 buffer,
+	 string_file_info_offset );
+
+	if( wrc_test_generator_begin_version_block(
+	     buffer,
+	     "VarFileInfo",
+	     0,
+	     1,
+	     &var_file_info_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( wrc_test_generator_begin_version_block(
+	     buffer,
+	     "Translation",
+	     4,
+	     0,
+	     &translation_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( wrc_test_generator_buffer_append_uint16( buffer, (uint16_t) language_identifier, error ) != 1 )
+	 || ( wrc_test_generator_buffer_append_uint16( buffer, 0x04b0, error ) != 1 ) )
+	{
+		goto on_error;
+	}
+	wrc_test_generator_end_version_block(
+	 buffer,
+	 translation_offset );
+
+	wrc_test_generator_end_version_block(
+	 buffer,
+	 var_file_info_offset );
+
+	wrc_test_generator_end_version_block(
+	 buffer,
+	 version_information_offset );
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to build version information.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes a language node of a resource with the resource data of every language
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_write_languages(
+     wrc_test_generator_t *generator,
+     uint32_t resource_identifier,
+     uint32_t identifier,
+     int number_of_languages,
+     uint32_t *node_offset,
+     libcerror_error_t **error )
+{
+	char string[ 64 ];
+
+	static char *function           = "wrc_test_generator_write_languages";
+	uint32_t data_descriptor_offset = 0;
+	int language_index              = 0;
+	int print_count                 = 0;
+	int result                      = 0;
+
+	if( wrc_test_generator_write_node(
+	     generator,
+	     0,
+	     number_of_languages,
+	     node_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write language node.",
+		 function );
+
+		return( -1 );
+	}
+	for( language_index = 0;
+	     language_index < number_of_languages;
+	     language_index++ )
+	{
+		switch( resource_identifier )
+		{
+			case WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_STRING_TABLE:
+				result = wrc_test_generator_build_string_table(
+				          generator,
+				          identifier,
+				          language_index,
+				          error );
+				break;
+
+			case WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_MESSAGE_TABLE:
+				result = wrc_test_generator_build_message_table(
+				          generator,
+				          language_index,
+				          error );
+				break;
+
+			case WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_VERSION:
+				result = wrc_test_generator_build_version_information(
+				          generator,
+				          language_index,
+				          error );
+				break;
+
+			default:
+				generator->resource_data.data_size = 0;
+
+				print_count = narrow_string_snprintf(
+				               string,
+				               64,
+				               "Resource 0x%08" PRIx32 " of language %d",
+				               identifier,
+				               language_index );
+
+				if( ( print_count < 0 )
+				 || ( print_count >= 64 ) )
+				{
+					result = -1;
+				}
+				else
+				{
+					result = wrc_test_generator_buffer_append(
+					          &( generator->resource_data ),
+					          (uint8_t *) string,
+					          (size_t) print_count,
+					          error );
+				}
+				break;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to build resource data of language: %d.",
+			 function,
+			 language_index );
+
+			return( -1 );
+		}
+		if( wrc_test_generator_write_resource_data(
+		     generator,
+		     &data_descriptor_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write resource data of language: %d.",
+			 function,
+			 language_index );
+
+			return( -1 );
+		}
+		wrc_test_generator_set_node_entry(
+		 generator,
+		 *node_offset,
+		 language_index,
+		 wrc_test_generator_get_language_identifier(
+		  language_index ),
+		 data_descriptor_offset );
+	}
+	return( 1 );
+}
+
+/* Writes a nested resource tree
+ * All the entries of a node reference the same sub node and the entries
+ * of the deepest node all reference the same data descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_write_nested_tree(
+     wrc_test_generator_t *generator,
+     uint32_t *node_offset,
+     libcerror_error_t **error )
+{
+	static char *function           = "wrc_test_generator_write_nested_tree";
+	uint32_t data_descriptor_offset = 0;
+	uint32_t parent_node_offset     = 0;
+	uint32_t sub_node_offset        = 0;
+	int depth                       = 0;
+	int entry_index                 = 0;
+	int number_of_entries           = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = generator->parameters->tree_width;
+
+	for( depth = 0;
+	     depth < generator->parameters->tree_depth;
+	     depth++ )
+	{
+		if( wrc_test_generator_write_node(
+		     generator,
+		     0,
+		     number_of_entries,
+		     &sub_node_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write node at depth: %d.",
+			 function,
+			 depth );
+
+			return( -1 );
+		}
+		if( depth == 0 )
+		{
+			*node_offset = sub_node_offset;
+		}
+		else
+		{
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				wrc_test_generator_set_node_entry(
+				 generator,
+				 parent_node_offset,
+				 entry_index,
+				 (uint32_t) entry_index + 1,
+				 0x80000000UL | sub_node_offset );
+			}
+		}
+		parent_node_offset = sub_node_offset;
+	}
+	generator->resource_data.data_size = 0;
+
+	if( wrc_test_generator_buffer_append(
+	     &( generator->resource_data ),
+	     (uint8_t *) "Nested resource",
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to build resource data.",
+		 function );
+
+		return( -1 );
+	}
+	if( wrc_test_generator_write_resource_data(
+	     generator,
+	     &data_descriptor_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write resource data.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		wrc_test_generator_set_node_entry(
+		 generator,
+		 parent_node_offset,
+		 entry_index,
+		 (uint32_t) entry_index + 1,
+		 data_descriptor_offset );
+	}
+	return( 1 );
+}
+
+/* Writes the identifier node of a resource type
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_write_resource_type(
+     wrc_test_generator_t *generator,
+     uint32_t resource_identifier,
+     uint32_t *node_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "wrc_test_generator_write_resource_type";
+	uint32_t sub_node_offset  = 0;
+	int entry_index           = 0;
+	int number_of_entries     = 1;
+	int number_of_languages   = 0;
+	int result                = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_languages = generator->parameters->number_of_languages;
+
+	if( resource_identifier == WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_STRING_TABLE )
+	{
+		number_of_entries = generator->parameters->number_of_string_tables;
+	}
+	else if( resource_identifier == WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_NAMED )
+	{
+		number_of_languages = 1;
+	}
+	if( wrc_test_generator_write_node(
+	     generator,
+	     0,
+	     number_of_entries,
+	     node_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write identifier node.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( resource_identifier == WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_RAW_DATA )
+		{
+			result = wrc_test_generator_write_nested_tree(
+			          generator,
+			          &sub_node_offset,
+			          error );
+		}
+		else
+		{
+			result = wrc_test_generator_write_languages(
+			          generator,
+			          resource_identifier,
+			          (uint32_t) entry_index + 1,
+			          number_of_languages,
+			          &sub_node_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sub node: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		wrc_test_generator_set_node_entry(
+		 generator,
+		 *node_offset,
+		 entry_index,
+		 (uint32_t) entry_index + 1,
+		 0x80000000UL | sub_node_offset );
+	}
+	return( 1 );
+}
+
+/* Writes the resource tree
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generator_write_tree(
+     wrc_test_generator_t *generator,
+     libcerror_error_t **error )
+{
+	char name[ 16 ];
+
+	uint32_t resource_identifiers[ 4 ];
+
+	const wrc_test_generator_parameters_t *parameters = NULL;
+	static char *function                             = "wrc_test_generator_write_tree";
+	uint32_t name_offset                              = 0;
+	uint32_t root_node_offset                         = 0;
+	uint32_t sub_node_offset                          = 0;
+	int entry_index                                   = 0;
+	int number_of_unnamed_types                       = 0;
+	int print_count                                   = 0;
+	int type_index                                    = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	parameters = generator->parameters;
+
+	/* The unnamed types are stored in ascending order of their identifier
+	 */
+	if( parameters->number_of_string_tables > 0 )
+	{
+		resource_identifiers[ number_of_unnamed_types++ ] = WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_STRING_TABLE;
+	}
+	if( parameters->tree_depth > 0 )
+	{
+		resource_identifiers[ number_of_unnamed_types++ ] = WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_RAW_DATA;
+	}
+	if( parameters->number_of_messages > 0 )
+	{
+		resource_identifiers[ number_of_unnamed_types++ ] = WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_MESSAGE_TABLE;
+	}
+	if( parameters->has_version_information != 0 )
+	{
+		resource_identifiers[ number_of_unnamed_types++ ] = WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_VERSION;
+	}
+	if( wrc_test_generator_write_node(
+	     generator,
+	     parameters->number_of_named_types,
+	     number_of_unnamed_types,
+	     &root_node_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write root node.",
+		 function );
+
+		return( -1 );
+	}
+	/* The named types are stored first in ascending order of their name
+	 */
+	for( type_index = 0;
+	     type_index < parameters->number_of_named_types;
+	     type_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               16,
+		               "TYPE%05d",
+		               type_index );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name of type: %d.",
+			 function,
+			 type_index );
+
+			return( -1 );
+		}
+		if( wrc_test_generator_write_name(
+		     generator,
+		     name,
+		     (size_t) print_count,
+		     &name_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write name of type: %d.",
+			 function,
+			 type_index );
+
+			return( -1 );
+		}
+		if( wrc_test_generator_write_resource_type(
+		     generator,
+		     WRC_TEST_GENERATOR_RESOURCE_IDENTIFIER_NAMED,
+		     &sub_node_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write type: %d.",
+			 function,
+			 type_index );
+
+			return( -1 );
+		}
+		wrc_test_generator_set_node_entry(
+		 generator,
+		 root_node_offset,
+		 entry_index++,
+		 0x80000000UL | name_offset,
+		 0x80000000UL | sub_node_offset );
+	}
+	for( type_index = 0;
+	     type_index < number_of_unnamed_types;
+	     type_index++ )
+	{
+		if( wrc_test_generator_write_resource_type(
+		     generator,
+		     resource_identifiers[ type_index ],
+		     &sub_node_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write type: 0x%08" PRIx32 ".",
+			 function,
+			 resource_identifiers[ type_index ] );
+
+			return( -1 );
+		}
+		wrc_test_generator_set_node_entry(
+		 generator,
+		 root_node_offset,
+		 entry_index++,
+		 resource_identifiers[ type_index ],
+		 0x80000000UL | sub_node_offset );
+	}
+	return( 1 );
+}
+
+/* Generates a resource section
+ * The resource section consists of the resource nodes, followed by the names,
+ * the data descriptors and the resource data
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_generate_resource_section(
+     const wrc_test_generator_parameters_t *parameters,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	wrc_test_generator_t generator;
+
+	static char *function = "wrc_test_generate_resource_section";
+	size_t offset         = 0;
+	int region            = 0;
+
+	if( parameters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parameters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parameters->number_of_string_tables < 0 )
+	 || ( parameters->number_of_string_tables > (int) UINT16_MAX )
+	 || ( parameters->number_of_messages < 0 )
+	 || ( parameters->number_of_named_types < 0 )
+	 || ( parameters->number_of_named_types > 99999 )
+	 || ( parameters->number_of_languages <= 0 )
+	 || ( parameters->number_of_languages > (int) UINT16_MAX )
+	 || ( parameters->tree_depth < 0 )
+	 || ( parameters->tree_depth > WRC_TEST_GENERATOR_MAXIMUM_TREE_DEPTH )
+	 || ( parameters->tree_width <= 0 )
+	 || ( parameters->tree_width > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parameters value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &generator,
+	     0,
+	     sizeof( wrc_test_generator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generator.",
+		 function );
+
+		return( -1 );
+	}
+	generator.parameters = parameters;
+
+	/* The first pass determines the size of the regions
+	 */
+	if( wrc_test_generator_write_tree(
+	     &generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine size of resource section.",
+		 function );
+
+		goto on_error;
+	}
+	for( region = 0;
+	     region < WRC_TEST_GENERATOR_NUMBER_OF_REGIONS;
+	     region++ )
+	{
+		/* Every region is stored 8-byte aligned
+		 */
+		if( ( offset % 8 ) != 0 )
+		{
+			offset += 8 - ( offset % 8 );
+		}
+		generator.region_offsets[ region ] = offset;
+
+		if( generator.region_sizes[ region ] > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid resource section size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		offset += generator.region_sizes[ region ];
+
+		generator.region_sizes[ region ] = 0;
+	}
+	if( offset == 0 )
+	{
+		offset = 8;
+	}
+	generator.data_size = offset;
+
+	generator.data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * generator.data_size );
+
+	if( generator.data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     generator.data,
+	     0,
+	     generator.data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The second pass writes the regions
+	 */
+	if( wrc_test_generator_write_tree(
+	     &generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write resource section.",
+		 function );
+
+		goto on_error;
+	}
+	if( generator.resource_data.data != NULL )
+	{
+		memory_free(
+		 generator.resource_data.data );
+	}
+	*data      = generator.data;
+	*data_size = generator.data_size;
+
+	return( 1 );
+
+on_error:
+	if( generator.data != NULL )
+	{
+		memory_free(
+		 generator.data );
+	}
+	if( generator.resource_data.data != NULL )
+	{
+		memory_free(
+		 generator.resource_data.data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,278 @@
+/*
+ * Synthetic resource section generator for testing
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _WRC_TEST_GENERATOR_H )
+#define _WRC_TEST_GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "wrc_test_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum depth of the generated resource tree
+ * The root, type and identifier levels are not included
+ */
+#define WRC_TEST_GENERATOR_MAXIMUM_TREE_DEPTH		120
+
+enum WRC_TEST_GENERATOR_REGIONS
+{
+	WRC_TEST_GENERATOR_REGION_DIRECTORIES		= 0,
+	WRC_TEST_GENERATOR_REGION_NAMES			= 1,
+	WRC_TEST_GENERATOR_REGION_DATA_DESCRIPTORS	= 2,
+	WRC_TEST_GENERATOR_REGION_DATA			= 3,
+
+	WRC_TEST_GENERATOR_NUMBER_OF_REGIONS		= 4
+};
+
+typedef struct wrc_test_generator_parameters wrc_test_generator_parameters_t;
+
+struct wrc_test_generator_parameters
+{
+	/* The virtual address of the resource section
+	 */
+	uint32_t virtual_address;
+
+	/* The number of string table block identifiers
+	 * Every block is stored once per language
+	 */
+	int number_of_string_tables;
+
+	/* The number of messages of the message table
+	 * The message table is stored once per language
+	 */
+	int number_of_messages;
+
+	/* The number of named resource types
+	 */
+	int number_of_named_types;
+
+	/* The number of languages
+	 */
+	int number_of_languages;
+
+	/* Value to indicate a version information resource should be generated
+	 * The version information resource is stored once per language
+	 */
+	uint8_t has_version_information;
+
+	/* The depth of the nested (raw data) resource tree, 0 if none
+	 */
+	int tree_depth;
+
+	/* The number of entries per nested resource tree node
+	 * All entries of a node reference the same sub node
+	 */
+	int tree_width;
+};
+
+typedef struct wrc_test_generator_buffer wrc_test_generator_buffer_t;
+
+struct wrc_test_generator_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated size
+	 */
+	size_t allocated_size;
+};
+
+typedef struct wrc_test_generator wrc_test_generator_t;
+
+struct wrc_test_generator
+{
+	/* The parameters
+	 */
+	const wrc_test_generator_parameters_t *parameters;
+
+	/* The output data
+	 * NULL when only the size of the regions is determined
+	 */
+	uint8_t *data;
+
+	/* The output data size
+	 */
+	size_t data_size;
+
+	/* The offsets of the regions
+	 */
+	size_t region_offsets[ WRC_TEST_GENERATOR_NUMBER_OF_REGIONS ];
+
+	/* The sizes of the regions
+	 */
+	size_t region_sizes[ WRC_TEST_GENERATOR_NUMBER_OF_REGIONS ];
+
+	/* The buffer used to build resource data
+	 */
+	wrc_test_generator_buffer_t resource_data;
+};
+
+int wrc_test_generator_parameters_set_defaults(
+     wrc_test_generator_parameters_t *parameters,
+     int scale_factor,
+     libcerror_error_t **error );
+
+int wrc_test_generator_buffer_append(
+     wrc_test_generator_buffer_t *buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int wrc_test_generator_buffer_append_uint16(
+     wrc_test_generator_buffer_t *buffer,
+     uint16_t value_16bit,
+     libcerror_error_t **error );
+
+int wrc_test_generator_buffer_append_uint32(
+     wrc_test_generator_buffer_t *buffer,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
+int wrc_test_generator_buffer_append_utf16_string(
+     wrc_test_generator_buffer_t *buffer,
+     const char *string,
+     size_t string_length,
+     uint8_t include_end_of_string,
+     libcerror_error_t **error );
+
+int wrc_test_generator_buffer_align(
+     wrc_test_generator_buffer_t *buffer,
+     size_t alignment,
+     libcerror_error_t **error );
+
+int wrc_test_generator_allocate(
+     wrc_test_generator_t *generator,
+     int region,
+     size_t size,
+     uint32_t *offset,
+     libcerror_error_t **error );
+
+void wrc_test_generator_set_uint16(
+      wrc_test_generator_t *generator,
+      uint32_t offset,
+      uint16_t value_16bit );
+
+void wrc_test_generator_set_uint32(
+      wrc_test_generator_t *generator,
+      uint32_t offset,
+      uint32_t value_32bit );
+
+int wrc_test_generator_write_node(
+     wrc_test_generator_t *generator,
+     int number_of_named_entries,
+     int number_of_unnamed_entries,
+     uint32_t *node_offset,
+     libcerror_error_t **error );
+
+void wrc_test_generator_set_node_entry(
+      wrc_test_generator_t *generator,
+      uint32_t node_offset,
+      int entry_index,
+      uint32_t identifier,
+      uint32_t offset );
+
+int wrc_test_generator_write_name(
+     wrc_test_generator_t *generator,
+     const char *name,
+     size_t name_length,
+     uint32_t *name_offset,
+     libcerror_error_t **error );
+
+int wrc_test_generator_write_resource_data(
+     wrc_test_generator_t *generator,
+     uint32_t *data_descriptor_offset,
+     libcerror_error_t **error );
+
+uint32_t wrc_test_generator_get_language_identifier(
+          int language_index );
+
+int wrc_test_generator_build_string_table(
+     wrc_test_generator_t *generator,
+     uint32_t identifier,
+     int language_index,
+     libcerror_error_t **error );
+
+int wrc_test_generator_build_message_table(
+     wrc_test_generator_t *generator,
+     int language_index,
+     libcerror_error_t **error );
+
+int wrc_test_generator_begin_version_block(
+     wrc_test_generator_buffer_t *buffer,
+     const char *key,
+     uint16_t value_size,
+     uint16_t value_type,
+     size_t *block_offset,
+     libcerror_error_t **error );
+
+void wrc_test_generator_end_version_block(
+      wrc_test_generator_buffer_t *buffer,
+      size_t block_offset );
+
+int wrc_test_generator_build_version_information(
+     wrc_test_generator_t *generator,
+     int language_index,
+     libcerror_error_t **error );
+
+int wrc_test_generator_write_languages(
+     wrc_test_generator_t *generator,
+     uint32_t resource_identifier,
+     uint32_t identifier,
+     int number_of_languages,
+     uint32_t *node_offset,
+     libcerror_error_t **error );
+
+int wrc_test_generator_write_nested_tree(
+     wrc_test_generator_t *generator,
+     uint32_t *node_offset,
+     libcerror_error_t **error );
+
+int wrc_test_generator_write_resource_type(
+     wrc_test_generator_t *generator,
+     uint32_t resource_identifier,
+     uint32_t *node_offset,
+     libcerror_error_t **error );
+
+int wrc_test_generator_write_tree(
+     wrc_test_generator_t *generator,
+     libcerror_error_t **error );
+
+int wrc_test_generate_resource_section(
+     const wrc_test_generator_parameters_t *parameters,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _WRC_TEST_GENERATOR_H ) */
+
@@ -33,6 +33,7 @@
 #include "wrc_test_memory.h"
 #include "wrc_test_unused.h"
 
+#include "../libwrc/libwrc_definitions.h"
 #include "../libwrc/libwrc_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
@@ -398,6 +399,413 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libwrc_io_handle_update_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_io_handle_update_statistics(
+     void )
+{
+	libwrc_statistics_t statistics;
+
+	libcerror_error_t *error      = NULL;
+	libwrc_io_handle_t *io_handle = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_READ,
+	          16,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_READ,
+	          32,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The maximum allocated size is retained after the memory is freed
+	 */
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+	          100,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+	          50,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_FREE,
+	          150,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_ALLOCATE,
+	          20,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_NODE,
+	          3,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_DATA_DESCRIPTORS,
+	          2,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          LIBWRC_STATISTICS_VALUE_TYPE_STRING_VALUES_READ_TIME,
+	          1000,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_get_statistics(
+	          io_handle,
+	          &statistics,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_reads",
+	 statistics.number_of_reads,
+	 (uint64_t) 2 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.read_size",
+	 statistics.read_size,
+	 (uint64_t) 48 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_allocations",
+	 statistics.number_of_allocations,
+	 (uint64_t) 3 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.maximum_allocated_size",
+	 statistics.maximum_allocated_size,
+	 (uint64_t) 150 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_nodes",
+	 statistics.number_of_nodes,
+	 (uint64_t) 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_node_entries",
+	 statistics.number_of_node_entries,
+	 (uint64_t) 3 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_data_descriptors",
+	 statistics.number_of_data_descriptors,
+	 (uint64_t) 2 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.string_values_read_time",
+	 statistics.string_values_read_time,
+	 (uint64_t) 1000 );
+
+	/* Test error cases
+	 */
+	result = libwrc_io_handle_update_statistics(
+	          NULL,
+	          LIBWRC_STATISTICS_VALUE_TYPE_READ,
+	          16,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_io_handle_update_statistics(
+	          io_handle,
+	          -1,
+	          16,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_io_handle_get_statistics(
+	          NULL,
+	          &statistics,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_io_handle_get_statistics(
+	          io_handle,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libwrc_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_io_handle_get_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_io_handle_get_current_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t current_time    = 0;
+	uint64_t start_time      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_io_handle_get_current_time(
+	          &start_time,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_io_handle_get_current_time(
+	          &current_time,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The clock is monotonic
+	 */
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "current_time >= start_time",
+	 (int) ( current_time >= start_time ),
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libwrc_io_handle_get_current_time(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +837,14 @@ int main(
 	 "libwrc_io_handle_clear",
 	 wrc_test_io_handle_clear );
 
+	WRC_TEST_RUN(
+	 "libwrc_io_handle_update_statistics",
+	 wrc_test_io_handle_update_statistics );
+
+	WRC_TEST_RUN(
+	 "libwrc_io_handle_get_current_time",
+	 wrc_test_io_handle_get_current_time );
+
 	/* TODO: add tests for libwrc_io_handle_read_resource_nodes */
 
 	/* TODO: add tests for libwrc_io_handle_read_resource_node */
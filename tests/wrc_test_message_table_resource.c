@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -45,6 +46,16 @@ uint8_t wrc_test_message_table_resource_data1[ 120 ] = {
 	0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d,
 	0x65, 0x74, 0x65, 0x72, 0x73, 0x0d, 0x0a, 0x00 };
 
+uint8_t wrc_test_message_table_resource_data2[ 120 ] = {
+	0x02, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x43, 0x61, 0x74, 0x65, 0x67, 0x6f, 0x72, 0x79, 0x0d, 0x0a, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x4d, 0x79, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+	0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x20, 0x25, 0x31, 0x20, 0x25, 0x32,
+	0x2e, 0x0d, 0x0a, 0x00, 0x24, 0x00, 0x00, 0x00, 0x4d, 0x79, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61,
+	0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d,
+	0x65, 0x74, 0x65, 0x72, 0x73, 0x0d, 0x0a, 0x00 };
+
 /* Tests the libwrc_message_table_resource_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -346,6 +357,51 @@ int wrc_test_message_table_resource_read(
 	libcerror_error_free(
 	 &error );
 
+	result = libwrc_message_table_resource_read(
+	          message_table_resource,
+	          wrc_test_message_table_resource_data1,
+	          120,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_message_table_resource_free(
+	          &message_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_message_table_resource_initialize(
+	          &message_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libwrc_message_table_resource_read(
 	          message_table_resource,
 	          NULL,
@@ -439,6 +495,444 @@ on_error:
 	return( 0 );
 }
 
+/* Tests that the libwrc_message_table_resource_read function retains the resource data
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_message_table_resource_read_retains_data(
+     void )
+{
+	uint8_t data[ 120 ];
+	uint8_t utf8_string[ 32 ];
+
+	uint8_t expected_utf8_string[ 11 ] = {
+		'C', 'a', 't', 'e', 'g', 'o', 'r', 'y', '\r', '\n', 0 };
+
+	libcerror_error_t *error                                = NULL;
+	libwrc_message_table_resource_t *message_table_resource = NULL;
+	size_t utf8_string_size                                 = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_message_table_resource_initialize(
+	          &message_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "message_table_resource",
+	 message_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = (int) ( memory_copy(
+	                  data,
+	                  wrc_test_message_table_resource_data1,
+	                  120 ) != NULL );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_message_table_resource_read(
+	          message_table_resource,
+	          data,
+	          120,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The message strings are read from the retained resource data
+	 */
+	result = (int) ( memory_set(
+	                  data,
+	                  0xff,
+	                  120 ) != NULL );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_message_table_resource_get_utf8_string_size(
+	          message_table_resource,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_message_table_resource_get_utf8_string(
+	          message_table_resource,
+	          0,
+	          utf8_string,
+	          32,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          11 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libwrc_message_table_resource_free(
+	          &message_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "message_table_resource",
+	 message_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_table_resource != NULL )
+	{
+		libwrc_message_table_resource_free(
+		 &message_table_resource,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that the libwrc_message_table_resource_read function resets the message table resource on error
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_message_table_resource_read_after_error(
+     void )
+{
+	uint8_t data[ 120 ];
+
+	libcerror_error_t *error                                = NULL;
+	libwrc_message_table_resource_t *message_table_resource = NULL;
+	int number_of_messages                                  = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_message_table_resource_initialize(
+	          &message_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "message_table_resource",
+	 message_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = (int) ( memory_copy(
+	                  data,
+	                  wrc_test_message_table_resource_data1,
+	                  120 ) != NULL );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The message string offset of the second message entry descriptor is out of bounds
+	 * hence the read fails after the messages of the first descriptor were read
+	 */
+	data[ 24 ] = 0xf0;
+
+	/* Test error cases
+	 */
+	result = libwrc_message_table_resource_read(
+	          message_table_resource,
+	          data,
+	          120,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_message_table_resource_get_number_of_messages(
+	          message_table_resource,
+	          &number_of_messages,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_messages",
+	 number_of_messages,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The message table resource can be read again after an error
+	 */
+	result = libwrc_message_table_resource_read(
+	          message_table_resource,
+	          wrc_test_message_table_resource_data1,
+	          120,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_message_table_resource_get_number_of_messages(
+	          message_table_resource,
+	          &number_of_messages,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_messages",
+	 number_of_messages,
+	 3 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwrc_message_table_resource_free(
+	          &message_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "message_table_resource",
+	 message_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_table_resource != NULL )
+	{
+		libwrc_message_table_resource_free(
+		 &message_table_resource,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_message_table_resource_get_index_by_identifier function with sorted and unsorted message ranges
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_message_table_resource_get_index_by_identifier_ranges(
+     void )
+{
+	uint32_t message_identifiers[ 5 ] = { 0x00000000UL, 0x00000001UL, 0x00000002UL, 0x00000003UL, 0x000003e8UL };
+	int expected_indexes[ 2 ][ 5 ]    = { { -1, 0, 1, -1, 2 }, { -1, 1, 2, -1, 0 } };
+	uint8_t *data_sets[ 2 ]           = { wrc_test_message_table_resource_data1, wrc_test_message_table_resource_data2 };
+
+	libcerror_error_t *error                                = NULL;
+	libwrc_message_table_resource_t *message_table_resource = NULL;
+	int data_set_index                                      = 0;
+	int identifier_index                                    = 0;
+	int message_index                                       = 0;
+	int result                                              = 0;
+
+	for( data_set_index = 0;
+	     data_set_index < 2;
+	     data_set_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libwrc_message_table_resource_initialize(
+		          &message_table_resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NOT_NULL(
+		 "message_table_resource",
+		 message_table_resource );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwrc_message_table_resource_read(
+		          message_table_resource,
+		          data_sets[ data_set_index ],
+		          120,
+		          LIBWRC_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		for( identifier_index = 0;
+		     identifier_index < 5;
+		     identifier_index++ )
+		{
+			message_index = -1;
+
+			result = libwrc_message_table_resource_get_index_by_identifier(
+			          message_table_resource,
+			          message_identifiers[ identifier_index ],
+			          &message_index,
+			          &error );
+
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 ( expected_indexes[ data_set_index ][ identifier_index ] == -1 ) ? 0 : 1 );
+
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "message_index",
+			 message_index,
+			 expected_indexes[ data_set_index ][ identifier_index ] );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Clean up
+		 */
+		result = libwrc_message_table_resource_free(
+		          &message_table_resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "message_table_resource",
+		 message_table_resource );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_table_resource != NULL )
+	{
+		libwrc_message_table_resource_free(
+		 &message_table_resource,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libwrc_message_table_resource_get_number_of_messages function
  * Returns 1 if successful or 0 if not
  */
@@ -1240,6 +1734,18 @@ int main(
 	 "libwrc_message_table_resource_read",
 	 wrc_test_message_table_resource_read );
 
+	WRC_TEST_RUN(
+	 "libwrc_message_table_resource_read_retains_data",
+	 wrc_test_message_table_resource_read_retains_data );
+
+	WRC_TEST_RUN(
+	 "libwrc_message_table_resource_read_after_error",
+	 wrc_test_message_table_resource_read_after_error );
+
+	WRC_TEST_RUN(
+	 "libwrc_message_table_resource_get_index_by_identifier",
+	 wrc_test_message_table_resource_get_index_by_identifier_ranges );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize message_table_resource for tests
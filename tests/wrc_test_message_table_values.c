@@ -0,0 +1,411 @@
+/*
+ * Library message_table_values functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+#include "../libwrc/libwrc_data_descriptor.h"
+#include "../libwrc/libwrc_io_handle.h"
+#include "../libwrc/libwrc_language_entry.h"
+#include "../libwrc/libwrc_message_table_values.h"
+
+/* Message table with 1 entry descriptor for the messages 1 to 2
+ */
+uint8_t wrc_test_message_table_values_data1[ 32 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 'a', 'b', 'c', 0x00, 0x08, 0x00, 0x00, 0x00, 'd', 'e', 'f', 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+/* Tests the libwrc_message_table_values_read function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_message_table_values_read(
+     void )
+{
+	uint8_t data[ 32 ];
+
+	libwrc_data_descriptor_t data_descriptor;
+
+	libcerror_error_t *error                = NULL;
+	libwrc_io_handle_t *io_handle           = NULL;
+	libwrc_language_entry_t *language_entry = NULL;
+	int number_of_values                    = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_language_entry_initialize(
+	          &language_entry,
+	          0x00000409UL,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "language_entry",
+	 language_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_copy(
+	          data,
+	          wrc_test_message_table_values_data1,
+	          32 ) != NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	io_handle->virtual_address = 0x00001000UL;
+	io_handle->stream_data     = data;
+	io_handle->stream_size     = 32;
+
+	data_descriptor.virtual_address = 0x00001000UL;
+	data_descriptor.size            = 32;
+
+	/* Test regular cases
+	 */
+	result = libwrc_message_table_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_language_entry_get_number_of_values(
+	          language_entry,
+	          &number_of_values,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_message_table_values_read(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_message_table_values_read(
+	          language_entry,
+	          NULL,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_message_table_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where resource data is too small to contain the number of entry descriptors
+	 */
+	data_descriptor.size = 2;
+
+	result = libwrc_message_table_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	data_descriptor.size = 32;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the message string offset is out of bounds
+	 */
+	data[ 12 ] = 0x40;
+
+	result = libwrc_message_table_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	data[ 12 ] = 0x10;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the size of the second message string is out of bounds
+	 * This also checks that the message string offset is advanced
+	 */
+	data[ 24 ] = 0xff;
+	data[ 25 ] = 0xff;
+
+	result = libwrc_message_table_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the size of the second message string is too small
+	 */
+	data[ 24 ] = 0x02;
+	data[ 25 ] = 0x00;
+
+	result = libwrc_message_table_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	data[ 24 ] = 0x08;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_language_entry_free(
+	          &language_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "language_entry",
+	 language_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->stream_data = NULL;
+
+	result = libwrc_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( language_entry != NULL )
+	{
+		libwrc_language_entry_free(
+		 &language_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		io_handle->stream_data = NULL;
+
+		libwrc_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+	WRC_TEST_RUN(
+	 "libwrc_message_table_values_read",
+	 wrc_test_message_table_values_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
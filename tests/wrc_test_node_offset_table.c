@@ -0,0 +1,652 @@
+/*
+ * Library node_offset_table type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+#include "../libwrc/libwrc_node_offset_table.h"
+#include "../libwrc/libwrc_resource_node_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+/* Tests the libwrc_node_offset_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_node_offset_table_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libwrc_node_offset_table_t *node_offset_table = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwrc_node_offset_table_initialize(
+	          &node_offset_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "node_offset_table",
+	 node_offset_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_offset_table_free(
+	          &node_offset_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "node_offset_table",
+	 node_offset_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_node_offset_table_initialize(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node_offset_table = (libwrc_node_offset_table_t *) 0x12345678UL;
+
+	result = libwrc_node_offset_table_initialize(
+	          &node_offset_table,
+	          &error );
+
+	node_offset_table = NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_node_offset_table_initialize with malloc failing
+		 */
+		wrc_test_malloc_attempts_before_fail = test_number;
+
+		result = libwrc_node_offset_table_initialize(
+		          &node_offset_table,
+		          &error );
+
+		if( wrc_test_malloc_attempts_before_fail != -1 )
+		{
+			wrc_test_malloc_attempts_before_fail = -1;
+
+			if( node_offset_table != NULL )
+			{
+				libwrc_node_offset_table_free(
+				 &node_offset_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "node_offset_table",
+			 node_offset_table );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_node_offset_table_initialize with memset failing
+		 */
+		wrc_test_memset_attempts_before_fail = test_number;
+
+		result = libwrc_node_offset_table_initialize(
+		          &node_offset_table,
+		          &error );
+
+		if( wrc_test_memset_attempts_before_fail != -1 )
+		{
+			wrc_test_memset_attempts_before_fail = -1;
+
+			if( node_offset_table != NULL )
+			{
+				libwrc_node_offset_table_free(
+				 &node_offset_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "node_offset_table",
+			 node_offset_table );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WRC_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_offset_table != NULL )
+	{
+		libwrc_node_offset_table_free(
+		 &node_offset_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_node_offset_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_node_offset_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwrc_node_offset_table_free(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_node_offset_table_append_resource_node_entry, libwrc_node_offset_table_get_resource_node_entry_by_offset
+ * and libwrc_node_offset_table_remove_entries functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_node_offset_table_append_resource_node_entry(
+     void )
+{
+	libwrc_resource_node_entry_t resource_node_entries[ 100 ];
+
+	libcerror_error_t *error                          = NULL;
+	libwrc_node_offset_table_t *node_offset_table     = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	int entry_index                                   = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_node_offset_table_initialize(
+	          &node_offset_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "node_offset_table",
+	 node_offset_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+	          node_offset_table,
+	          0,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 100;
+	     entry_index++ )
+	{
+		result = libwrc_node_offset_table_append_resource_node_entry(
+		          node_offset_table,
+		          (uint32_t) ( entry_index * 16 ),
+		          &( resource_node_entries[ entry_index ] ),
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( entry_index = 0;
+	     entry_index < 100;
+	     entry_index++ )
+	{
+		resource_node_entry = NULL;
+
+		result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+		          node_offset_table,
+		          (uint32_t) ( entry_index * 16 ),
+		          &resource_node_entry,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_EQUAL_INTPTR(
+		 "resource_node_entry",
+		 (intptr_t) resource_node_entry,
+		 (intptr_t) &( resource_node_entries[ entry_index ] ) );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+	          node_offset_table,
+	          8,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_offset_table_remove_entries(
+	          node_offset_table,
+	          50,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+	          node_offset_table,
+	          49 * 16,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+	          node_offset_table,
+	          50 * 16,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test appending a removed offset again
+	 */
+	result = libwrc_node_offset_table_append_resource_node_entry(
+	          node_offset_table,
+	          50 * 16,
+	          &( resource_node_entries[ 0 ] ),
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+	          node_offset_table,
+	          50 * 16,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INTPTR(
+	 "resource_node_entry",
+	 (intptr_t) resource_node_entry,
+	 (intptr_t) &( resource_node_entries[ 0 ] ) );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_node_offset_table_append_resource_node_entry(
+	          NULL,
+	          0,
+	          &( resource_node_entries[ 0 ] ),
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_offset_table_append_resource_node_entry(
+	          node_offset_table,
+	          0,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+	          NULL,
+	          0,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_offset_table_get_resource_node_entry_by_offset(
+	          node_offset_table,
+	          0,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_offset_table_remove_entries(
+	          NULL,
+	          0,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_offset_table_remove_entries(
+	          node_offset_table,
+	          -1,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_node_offset_table_free(
+	          &node_offset_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "node_offset_table",
+	 node_offset_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_offset_table != NULL )
+	{
+		libwrc_node_offset_table_free(
+		 &node_offset_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+	WRC_TEST_RUN(
+	 "libwrc_node_offset_table_initialize",
+	 wrc_test_node_offset_table_initialize );
+
+	WRC_TEST_RUN(
+	 "libwrc_node_offset_table_free",
+	 wrc_test_node_offset_table_free );
+
+	WRC_TEST_RUN(
+	 "libwrc_node_offset_table_append_resource_node_entry",
+	 wrc_test_node_offset_table_append_resource_node_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,849 @@
+/*
+ * Library node_read_queue type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+#include "../libwrc/libwrc_node_read_queue.h"
+#include "../libwrc/libwrc_resource_node_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+/* Tests the libwrc_node_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_node_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libwrc_node_read_queue_t *node_read_queue = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwrc_node_read_queue_initialize(
+	          &node_read_queue,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "node_read_queue",
+	 node_read_queue );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_read_queue_free(
+	          &node_read_queue,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "node_read_queue",
+	 node_read_queue );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_node_read_queue_initialize(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node_read_queue = (libwrc_node_read_queue_t *) 0x12345678UL;
+
+	result = libwrc_node_read_queue_initialize(
+	          &node_read_queue,
+	          &error );
+
+	node_read_queue = NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_node_read_queue_initialize with malloc failing
+		 */
+		wrc_test_malloc_attempts_before_fail = test_number;
+
+		result = libwrc_node_read_queue_initialize(
+		          &node_read_queue,
+		          &error );
+
+		if( wrc_test_malloc_attempts_before_fail != -1 )
+		{
+			wrc_test_malloc_attempts_before_fail = -1;
+
+			if( node_read_queue != NULL )
+			{
+				libwrc_node_read_queue_free(
+				 &node_read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "node_read_queue",
+			 node_read_queue );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_node_read_queue_initialize with memset failing
+		 */
+		wrc_test_memset_attempts_before_fail = test_number;
+
+		result = libwrc_node_read_queue_initialize(
+		          &node_read_queue,
+		          &error );
+
+		if( wrc_test_memset_attempts_before_fail != -1 )
+		{
+			wrc_test_memset_attempts_before_fail = -1;
+
+			if( node_read_queue != NULL )
+			{
+				libwrc_node_read_queue_free(
+				 &node_read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "node_read_queue",
+			 node_read_queue );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WRC_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_read_queue != NULL )
+	{
+		libwrc_node_read_queue_free(
+		 &node_read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_node_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_node_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwrc_node_read_queue_free(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_node_read_queue_push and libwrc_node_read_queue_pop functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_node_read_queue_push(
+     void )
+{
+	libwrc_resource_node_entry_t resource_node_entries[ 100 ];
+
+	libcerror_error_t *error                          = NULL;
+	libwrc_node_read_queue_t *node_read_queue         = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	uint32_t last_offset                              = 0;
+	uint32_t offset                                   = 0;
+	int entry_index                                   = 0;
+	int last_entry_index                              = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_node_read_queue_initialize(
+	          &node_read_queue,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "node_read_queue",
+	 node_read_queue );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_node_read_queue_pop(
+	          node_read_queue,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Push the entries out of order, every offset is pushed twice
+	 */
+	for( entry_index = 0;
+	     entry_index < 100;
+	     entry_index++ )
+	{
+		result = libwrc_node_read_queue_push(
+		          node_read_queue,
+		          (uint32_t) ( ( ( entry_index * 37 ) % 50 ) * 16 ),
+		          &( resource_node_entries[ entry_index ] ),
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The entries are popped in order of their offset and entries with the same
+	 * offset in the order they were pushed
+	 */
+	for( entry_index = 0;
+	     entry_index < 100;
+	     entry_index++ )
+	{
+		resource_node_entry = NULL;
+
+		result = libwrc_node_read_queue_pop(
+		          node_read_queue,
+		          &offset,
+		          &resource_node_entry,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WRC_TEST_ASSERT_EQUAL_UINT32(
+		 "offset",
+		 offset,
+		 (uint32_t) ( ( entry_index / 2 ) * 16 ) );
+
+		WRC_TEST_ASSERT_IS_NOT_NULL(
+		 "resource_node_entry",
+		 resource_node_entry );
+
+		if( ( entry_index % 2 ) == 1 )
+		{
+			WRC_TEST_ASSERT_EQUAL_UINT32(
+			 "offset",
+			 offset,
+			 last_offset );
+
+			WRC_TEST_ASSERT_GREATER_THAN_INT(
+			 "entry index",
+			 (int) ( resource_node_entry - resource_node_entries ),
+			 last_entry_index );
+		}
+		last_offset      = offset;
+		last_entry_index = (int) ( resource_node_entry - resource_node_entries );
+	}
+	result = libwrc_node_read_queue_pop(
+	          node_read_queue,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_node_read_queue_push(
+	          NULL,
+	          0,
+	          &( resource_node_entries[ 0 ] ),
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_read_queue_push(
+	          node_read_queue,
+	          0,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_read_queue_pop(
+	          NULL,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_read_queue_pop(
+	          node_read_queue,
+	          NULL,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_read_queue_pop(
+	          node_read_queue,
+	          &offset,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_node_read_queue_free(
+	          &node_read_queue,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "node_read_queue",
+	 node_read_queue );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_read_queue != NULL )
+	{
+		libwrc_node_read_queue_free(
+		 &node_read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_node_read_queue_peek function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_node_read_queue_peek(
+     void )
+{
+	libwrc_resource_node_entry_t resource_node_entries[ 3 ];
+
+	libcerror_error_t *error                          = NULL;
+	libwrc_node_read_queue_t *node_read_queue         = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	uint32_t offset                                   = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_node_read_queue_initialize(
+	          &node_read_queue,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "node_read_queue",
+	 node_read_queue );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_node_read_queue_peek(
+	          node_read_queue,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_read_queue_push(
+	          node_read_queue,
+	          48,
+	          &( resource_node_entries[ 0 ] ),
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_read_queue_push(
+	          node_read_queue,
+	          16,
+	          &( resource_node_entries[ 1 ] ),
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_read_queue_push(
+	          node_read_queue,
+	          32,
+	          &( resource_node_entries[ 2 ] ),
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Peek does not remove the entry from the queue
+	 */
+	result = libwrc_node_read_queue_peek(
+	          node_read_queue,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "offset",
+	 offset,
+	 (uint32_t) 16 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "entry index",
+	 (int) ( resource_node_entry - resource_node_entries ),
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "node_read_queue->number_of_entries",
+	 node_read_queue->number_of_entries,
+	 3 );
+
+	result = libwrc_node_read_queue_pop(
+	          node_read_queue,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "offset",
+	 offset,
+	 (uint32_t) 16 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_node_read_queue_peek(
+	          node_read_queue,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "offset",
+	 offset,
+	 (uint32_t) 32 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "entry index",
+	 (int) ( resource_node_entry - resource_node_entries ),
+	 2 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_node_read_queue_peek(
+	          NULL,
+	          &offset,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_read_queue_peek(
+	          node_read_queue,
+	          NULL,
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_node_read_queue_peek(
+	          node_read_queue,
+	          &offset,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_node_read_queue_free(
+	          &node_read_queue,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "node_read_queue",
+	 node_read_queue );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_read_queue != NULL )
+	{
+		libwrc_node_read_queue_free(
+		 &node_read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+	WRC_TEST_RUN(
+	 "libwrc_node_read_queue_initialize",
+	 wrc_test_node_read_queue_initialize );
+
+	WRC_TEST_RUN(
+	 "libwrc_node_read_queue_free",
+	 wrc_test_node_read_queue_free );
+
+	WRC_TEST_RUN(
+	 "libwrc_node_read_queue_push",
+	 wrc_test_node_read_queue_push );
+
+	WRC_TEST_RUN(
+	 "libwrc_node_read_queue_peek",
+	 wrc_test_node_read_queue_peek );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+}
+
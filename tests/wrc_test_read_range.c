@@ -0,0 +1,467 @@
+/*
+ * Library read range functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+#include "../libwrc/libwrc_read_range.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+/* Tests the libwrc_read_range_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_read_range_sort(
+     void )
+{
+	libwrc_read_range_t read_ranges[ 5 ] = {
+		{ 4096, 16, 0 },
+		{ 0, 32, 1 },
+		{ 512, 8, 2 },
+		{ 0, 8, 3 },
+		{ 64, 4, 4 } };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_read_range_sort(
+	          read_ranges,
+	          5,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_INT64(
+	 "read_ranges[ 0 ].offset",
+	 (int64_t) read_ranges[ 0 ].offset,
+	 (int64_t) 0 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "read_ranges[ 0 ].request_index",
+	 read_ranges[ 0 ].request_index,
+	 1 );
+
+	/* Ranges with the same offset retain their order
+	 */
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "read_ranges[ 1 ].request_index",
+	 read_ranges[ 1 ].request_index,
+	 3 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "read_ranges[ 2 ].request_index",
+	 read_ranges[ 2 ].request_index,
+	 4 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "read_ranges[ 3 ].request_index",
+	 read_ranges[ 3 ].request_index,
+	 2 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "read_ranges[ 4 ].request_index",
+	 read_ranges[ 4 ].request_index,
+	 0 );
+
+	/* Test with sorted read ranges
+	 */
+	result = libwrc_read_range_sort(
+	          read_ranges,
+	          5,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "read_ranges[ 4 ].request_index",
+	 read_ranges[ 4 ].request_index,
+	 0 );
+
+	result = libwrc_read_range_sort(
+	          read_ranges,
+	          0,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_read_range_sort(
+	          NULL,
+	          5,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_read_range_sort(
+	          read_ranges,
+	          -1,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_read_range_get_coalesced_range function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_read_range_get_coalesced_range(
+     void )
+{
+	libwrc_read_range_t read_ranges[ 5 ] = {
+		{ 0, 32, 0 },
+		{ 16, 8, 1 },
+		{ 64, 4, 2 },
+		{ 512, 8, 3 },
+		{ 4096, 16, 4 } };
+
+	libcerror_error_t *error       = NULL;
+	size64_t coalesced_size        = 0;
+	int number_of_coalesced_ranges = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_read_range_get_coalesced_range(
+	          read_ranges,
+	          5,
+	          0,
+	          32,
+	          1024,
+	          &number_of_coalesced_ranges,
+	          &coalesced_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_coalesced_ranges",
+	 number_of_coalesced_ranges,
+	 3 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "coalesced_size",
+	 coalesced_size,
+	 (uint64_t) 68 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a larger maximum gap size
+	 */
+	result = libwrc_read_range_get_coalesced_range(
+	          read_ranges,
+	          5,
+	          0,
+	          512,
+	          1024,
+	          &number_of_coalesced_ranges,
+	          &coalesced_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_coalesced_ranges",
+	 number_of_coalesced_ranges,
+	 4 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "coalesced_size",
+	 coalesced_size,
+	 (uint64_t) 520 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a maximum size that is exceeded
+	 */
+	result = libwrc_read_range_get_coalesced_range(
+	          read_ranges,
+	          5,
+	          0,
+	          512,
+	          64,
+	          &number_of_coalesced_ranges,
+	          &coalesced_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_coalesced_ranges",
+	 number_of_coalesced_ranges,
+	 2 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "coalesced_size",
+	 coalesced_size,
+	 (uint64_t) 32 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with the last read range
+	 */
+	result = libwrc_read_range_get_coalesced_range(
+	          read_ranges,
+	          5,
+	          4,
+	          512,
+	          1024,
+	          &number_of_coalesced_ranges,
+	          &coalesced_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_coalesced_ranges",
+	 number_of_coalesced_ranges,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "coalesced_size",
+	 coalesced_size,
+	 (uint64_t) 16 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_read_range_get_coalesced_range(
+	          NULL,
+	          5,
+	          0,
+	          32,
+	          1024,
+	          &number_of_coalesced_ranges,
+	          &coalesced_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_read_range_get_coalesced_range(
+	          read_ranges,
+	          5,
+	          5,
+	          32,
+	          1024,
+	          &number_of_coalesced_ranges,
+	          &coalesced_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_read_range_get_coalesced_range(
+	          read_ranges,
+	          5,
+	          0,
+	          32,
+	          1024,
+	          NULL,
+	          &coalesced_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_read_range_get_coalesced_range(
+	          read_ranges,
+	          5,
+	          0,
+	          32,
+	          1024,
+	          &number_of_coalesced_ranges,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+	WRC_TEST_RUN(
+	 "libwrc_read_range_sort",
+	 wrc_test_read_range_sort );
+
+	WRC_TEST_RUN(
+	 "libwrc_read_range_get_coalesced_range",
+	 wrc_test_read_range_get_coalesced_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+}
+
@@ -46,7 +46,6 @@
 int wrc_test_resource_initialize(
      void )
 {
-	libcdata_tree_node_t *resource_node               = NULL;
 	libcerror_error_t *error                          = NULL;
 	libwrc_resource_t *resource                       = NULL;
 	libwrc_resource_node_entry_t *resource_node_entry = NULL;
@@ -77,46 +76,13 @@ int wrc_test_resource_initialize(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_initialize(
-	          &resource_node,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "resource_node",
-	 resource_node );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdata_tree_node_set_value(
-	          resource_node,
-	          (intptr_t *) resource_node_entry,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	resource_node_entry = NULL;
-
 	/* Test regular cases
 	 */
 	result = libwrc_resource_initialize(
 	          &resource,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -155,7 +121,7 @@ int wrc_test_resource_initialize(
 	          NULL,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -176,7 +142,7 @@ int wrc_test_resource_initialize(
 	          &resource,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -226,7 +192,7 @@ int wrc_test_resource_initialize(
 		          &resource,
 		          NULL,
 		          NULL,
-		          resource_node,
+		          resource_node_entry,
 		          &error );
 
 		if( wrc_test_malloc_attempts_before_fail != -1 )
@@ -271,7 +237,7 @@ int wrc_test_resource_initialize(
 		          &resource,
 		          NULL,
 		          NULL,
-		          resource_node,
+		          resource_node_entry,
 		          &error );
 
 		if( wrc_test_memset_attempts_before_fail != -1 )
@@ -308,9 +274,8 @@ int wrc_test_resource_initialize(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
-	          &resource_node,
-	          (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -319,8 +284,8 @@ int wrc_test_resource_initialize(
 	 1 );
 
 	WRC_TEST_ASSERT_IS_NULL(
-	 "resource_node",
-	 resource_node );
+	 "resource_node_entry",
+	 resource_node_entry );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -340,13 +305,6 @@ on_error:
 		 &resource,
 		 NULL );
 	}
-	if( resource_node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &resource_node,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
-		 NULL );
-	}
 	if( resource_node_entry != NULL )
 	{
 		libwrc_resource_node_entry_free(
@@ -1135,7 +1093,6 @@ int main(
 {
 #if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
 
-	libcdata_tree_node_t *resource_node               = NULL;
 	libcerror_error_t *error                          = NULL;
 	libwrc_resource_t *resource                       = NULL;
 	libwrc_resource_node_entry_t *resource_node_entry = NULL;
@@ -1195,59 +1152,9 @@ int main(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_initialize(
-	          &resource_node,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "resource_node",
-	 resource_node );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdata_tree_node_set_value(
-	          resource_node,
-	          (intptr_t *) resource_node_entry,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	resource_node_entry = NULL;
-
-	result = libwrc_resource_node_entry_initialize(
-	          &resource_node_entry,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "resource_node_entry",
-	 resource_node_entry );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdata_tree_node_append_value(
-	          resource_node,
-	          (intptr_t *) resource_node_entry,
+	result = libwrc_resource_node_entry_set_number_of_sub_entries(
+	          resource_node_entry,
+	          1,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1259,13 +1166,11 @@ int main(
 	 "error",
 	 error );
 
-	resource_node_entry = NULL;
-
 	result = libwrc_resource_initialize(
 	          &resource,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1352,9 +1257,8 @@ int main(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_free(
-	          &resource_node,
-	          (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1363,8 +1267,8 @@ int main(
 	 1 );
 
 	WRC_TEST_ASSERT_IS_NULL(
-	 "resource_node",
-	 resource_node );
+	 "resource_node_entry",
+	 resource_node_entry );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1388,13 +1292,6 @@ on_error:
 		 &resource,
 		 NULL );
 	}
-	if( resource_node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &resource_node,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
-		 NULL );
-	}
 	if( resource_node_entry != NULL )
 	{
 		libwrc_resource_node_entry_free(
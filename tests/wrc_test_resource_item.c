@@ -47,7 +47,6 @@
 int wrc_test_resource_item_initialize(
      void )
 {
-	libcdata_tree_node_t *resource_node               = NULL;
 	libcerror_error_t *error                          = NULL;
 	libwrc_resource_item_t *resource_item             = NULL;
 	libwrc_resource_node_entry_t *resource_node_entry = NULL;
@@ -78,46 +77,13 @@ int wrc_test_resource_item_initialize(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_initialize(
-	          &resource_node,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "resource_node",
-	 resource_node );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdata_tree_node_set_value(
-	          resource_node,
-	          (intptr_t *) resource_node_entry,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	resource_node_entry = NULL;
-
 	/* Test regular cases
 	 */
 	result = libwrc_resource_item_initialize(
 	          &resource_item,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -156,7 +122,7 @@ int wrc_test_resource_item_initialize(
 	          NULL,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -177,7 +143,7 @@ int wrc_test_resource_item_initialize(
 	          &resource_item,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -227,7 +193,7 @@ int wrc_test_resource_item_initialize(
 		          &resource_item,
 		          NULL,
 		          NULL,
-		          resource_node,
+		          resource_node_entry,
 		          &error );
 
 		if( wrc_test_malloc_attempts_before_fail != -1 )
@@ -272,7 +238,7 @@ int wrc_test_resource_item_initialize(
 		          &resource_item,
 		          NULL,
 		          NULL,
-		          resource_node,
+		          resource_node_entry,
 		          &error );
 
 		if( wrc_test_memset_attempts_before_fail != -1 )
@@ -309,9 +275,8 @@ int wrc_test_resource_item_initialize(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
-	          &resource_node,
-	          (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -320,8 +285,8 @@ int wrc_test_resource_item_initialize(
 	 1 );
 
 	WRC_TEST_ASSERT_IS_NULL(
-	 "resource_node",
-	 resource_node );
+	 "resource_node_entry",
+	 resource_node_entry );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -341,13 +306,6 @@ on_error:
 		 &resource_item,
 		 NULL );
 	}
-	if( resource_node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &resource_node,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
-		 NULL );
-	}
 	if( resource_node_entry != NULL )
 	{
 		libwrc_resource_node_entry_free(
@@ -1219,7 +1177,6 @@ int main(
 {
 #if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
 
-	libcdata_tree_node_t *resource_node               = NULL;
 	libcerror_error_t *error                          = NULL;
 	libwrc_data_descriptor_t *data_descriptor         = NULL;
 	libwrc_resource_item_t *resource_item             = NULL;
@@ -1304,59 +1261,9 @@ int main(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_initialize(
-	          &resource_node,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "resource_node",
-	 resource_node );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdata_tree_node_set_value(
-	          resource_node,
-	          (intptr_t *) resource_node_entry,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	resource_node_entry = NULL;
-
-	result = libwrc_resource_node_entry_initialize(
-	          &resource_node_entry,
-	          &error );
-
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "resource_node_entry",
-	 resource_node_entry );
-
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdata_tree_node_append_value(
-	          resource_node,
-	          (intptr_t *) resource_node_entry,
+	result = libwrc_resource_node_entry_set_number_of_sub_entries(
+	          resource_node_entry,
+	          1,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1368,13 +1275,11 @@ int main(
 	 "error",
 	 error );
 
-	resource_node_entry = NULL;
-
 	result = libwrc_resource_item_initialize(
 	          &resource_item,
 	          NULL,
 	          NULL,
-	          resource_node,
+	          resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1454,9 +1359,8 @@ int main(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_free(
-	          &resource_node,
-	          (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1465,8 +1369,8 @@ int main(
 	 1 );
 
 	WRC_TEST_ASSERT_IS_NULL(
-	 "resource_node",
-	 resource_node );
+	 "resource_node_entry",
+	 resource_node_entry );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1490,13 +1394,6 @@ on_error:
 		 &resource_item,
 		 NULL );
 	}
-	if( resource_node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &resource_node,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_resource_node_entry_free,
-		 NULL );
-	}
 	if( resource_node_entry != NULL )
 	{
 		libwrc_resource_node_entry_free(
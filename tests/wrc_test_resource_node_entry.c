@@ -845,6 +845,404 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libwrc_resource_node_entry_set_number_of_sub_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_node_entry_set_number_of_sub_entries(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	int number_of_sub_entries                         = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_resource_node_entry_initialize(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_node_entry",
+	 resource_node_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_resource_node_entry_set_number_of_sub_entries(
+	          resource_node_entry,
+	          3,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_resource_node_entry_get_number_of_sub_entries(
+	          resource_node_entry,
+	          &number_of_sub_entries,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_entries",
+	 number_of_sub_entries,
+	 3 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_resource_node_entry_set_number_of_sub_entries(
+	          NULL,
+	          3,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_node_entry_set_number_of_sub_entries(
+	          resource_node_entry,
+	          3,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_node_entry_get_number_of_sub_entries(
+	          NULL,
+	          &number_of_sub_entries,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_node_entry_get_number_of_sub_entries(
+	          resource_node_entry,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "resource_node_entry",
+	 resource_node_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_node_entry != NULL )
+	{
+		libwrc_resource_node_entry_free(
+		 &resource_node_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_resource_node_entry_sort_sub_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_node_entry_sort_sub_entries(
+     void )
+{
+	uint32_t expected_identifiers[ 5 ]                    = { 1, 2, 2, 3, 0x80000010UL };
+	uint32_t expected_offsets[ 5 ]                        = { 0x10, 0x30, 0x40, 0x20, 0x50 };
+	uint32_t identifiers[ 5 ]                             = { 0x80000010UL, 3, 2, 1, 2 };
+	uint32_t offsets[ 5 ]                                 = { 0x50, 0x20, 0x30, 0x10, 0x40 };
+	libcerror_error_t *error                              = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry     = NULL;
+	libwrc_resource_node_entry_t *sub_resource_node_entry = NULL;
+	int result                                            = 0;
+	int sub_entry_index                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_resource_node_entry_initialize(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_node_entry",
+	 resource_node_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_resource_node_entry_set_number_of_sub_entries(
+	          resource_node_entry,
+	          5,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sub_entry_index = 0;
+	     sub_entry_index < 5;
+	     sub_entry_index++ )
+	{
+		result = libwrc_resource_node_entry_get_sub_entry_by_index(
+		          resource_node_entry,
+		          sub_entry_index,
+		          &sub_resource_node_entry,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NOT_NULL(
+		 "sub_resource_node_entry",
+		 sub_resource_node_entry );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		sub_resource_node_entry->identifier = identifiers[ sub_entry_index ];
+		sub_resource_node_entry->offset     = offsets[ sub_entry_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libwrc_resource_node_entry_sort_sub_entries(
+	          resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sub_entry_index = 0;
+	     sub_entry_index < 5;
+	     sub_entry_index++ )
+	{
+		result = libwrc_resource_node_entry_get_sub_entry_by_index(
+		          resource_node_entry,
+		          sub_entry_index,
+		          &sub_resource_node_entry,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WRC_TEST_ASSERT_EQUAL_UINT32(
+		 "sub_resource_node_entry->identifier",
+		 sub_resource_node_entry->identifier,
+		 expected_identifiers[ sub_entry_index ] );
+
+		WRC_TEST_ASSERT_EQUAL_UINT32(
+		 "sub_resource_node_entry->offset",
+		 sub_resource_node_entry->offset,
+		 expected_offsets[ sub_entry_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libwrc_resource_node_entry_sort_sub_entries(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_node_entry_get_sub_entry_by_index(
+	          NULL,
+	          0,
+	          &sub_resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_node_entry_get_sub_entry_by_index(
+	          resource_node_entry,
+	          5,
+	          &sub_resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_node_entry_get_sub_entry_by_index(
+	          resource_node_entry,
+	          0,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "resource_node_entry",
+	 resource_node_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_node_entry != NULL )
+	{
+		libwrc_resource_node_entry_free(
+		 &resource_node_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libwrc_resource_node_entry_get_identifier function
  * Returns 1 if successful or 0 if not
  */
@@ -1359,6 +1757,14 @@ int main(
 	 "libwrc_resource_node_entry_set_name_string",
 	 wrc_test_resource_node_entry_set_name_string );
 
+	WRC_TEST_RUN(
+	 "libwrc_resource_node_entry_set_number_of_sub_entries",
+	 wrc_test_resource_node_entry_set_number_of_sub_entries );
+
+	WRC_TEST_RUN(
+	 "libwrc_resource_node_entry_sort_sub_entries",
+	 wrc_test_resource_node_entry_sort_sub_entries );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize resource_node_entry for tests
@@ -0,0 +1,1212 @@
+/*
+ * Library resource_table type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+#include "../libwrc/libwrc_resource_node_entry.h"
+#include "../libwrc/libwrc_resource_table.h"
+
+/* "MUI" as an UTF-16 little-endian stream
+ */
+uint8_t wrc_test_resource_table_name_data1[ 6 ] = {
+	0x4d, 0x00, 0x55, 0x00, 0x49, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+/* Creates a resource node entry with test sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_resource_table_create_resource_node_entry(
+     libwrc_resource_node_entry_t **resource_node_entry,
+     libcerror_error_t **error )
+{
+	int sub_entry_index = 0;
+
+	if( libwrc_resource_node_entry_initialize(
+	     resource_node_entry,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libwrc_resource_node_entry_set_number_of_sub_entries(
+	     *resource_node_entry,
+	     64,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( sub_entry_index = 0;
+	     sub_entry_index < 63;
+	     sub_entry_index++ )
+	{
+		( *resource_node_entry )->sub_entries[ sub_entry_index ].identifier = (uint32_t) ( 1 + ( sub_entry_index * 17 ) );
+		( *resource_node_entry )->sub_entries[ sub_entry_index ].type       = 1 + ( sub_entry_index * 17 );
+	}
+	( *resource_node_entry )->sub_entries[ 63 ].identifier = 0x80000020UL;
+	( *resource_node_entry )->sub_entries[ 63 ].type       = 0;
+
+	if( libwrc_resource_node_entry_set_name_string(
+	     &( ( *resource_node_entry )->sub_entries[ 63 ] ),
+	     wrc_test_resource_table_name_data1,
+	     6,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libwrc_resource_node_entry_free(
+	 resource_node_entry,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libwrc_resource_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_table_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	libwrc_resource_table_t *resource_table           = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 5;
+	int number_of_memset_fail_tests                   = 2;
+	int test_number                                   = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = wrc_test_resource_table_create_resource_node_entry(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_node_entry",
+	 resource_node_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_resource_table_initialize(
+	          &resource_table,
+	          resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_table",
+	 resource_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "resource_table->number_of_slots",
+	 resource_table->number_of_slots,
+	 (uint32_t) 128 );
+
+	result = libwrc_resource_table_free(
+	          &resource_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "resource_table",
+	 resource_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_resource_table_initialize(
+	          NULL,
+	          resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	resource_table = (libwrc_resource_table_t *) 0x12345678UL;
+
+	result = libwrc_resource_table_initialize(
+	          &resource_table,
+	          resource_node_entry,
+	          &error );
+
+	resource_table = NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_initialize(
+	          &resource_table,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_resource_table_initialize with malloc failing
+		 */
+		wrc_test_malloc_attempts_before_fail = test_number;
+
+		result = libwrc_resource_table_initialize(
+		          &resource_table,
+		          resource_node_entry,
+		          &error );
+
+		if( wrc_test_malloc_attempts_before_fail != -1 )
+		{
+			wrc_test_malloc_attempts_before_fail = -1;
+
+			if( resource_table != NULL )
+			{
+				libwrc_resource_table_free(
+				 &resource_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "resource_table",
+			 resource_table );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_resource_table_initialize with memset failing
+		 */
+		wrc_test_memset_attempts_before_fail = test_number;
+
+		result = libwrc_resource_table_initialize(
+		          &resource_table,
+		          resource_node_entry,
+		          &error );
+
+		if( wrc_test_memset_attempts_before_fail != -1 )
+		{
+			wrc_test_memset_attempts_before_fail = -1;
+
+			if( resource_table != NULL )
+			{
+				libwrc_resource_table_free(
+				 &resource_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "resource_table",
+			 resource_table );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WRC_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_table != NULL )
+	{
+		libwrc_resource_table_free(
+		 &resource_table,
+		 NULL );
+	}
+	if( resource_node_entry != NULL )
+	{
+		libwrc_resource_node_entry_free(
+		 &resource_node_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_resource_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwrc_resource_table_free(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_resource_table_get_name_hash_from_utf16_stream, libwrc_resource_table_get_name_hash_from_utf8_string
+ * and libwrc_resource_table_get_name_hash_from_utf16_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_table_get_name_hash(
+     void )
+{
+	uint16_t utf16_string[ 4 ] = { 'M', 'U', 'I', 0 };
+	libcerror_error_t *error   = NULL;
+	uint32_t name_hash         = 0;
+	uint32_t utf16_name_hash   = 0;
+	uint32_t utf8_name_hash    = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_resource_table_get_name_hash_from_utf16_stream(
+	          wrc_test_resource_table_name_data1,
+	          6,
+	          &name_hash,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_resource_table_get_name_hash_from_utf8_string(
+	          (uint8_t *) "MUI",
+	          4,
+	          &utf8_name_hash,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "utf8_name_hash",
+	 utf8_name_hash,
+	 name_hash );
+
+	result = libwrc_resource_table_get_name_hash_from_utf16_string(
+	          utf16_string,
+	          3,
+	          &utf16_name_hash,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_name_hash",
+	 utf16_name_hash,
+	 name_hash );
+
+	/* Test error cases
+	 */
+	result = libwrc_resource_table_get_name_hash_from_utf16_stream(
+	          NULL,
+	          6,
+	          &name_hash,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_get_name_hash_from_utf16_stream(
+	          wrc_test_resource_table_name_data1,
+	          6,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_get_name_hash_from_utf8_string(
+	          NULL,
+	          4,
+	          &name_hash,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_get_name_hash_from_utf16_string(
+	          NULL,
+	          3,
+	          &name_hash,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_resource_table_get_entry_by_identifier and libwrc_resource_table_get_entry_by_type functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_table_get_entry_by_identifier(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	libwrc_resource_node_entry_t *sub_entry           = NULL;
+	libwrc_resource_table_t *resource_table           = NULL;
+	int result                                        = 0;
+	int sub_entry_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = wrc_test_resource_table_create_resource_node_entry(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_resource_table_initialize(
+	          &resource_table,
+	          resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( sub_entry_index = 0;
+	     sub_entry_index < 63;
+	     sub_entry_index++ )
+	{
+		sub_entry = NULL;
+
+		result = libwrc_resource_table_get_entry_by_identifier(
+		          resource_table,
+		          (uint32_t) ( 1 + ( sub_entry_index * 17 ) ),
+		          &sub_entry,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_EQUAL_INTPTR(
+		 "sub_entry",
+		 (intptr_t) sub_entry,
+		 (intptr_t) &( resource_node_entry->sub_entries[ sub_entry_index ] ) );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		sub_entry = NULL;
+
+		result = libwrc_resource_table_get_entry_by_type(
+		          resource_table,
+		          1 + ( sub_entry_index * 17 ),
+		          &sub_entry,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_EQUAL_INTPTR(
+		 "sub_entry",
+		 (intptr_t) sub_entry,
+		 (intptr_t) &( resource_node_entry->sub_entries[ sub_entry_index ] ) );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwrc_resource_table_get_entry_by_identifier(
+	          resource_table,
+	          2,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_resource_table_get_entry_by_type(
+	          resource_table,
+	          2,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_resource_table_get_entry_by_identifier(
+	          NULL,
+	          1,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_get_entry_by_identifier(
+	          resource_table,
+	          1,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_get_entry_by_type(
+	          NULL,
+	          1,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_resource_table_free(
+	          &resource_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_table != NULL )
+	{
+		libwrc_resource_table_free(
+		 &resource_table,
+		 NULL );
+	}
+	if( resource_node_entry != NULL )
+	{
+		libwrc_resource_node_entry_free(
+		 &resource_node_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_resource_table_get_entry_by_identifier and libwrc_resource_table_get_entry_by_type functions with duplicate values
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_table_get_entry_by_identifier_duplicates(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	libwrc_resource_node_entry_t *sub_entry           = NULL;
+	libwrc_resource_table_t *resource_table           = NULL;
+	int result                                        = 0;
+	int sub_entry_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_resource_node_entry_initialize(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_resource_node_entry_set_number_of_sub_entries(
+	          resource_node_entry,
+	          1024,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* All sub entries have the same type and every pair of sub entries the same identifier
+	 */
+	for( sub_entry_index = 0;
+	     sub_entry_index < 1024;
+	     sub_entry_index++ )
+	{
+		resource_node_entry->sub_entries[ sub_entry_index ].identifier = (uint32_t) ( 1 + ( sub_entry_index / 2 ) );
+		resource_node_entry->sub_entries[ sub_entry_index ].type       = 0;
+	}
+	resource_node_entry->sub_entries[ 1023 ].type = 5;
+
+	result = libwrc_resource_table_initialize(
+	          &resource_table,
+	          resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( sub_entry_index = 0;
+	     sub_entry_index < 1024;
+	     sub_entry_index += 2 )
+	{
+		sub_entry = NULL;
+
+		result = libwrc_resource_table_get_entry_by_identifier(
+		          resource_table,
+		          (uint32_t) ( 1 + ( sub_entry_index / 2 ) ),
+		          &sub_entry,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_EQUAL_INTPTR(
+		 "sub_entry",
+		 (intptr_t) sub_entry,
+		 (intptr_t) &( resource_node_entry->sub_entries[ sub_entry_index ] ) );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	sub_entry = NULL;
+
+	result = libwrc_resource_table_get_entry_by_type(
+	          resource_table,
+	          0,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_entry",
+	 (intptr_t) sub_entry,
+	 (intptr_t) &( resource_node_entry->sub_entries[ 0 ] ) );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sub_entry = NULL;
+
+	result = libwrc_resource_table_get_entry_by_type(
+	          resource_table,
+	          5,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_entry",
+	 (intptr_t) sub_entry,
+	 (intptr_t) &( resource_node_entry->sub_entries[ 1023 ] ) );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwrc_resource_table_free(
+	          &resource_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_table != NULL )
+	{
+		libwrc_resource_table_free(
+		 &resource_table,
+		 NULL );
+	}
+	if( resource_node_entry != NULL )
+	{
+		libwrc_resource_node_entry_free(
+		 &resource_node_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_resource_table_get_entry_by_utf8_name and libwrc_resource_table_get_entry_by_utf16_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_resource_table_get_entry_by_name(
+     void )
+{
+	uint16_t utf16_string[ 4 ]                        = { 'M', 'U', 'I', 0 };
+	libcerror_error_t *error                          = NULL;
+	libwrc_resource_node_entry_t *resource_node_entry = NULL;
+	libwrc_resource_node_entry_t *sub_entry           = NULL;
+	libwrc_resource_table_t *resource_table           = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = wrc_test_resource_table_create_resource_node_entry(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_resource_table_initialize(
+	          &resource_table,
+	          resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_resource_table_get_entry_by_utf8_name(
+	          resource_table,
+	          (uint8_t *) "MUI",
+	          3,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_entry",
+	 (intptr_t) sub_entry,
+	 (intptr_t) &( resource_node_entry->sub_entries[ 63 ] ) );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sub_entry = NULL;
+
+	result = libwrc_resource_table_get_entry_by_utf16_name(
+	          resource_table,
+	          utf16_string,
+	          3,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_entry",
+	 (intptr_t) sub_entry,
+	 (intptr_t) &( resource_node_entry->sub_entries[ 63 ] ) );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_resource_table_get_entry_by_utf8_name(
+	          resource_table,
+	          (uint8_t *) "MUX",
+	          3,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_resource_table_get_entry_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "MUI",
+	          3,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_get_entry_by_utf8_name(
+	          resource_table,
+	          NULL,
+	          3,
+	          &sub_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_resource_table_get_entry_by_utf16_name(
+	          resource_table,
+	          utf16_string,
+	          3,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_resource_table_free(
+	          &resource_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_resource_node_entry_free(
+	          &resource_node_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_table != NULL )
+	{
+		libwrc_resource_table_free(
+		 &resource_table,
+		 NULL );
+	}
+	if( resource_node_entry != NULL )
+	{
+		libwrc_resource_node_entry_free(
+		 &resource_node_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+	WRC_TEST_RUN(
+	 "libwrc_resource_table_initialize",
+	 wrc_test_resource_table_initialize );
+
+	WRC_TEST_RUN(
+	 "libwrc_resource_table_free",
+	 wrc_test_resource_table_free );
+
+	WRC_TEST_RUN(
+	 "libwrc_resource_table_get_name_hash",
+	 wrc_test_resource_table_get_name_hash );
+
+	WRC_TEST_RUN(
+	 "libwrc_resource_table_get_entry_by_identifier",
+	 wrc_test_resource_table_get_entry_by_identifier );
+
+	WRC_TEST_RUN(
+	 "libwrc_resource_table_get_entry_by_identifier_duplicates",
+	 wrc_test_resource_table_get_entry_by_identifier_duplicates );
+
+	WRC_TEST_RUN(
+	 "libwrc_resource_table_get_entry_by_name",
+	 wrc_test_resource_table_get_entry_by_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,804 @@
+/*
+ * Library scaling test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_functions.h"
+#include "wrc_test_generator.h"
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+/* The factor between the sizes of the small and the large resource sections
+ */
+#define WRC_TEST_SCALING_FACTOR			16
+
+/* The number of times a resource section is opened, the fastest open is used
+ */
+#define WRC_TEST_SCALING_NUMBER_OF_RUNS		3
+
+/* The minimum open time in nano seconds, used to prevent the time ratio
+ * being dominated by the resolution of the clock
+ */
+#define WRC_TEST_SCALING_MINIMUM_OPEN_TIME	100000
+
+/* The margin of the open time ratio, which allows for cache effects and
+ * scheduling noise but is well below the scaling factor for quadratic growth
+ */
+#define WRC_TEST_SCALING_TIME_MARGIN		6
+
+/* Value to indicate the open times should be compared
+ * Timing depends on the load of the system, hence it is only compared
+ * if the WRC_TEST_SCALING_TIME environment variable is set
+ */
+int wrc_test_scaling_compare_time = 0;
+
+typedef struct wrc_test_scaling_measurement wrc_test_scaling_measurement_t;
+
+struct wrc_test_scaling_measurement
+{
+	/* The resource section size
+	 */
+	uint64_t data_size;
+
+	/* The (fastest) open time in nano seconds
+	 */
+	uint64_t open_time;
+
+	/* The number of reads
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read
+	 */
+	uint64_t read_size;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The maximum allocated size
+	 */
+	uint64_t maximum_allocated_size;
+
+	/* The number of resource node entries
+	 */
+	uint64_t number_of_node_entries;
+};
+
+/* Generates a resource section and measures opening it
+ * The resource section is opened using a file IO handle so that the reads are counted
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_scaling_measure_open(
+     const wrc_test_generator_parameters_t *parameters,
+     wrc_test_scaling_measurement_t *measurement,
+     libcerror_error_t **error )
+{
+	libwrc_statistics_t statistics;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libwrc_stream_t *stream          = NULL;
+	uint8_t *data                    = NULL;
+	static char *function            = "wrc_test_scaling_measure_open";
+	size_t data_size                 = 0;
+	uint64_t end_time                = 0;
+	uint64_t start_time              = 0;
+	int run_index                    = 0;
+
+	if( measurement == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid measurement.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     measurement,
+	     0,
+	     sizeof( wrc_test_scaling_measurement_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear measurement.",
+		 function );
+
+		return( -1 );
+	}
+	if( wrc_test_generate_resource_section(
+	     parameters,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to generate resource section.",
+		 function );
+
+		goto on_error;
+	}
+	measurement->data_size = (uint64_t) data_size;
+
+	if( wrc_test_open_file_io_handle(
+	     &file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	for( run_index = 0;
+	     run_index < WRC_TEST_SCALING_NUMBER_OF_RUNS;
+	     run_index++ )
+	{
+		if( libwrc_stream_initialize(
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_stream_set_virtual_address(
+		     stream,
+		     parameters->virtual_address,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set virtual address.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_test_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_stream_open_file_io_handle(
+		     stream,
+		     file_io_handle,
+		     LIBWRC_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( wrc_test_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( run_index == 0 )
+		 || ( ( end_time - start_time ) < measurement->open_time ) )
+		{
+			measurement->open_time = end_time - start_time;
+		}
+		if( libwrc_stream_get_statistics(
+		     stream,
+		     &statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics.",
+			 function );
+
+			goto on_error;
+		}
+		measurement->number_of_reads        = statistics.number_of_reads;
+		measurement->read_size              = statistics.read_size;
+		measurement->number_of_allocations  = statistics.number_of_allocations;
+		measurement->maximum_allocated_size = statistics.maximum_allocated_size;
+		measurement->number_of_node_entries = statistics.number_of_node_entries;
+
+		if( libwrc_stream_close(
+		     stream,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwrc_stream_free(
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( wrc_test_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		libwrc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		wrc_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Tests that opening a large resource section scales linearly compared to a small one
+ * The bounds allow for a constant overhead and noise but not for quadratic growth
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_compare(
+     const wrc_test_generator_parameters_t *small_parameters,
+     const wrc_test_generator_parameters_t *large_parameters )
+{
+	wrc_test_scaling_measurement_t large_measurement;
+	wrc_test_scaling_measurement_t small_measurement;
+
+	libcerror_error_t *error = NULL;
+	uint64_t small_open_time = 0;
+	int result               = 0;
+
+	result = wrc_test_scaling_measure_open(
+	          small_parameters,
+	          &small_measurement,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wrc_test_scaling_measure_open(
+	          large_parameters,
+	          &large_measurement,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The resource section must have grown for the comparison to be meaningful
+	 */
+	WRC_TEST_ASSERT_LESS_THAN_UINT64(
+	 "small_measurement.number_of_node_entries",
+	 small_measurement.number_of_node_entries,
+	 large_measurement.number_of_node_entries );
+
+	/* The number of node entries and reads should not grow faster than the size of the resource section
+	 */
+	WRC_TEST_ASSERT_LESS_THAN_UINT64(
+	 "large_measurement.number_of_node_entries",
+	 large_measurement.number_of_node_entries * small_measurement.data_size,
+	 2 * ( small_measurement.number_of_node_entries + 1 ) * large_measurement.data_size );
+
+	WRC_TEST_ASSERT_LESS_THAN_UINT64(
+	 "large_measurement.number_of_reads",
+	 large_measurement.number_of_reads * small_measurement.data_size,
+	 2 * ( small_measurement.number_of_reads + 1 ) * large_measurement.data_size );
+
+	WRC_TEST_ASSERT_LESS_THAN_UINT64(
+	 "large_measurement.read_size",
+	 large_measurement.read_size * small_measurement.data_size,
+	 2 * ( small_measurement.read_size + 1 ) * large_measurement.data_size );
+
+	/* The memory usage should not grow faster than the size of the resource section
+	 */
+	WRC_TEST_ASSERT_LESS_THAN_UINT64(
+	 "large_measurement.maximum_allocated_size",
+	 large_measurement.maximum_allocated_size * small_measurement.data_size,
+	 2 * ( small_measurement.maximum_allocated_size + 1 ) * large_measurement.data_size );
+
+	WRC_TEST_ASSERT_LESS_THAN_UINT64(
+	 "large_measurement.number_of_allocations",
+	 large_measurement.number_of_allocations * small_measurement.data_size,
+	 2 * ( small_measurement.number_of_allocations + 1 ) * large_measurement.data_size );
+
+	/* The open time should not grow faster than the size of the resource section
+	 */
+	if( wrc_test_scaling_compare_time != 0 )
+	{
+		small_open_time = small_measurement.open_time;
+
+		if( small_open_time < WRC_TEST_SCALING_MINIMUM_OPEN_TIME )
+		{
+			small_open_time = WRC_TEST_SCALING_MINIMUM_OPEN_TIME;
+		}
+		WRC_TEST_ASSERT_LESS_THAN_UINT64(
+		 "large_measurement.open_time",
+		 large_measurement.open_time * small_measurement.data_size,
+		 WRC_TEST_SCALING_TIME_MARGIN * small_open_time * large_measurement.data_size );
+	}
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Sets the parameters of a resource section without resources
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_set_empty_parameters(
+     wrc_test_generator_parameters_t *parameters )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = wrc_test_generator_parameters_set_defaults(
+	          parameters,
+	          1,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	parameters->virtual_address         = 0x00004000UL;
+	parameters->number_of_string_tables = 0;
+	parameters->number_of_messages      = 0;
+	parameters->number_of_named_types   = 0;
+	parameters->number_of_languages     = 1;
+	parameters->has_version_information = 0;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests scaling with the number of string tables
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_string_tables(
+     void )
+{
+	wrc_test_generator_parameters_t large_parameters;
+	wrc_test_generator_parameters_t small_parameters;
+
+	int result = 0;
+
+	result = wrc_test_scaling_set_empty_parameters(
+	          &small_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	small_parameters.number_of_string_tables = 3125;
+
+	large_parameters = small_parameters;
+
+	large_parameters.number_of_string_tables *= WRC_TEST_SCALING_FACTOR;
+
+	result = wrc_test_scaling_compare(
+	          &small_parameters,
+	          &large_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests scaling with the number of messages
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_messages(
+     void )
+{
+	wrc_test_generator_parameters_t large_parameters;
+	wrc_test_generator_parameters_t small_parameters;
+
+	int result = 0;
+
+	result = wrc_test_scaling_set_empty_parameters(
+	          &small_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The message tables are stored per language and string table blocks
+	 * are added since a single message table resource has a fixed number
+	 * of node entries
+	 */
+	small_parameters.number_of_messages      = 6250;
+	small_parameters.number_of_string_tables = 1;
+	small_parameters.number_of_languages     = 1;
+
+	large_parameters = small_parameters;
+
+	large_parameters.number_of_messages      *= WRC_TEST_SCALING_FACTOR;
+	large_parameters.number_of_string_tables *= WRC_TEST_SCALING_FACTOR;
+
+	result = wrc_test_scaling_compare(
+	          &small_parameters,
+	          &large_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests scaling with the number of named types
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_named_types(
+     void )
+{
+	wrc_test_generator_parameters_t large_parameters;
+	wrc_test_generator_parameters_t small_parameters;
+
+	int result = 0;
+
+	result = wrc_test_scaling_set_empty_parameters(
+	          &small_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	small_parameters.number_of_named_types = 1000;
+
+	large_parameters = small_parameters;
+
+	large_parameters.number_of_named_types *= WRC_TEST_SCALING_FACTOR;
+
+	result = wrc_test_scaling_compare(
+	          &small_parameters,
+	          &large_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests scaling with the number of languages
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_languages(
+     void )
+{
+	wrc_test_generator_parameters_t large_parameters;
+	wrc_test_generator_parameters_t small_parameters;
+
+	int result = 0;
+
+	result = wrc_test_scaling_set_empty_parameters(
+	          &small_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	small_parameters.number_of_string_tables = 64;
+	small_parameters.number_of_messages      = 64;
+	small_parameters.number_of_languages     = 4;
+	small_parameters.has_version_information = 1;
+
+	large_parameters = small_parameters;
+
+	large_parameters.number_of_languages *= WRC_TEST_SCALING_FACTOR;
+
+	result = wrc_test_scaling_compare(
+	          &small_parameters,
+	          &large_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests scaling with the depth of a nested resource tree where all entries
+ * of a node reference the same sub node
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_nested_tree(
+     void )
+{
+	wrc_test_generator_parameters_t large_parameters;
+	wrc_test_generator_parameters_t small_parameters;
+
+	int result = 0;
+
+	result = wrc_test_scaling_set_empty_parameters(
+	          &small_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	small_parameters.tree_depth = WRC_TEST_GENERATOR_MAXIMUM_TREE_DEPTH / WRC_TEST_SCALING_FACTOR;
+	small_parameters.tree_width = 64;
+
+	large_parameters = small_parameters;
+
+	large_parameters.tree_depth *= WRC_TEST_SCALING_FACTOR;
+
+	result = wrc_test_scaling_compare(
+	          &small_parameters,
+	          &large_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests scaling with the scale factor of the default parameters
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_scaling_scale_factor(
+     void )
+{
+	wrc_test_generator_parameters_t large_parameters;
+	wrc_test_generator_parameters_t small_parameters;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = wrc_test_generator_parameters_set_defaults(
+	          &small_parameters,
+	          4,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wrc_test_generator_parameters_set_defaults(
+	          &large_parameters,
+	          4 * WRC_TEST_SCALING_FACTOR,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wrc_test_scaling_compare(
+	          &small_parameters,
+	          &large_parameters );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( getenv(
+	     "WRC_TEST_SCALING_TIME" ) != NULL )
+	{
+		wrc_test_scaling_compare_time = 1;
+	}
+	WRC_TEST_RUN(
+	 "string tables",
+	 wrc_test_scaling_string_tables );
+
+	WRC_TEST_RUN(
+	 "messages",
+	 wrc_test_scaling_messages );
+
+	WRC_TEST_RUN(
+	 "named types",
+	 wrc_test_scaling_named_types );
+
+	WRC_TEST_RUN(
+	 "languages",
+	 wrc_test_scaling_languages );
+
+	WRC_TEST_RUN(
+	 "nested tree",
+	 wrc_test_scaling_nested_tree );
+
+	WRC_TEST_RUN(
+	 "scale factor",
+	 wrc_test_scaling_scale_factor );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -34,6 +35,7 @@
 #include "wrc_test_getopt.h"
 #include "wrc_test_libbfio.h"
 #include "wrc_test_libcerror.h"
+#include "wrc_test_libcthreads.h"
 #include "wrc_test_libwrc.h"
 #include "wrc_test_macros.h"
 #include "wrc_test_memory.h"
@@ -56,10 +58,24 @@ int libwrc_stream_open_file_io_handle(
 #error Unsupported size of wchar_t
 #endif
 
+/* Resource node tree with both resource types referencing the same resource node
+ */
+uint8_t wrc_test_stream_shared_nodes_data1[ 100 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x04, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+	0x60, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x03, 0x04 };
+
 /* Define to make wrc_test_stream generate verbose output
 #define WRC_TEST_STREAM_VERBOSE
  */
 
+#define WRC_TEST_STREAM_NUMBER_OF_ITERATIONS	16
+#define WRC_TEST_STREAM_NUMBER_OF_THREADS	4
+
 /* Creates and opens a source stream
  * Returns 1 if successful or -1 on error
  */
@@ -200,6 +216,201 @@ int wrc_test_stream_close_source(
 	return( result );
 }
 
+/* Reads the data of a source into memory
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_stream_read_source_data(
+     const system_character_t *source,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "wrc_test_stream_read_source_data";
+	size64_t source_size             = 0;
+	size_t source_length             = 0;
+	ssize_t read_count               = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	source_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     source,
+	     source_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     source,
+	     source_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &source_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( source_size == 0 )
+	 || ( source_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*data = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * (size_t) source_size );
+
+	if( *data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              *data,
+	              (size_t) source_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) source_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	*data_size = (size_t) source_size;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Tests the libwrc_stream_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -511,6 +722,14 @@ int wrc_test_stream_open(
 	 "error",
 	 error );
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+	/* A file is only mapped into memory when requested
+	 */
+	WRC_TEST_ASSERT_IS_NULL(
+	 "internal_stream->mapped_data",
+	 ( (libwrc_internal_stream_t *) stream )->mapped_data );
+#endif
+
 	/* Test error cases
 	 */
 	result = libwrc_stream_open(
@@ -587,6 +806,57 @@ int wrc_test_stream_open(
 	libcerror_error_free(
 	 &error );
 
+	result = libwrc_stream_close(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with the file mapped into memory
+	 */
+	result = libwrc_stream_open(
+	          stream,
+	          narrow_source,
+	          LIBWRC_OPEN_READ | LIBWRC_ACCESS_FLAG_MAP_FILE,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+	/* A regular file is mapped into memory
+	 */
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_stream->mapped_data",
+	 ( (libwrc_internal_stream_t *) stream )->mapped_data );
+#endif
+
+	result = libwrc_stream_close(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Clean up
 	 */
 	result = libwrc_stream_free(
@@ -623,26 +893,28 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libwrc_stream_open_wide function
+/* Tests the libwrc_stream_open function with read on demand
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_stream_open_wide(
+int wrc_test_stream_open_read_on_demand(
      const system_character_t *source,
      uint32_t virtual_address )
 {
-	wchar_t wide_source[ 256 ];
+	char narrow_source[ 256 ];
 
-	libcerror_error_t *error = NULL;
-	libwrc_stream_t *stream  = NULL;
-	int result               = 0;
+	libcerror_error_t *error    = NULL;
+	libwrc_resource_t *resource = NULL;
+	libwrc_stream_t *stream     = NULL;
+	int number_of_items         = 0;
+	int number_of_resources     = 0;
+	int resource_index          = 0;
+	int result                  = 0;
 
 	/* Initialize test
 	 */
-	result = wrc_test_get_wide_source(
+	result = wrc_test_get_narrow_source(
 	          source,
-	          wide_source,
+	          narrow_source,
 	          256,
 	          &error );
 
@@ -688,10 +960,10 @@ int wrc_test_stream_open_wide(
 
 	/* Test open
 	 */
-	result = libwrc_stream_open_wide(
+	result = libwrc_stream_open(
 	          stream,
-	          wide_source,
-	          LIBWRC_OPEN_READ,
+	          narrow_source,
+	          LIBWRC_OPEN_READ_ON_DEMAND,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -703,49 +975,263 @@ int wrc_test_stream_open_wide(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libwrc_stream_open_wide(
-	          NULL,
-	          wide_source,
-	          LIBWRC_OPEN_READ,
+	result = libwrc_stream_get_number_of_resources(
+	          stream,
+	          &number_of_resources,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libwrc_stream_open_wide(
-	          stream,
-	          NULL,
-	          LIBWRC_OPEN_READ,
-	          &error );
+	/* Test retrieving the resources which reads the sub nodes
+	 */
+	for( resource_index = 0;
+	     resource_index < number_of_resources;
+	     resource_index++ )
+	{
+		result = libwrc_stream_get_resource_by_index(
+		          stream,
+		          resource_index,
+		          &resource,
+		          &error );
 
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		WRC_TEST_ASSERT_IS_NOT_NULL(
+		 "resource",
+		 resource );
 
-	libcerror_error_free(
-	 &error );
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libwrc_stream_open_wide(
-	          stream,
-	          wide_source,
-	          -1,
-	          &error );
+		result = libwrc_resource_get_number_of_items(
+		          resource,
+		          &number_of_items,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_NOT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 0 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwrc_resource_free(
+		          &resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libwrc_stream_close(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_free(
+	          &stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource != NULL )
+	{
+		libwrc_resource_free(
+		 &resource,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		libwrc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libwrc_stream_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_open_wide(
+     const system_character_t *source,
+     uint32_t virtual_address )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libwrc_stream_t *stream  = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = wrc_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_initialize(
+	          &stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_set_virtual_address(
+	          stream,
+	          virtual_address,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libwrc_stream_open_wide(
+	          stream,
+	          wide_source,
+	          LIBWRC_OPEN_READ,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+	/* A file is only mapped into memory when requested
+	 */
+	WRC_TEST_ASSERT_IS_NULL(
+	 "internal_stream->mapped_data",
+	 ( (libwrc_internal_stream_t *) stream )->mapped_data );
+#endif
+
+	/* Test error cases
+	 */
+	result = libwrc_stream_open_wide(
+	          NULL,
+	          wide_source,
+	          LIBWRC_OPEN_READ,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_open_wide(
+	          stream,
+	          NULL,
+	          LIBWRC_OPEN_READ,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_open_wide(
+	          stream,
+	          wide_source,
+	          -1,
+	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -779,6 +1265,57 @@ int wrc_test_stream_open_wide(
 	libcerror_error_free(
 	 &error );
 
+	result = libwrc_stream_close(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with the file mapped into memory
+	 */
+	result = libwrc_stream_open_wide(
+	          stream,
+	          wide_source,
+	          LIBWRC_OPEN_READ | LIBWRC_ACCESS_FLAG_MAP_FILE,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+	/* A regular file is mapped into memory
+	 */
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_stream->mapped_data",
+	 ( (libwrc_internal_stream_t *) stream )->mapped_data );
+#endif
+
+	result = libwrc_stream_close(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Clean up
 	 */
 	result = libwrc_stream_free(
@@ -1057,57 +1594,41 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libwrc_stream_close function
+/* Tests the libwrc_stream_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_stream_close(
-     void )
+int wrc_test_stream_open_memory(
+     const system_character_t *source,
+     uint32_t virtual_address )
 {
 	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libwrc_stream_t *stream  = NULL;
+	uint8_t *data            = NULL;
+	size_t data_size         = 0;
+	int number_of_resources  = 0;
+	int result               = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libwrc_stream_close(
-	          NULL,
+	result = wrc_test_stream_read_source_data(
+	          source,
+	          &data,
+	          &data_size,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libwrc_stream_open and libwrc_stream_close functions
- * Returns 1 if successful or 0 if not
- */
-int wrc_test_stream_open_close(
-     const system_character_t *source,
-     uint32_t virtual_address )
-{
-	libcerror_error_t *error = NULL;
-	libwrc_stream_t *stream  = NULL;
-	int result               = 0;
-
-	/* Initialize test
-	 */
 	result = libwrc_stream_initialize(
 	          &stream,
 	          &error );
@@ -1139,31 +1660,64 @@ int wrc_test_stream_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libwrc_stream_open_wide(
+	result = libwrc_stream_open_memory(
 	          stream,
-	          source,
+	          data,
+	          data_size,
 	          LIBWRC_OPEN_READ,
 	          &error );
-#else
-	result = libwrc_stream_open(
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_get_number_of_resources(
 	          stream,
-	          source,
-	          LIBWRC_OPEN_READ,
+	          &number_of_resources,
 	          &error );
-#endif
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
+	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_resources",
+	 number_of_resources,
+	 0 );
+
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	/* Test open when already opened
+	 */
+	result = libwrc_stream_open_memory(
+	          stream,
+	          data,
+	          data_size,
+	          LIBWRC_OPEN_READ,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	result = libwrc_stream_close(
 	          stream,
 	          &error );
@@ -1177,44 +1731,84 @@ int wrc_test_stream_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libwrc_stream_open_wide(
+	result = libwrc_stream_open_memory(
+	          NULL,
+	          data,
+	          data_size,
+	          LIBWRC_OPEN_READ,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_open_memory(
 	          stream,
-	          source,
+	          NULL,
+	          data_size,
 	          LIBWRC_OPEN_READ,
 	          &error );
-#else
-	result = libwrc_stream_open(
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_open_memory(
 	          stream,
-	          source,
+	          data,
+	          0,
 	          LIBWRC_OPEN_READ,
 	          &error );
-#endif
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	WRC_TEST_ASSERT_IS_NULL(
+	WRC_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libwrc_stream_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_open_memory(
 	          stream,
+	          data,
+	          data_size,
+	          -1,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	WRC_TEST_ASSERT_IS_NULL(
+	WRC_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libwrc_stream_free(
@@ -1234,6 +1828,9 @@ int wrc_test_stream_open_close(
 	 "error",
 	 error );
 
+	memory_free(
+	 data );
+
 	return( 1 );
 
 on_error:
@@ -1248,22 +1845,54 @@ on_error:
 		 &stream,
 		 NULL );
 	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
 	return( 0 );
 }
 
-/* Tests the libwrc_stream_signal_abort function
+/* Tests opening a stream with resource nodes that are referenced more than once
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_stream_signal_abort(
-     libwrc_stream_t *stream )
+int wrc_test_stream_open_shared_nodes(
+     void )
 {
+	uint8_t stream_data[ 100 ];
+
 	libcerror_error_t *error = NULL;
+	libwrc_stream_t *stream  = NULL;
+	int number_of_resources  = 0;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libwrc_stream_signal_abort(
+	memory_copy(
+	 stream_data,
+	 wrc_test_stream_shared_nodes_data1,
+	 100 );
+
+	result = libwrc_stream_initialize(
+	          &stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_set_virtual_address(
 	          stream,
+	          0x1000,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1275,66 +1904,63 @@ int wrc_test_stream_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open with both resource types referencing the same resource node
 	 */
-	result = libwrc_stream_signal_abort(
-	          NULL,
+	result = libwrc_stream_open_memory(
+	          stream,
+	          stream_data,
+	          100,
+	          LIBWRC_OPEN_READ,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libwrc_stream_get_number_of_resources(
+	          stream,
+	          &number_of_resources,
+	          &error );
 
-	return( 1 );
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_resources",
+	 number_of_resources,
+	 2 );
 
-/* Tests the libwrc_stream_get_ascii_codepage function
- * Returns 1 if successful or 0 if not
- */
-int wrc_test_stream_get_ascii_codepage(
-     libwrc_stream_t *stream )
-{
-	libcerror_error_t *error = NULL;
-	int ascii_codepage       = 0;
-	int result               = 0;
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libwrc_stream_get_ascii_codepage(
+	result = libwrc_stream_close(
 	          stream,
-	          &ascii_codepage,
 	          &error );
 
-	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open with rejecting shared resource nodes
 	 */
-	result = libwrc_stream_get_ascii_codepage(
-	          NULL,
-	          &ascii_codepage,
+	result = libwrc_stream_open_memory(
+	          stream,
+	          stream_data,
+	          100,
+	          LIBWRC_OPEN_READ | LIBWRC_ACCESS_FLAG_REJECT_SHARED_NODES,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1349,9 +1975,16 @@ int wrc_test_stream_get_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	result = libwrc_stream_get_ascii_codepage(
+	/* Test open with a resource node that references itself
+	 */
+	stream_data[ 52 ] = 0x20;
+	stream_data[ 55 ] = 0x80;
+
+	result = libwrc_stream_open_memory(
 	          stream,
-	          NULL,
+	          stream_data,
+	          100,
+	          LIBWRC_OPEN_READ,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1366,6 +1999,25 @@ int wrc_test_stream_get_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libwrc_stream_free(
+	          &stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1374,67 +2026,1202 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( stream != NULL )
+	{
+		libwrc_stream_free(
+		 &stream,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libwrc_stream_set_ascii_codepage function
+/* Tests the libwrc_stream_close function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwrc_stream_close(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_open and libwrc_stream_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_open_close(
+     const system_character_t *source,
+     uint32_t virtual_address )
+{
+	libcerror_error_t *error = NULL;
+	libwrc_stream_t *stream  = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_stream_initialize(
+	          &stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_set_virtual_address(
+	          stream,
+	          virtual_address,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libwrc_stream_open_wide(
+	          stream,
+	          source,
+	          LIBWRC_OPEN_READ,
+	          &error );
+#else
+	result = libwrc_stream_open(
+	          stream,
+	          source,
+	          LIBWRC_OPEN_READ,
+	          &error );
+#endif
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_close(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libwrc_stream_open_wide(
+	          stream,
+	          source,
+	          LIBWRC_OPEN_READ,
+	          &error );
+#else
+	result = libwrc_stream_open(
+	          stream,
+	          source,
+	          LIBWRC_OPEN_READ,
+	          &error );
+#endif
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_stream_close(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwrc_stream_free(
+	          &stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libwrc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_signal_abort(
+     libwrc_stream_t *stream )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_stream_signal_abort(
+	          stream,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_stream_signal_abort(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_get_ascii_codepage(
+     libwrc_stream_t *stream )
+{
+	libcerror_error_t *error = NULL;
+	int ascii_codepage       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_stream_get_ascii_codepage(
+	          stream,
+	          &ascii_codepage,
+	          &error );
+
+	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_stream_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_get_ascii_codepage(
+	          stream,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_set_ascii_codepage(
+     libwrc_stream_t *stream )
+{
+	int supported_codepages[ 15 ] = {
+		LIBWRC_CODEPAGE_ASCII,
+		LIBWRC_CODEPAGE_WINDOWS_874,
+		LIBWRC_CODEPAGE_WINDOWS_932,
+		LIBWRC_CODEPAGE_WINDOWS_936,
+		LIBWRC_CODEPAGE_WINDOWS_949,
+		LIBWRC_CODEPAGE_WINDOWS_950,
+		LIBWRC_CODEPAGE_WINDOWS_1250,
+		LIBWRC_CODEPAGE_WINDOWS_1251,
+		LIBWRC_CODEPAGE_WINDOWS_1252,
+		LIBWRC_CODEPAGE_WINDOWS_1253,
+		LIBWRC_CODEPAGE_WINDOWS_1254,
+		LIBWRC_CODEPAGE_WINDOWS_1255,
+		LIBWRC_CODEPAGE_WINDOWS_1256,
+		LIBWRC_CODEPAGE_WINDOWS_1257,
+		LIBWRC_CODEPAGE_WINDOWS_1258 };
+
+	int unsupported_codepages[ 17 ] = {
+		LIBWRC_CODEPAGE_ISO_8859_1,
+		LIBWRC_CODEPAGE_ISO_8859_2,
+		LIBWRC_CODEPAGE_ISO_8859_3,
+		LIBWRC_CODEPAGE_ISO_8859_4,
+		LIBWRC_CODEPAGE_ISO_8859_5,
+		LIBWRC_CODEPAGE_ISO_8859_6,
+		LIBWRC_CODEPAGE_ISO_8859_7,
+		LIBWRC_CODEPAGE_ISO_8859_8,
+		LIBWRC_CODEPAGE_ISO_8859_9,
+		LIBWRC_CODEPAGE_ISO_8859_10,
+		LIBWRC_CODEPAGE_ISO_8859_11,
+		LIBWRC_CODEPAGE_ISO_8859_13,
+		LIBWRC_CODEPAGE_ISO_8859_14,
+		LIBWRC_CODEPAGE_ISO_8859_15,
+		LIBWRC_CODEPAGE_ISO_8859_16,
+		LIBWRC_CODEPAGE_KOI8_R,
+		LIBWRC_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = libwrc_stream_set_ascii_codepage(
+		          stream,
+		          codepage,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libwrc_stream_set_ascii_codepage(
+	          NULL,
+	          LIBWRC_CODEPAGE_ASCII,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = libwrc_stream_set_ascii_codepage(
+		          stream,
+		          codepage,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WRC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libwrc_stream_set_ascii_codepage(
+	          stream,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_get_virtual_address function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_get_virtual_address(
+     libwrc_stream_t *stream )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t virtual_address = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_stream_get_virtual_address(
+	          stream,
+	          &virtual_address,
+	          &error );
+
+	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_stream_get_virtual_address(
+	          NULL,
+	          &virtual_address,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_get_virtual_address(
+	          stream,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_get_number_of_resources function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_get_number_of_resources(
+     libwrc_stream_t *stream )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_resources  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_stream_get_number_of_resources(
+	          stream,
+	          &number_of_resources,
+	          &error );
+
+	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_stream_get_number_of_resources(
+	          NULL,
+	          &number_of_resources,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_get_number_of_resources(
+	          stream,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_get_resource_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_get_resource_by_index(
+     libwrc_stream_t *stream )
+{
+	libcerror_error_t *error    = NULL;
+	libwrc_resource_t *resource = NULL;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_stream_get_resource_by_index(
+	          stream,
+	          0,
+	          &resource,
+	          &error );
+
+	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "resource",
+	 resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_resource_free(
+	          &resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "resource",
+	 resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_stream_get_resource_by_index(
+	          NULL,
+	          0,
+	          &resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_get_resource_by_index(
+	          stream,
+	          -1,
+	          &resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_get_resource_by_index(
+	          stream,
+	          0,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_get_resource_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_get_resource_by_identifier(
+     libwrc_stream_t *stream )
+{
+	libcerror_error_t *error    = NULL;
+	libwrc_resource_t *resource = NULL;
+	int result                  = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+	libwrc_resource_table_t *resource_table = NULL;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwrc_stream_get_resource_by_identifier(
+	          stream,
+	          0x0000038eUL,
+	          &resource,
+	          &error );
+
+	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	if( result == 0 )
+	{
+		WRC_TEST_ASSERT_IS_NULL(
+		 "resource",
+		 resource );
+	}
+	else
+	{
+		WRC_TEST_ASSERT_IS_NOT_NULL(
+		 "resource",
+		 resource );
+	}
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( resource != NULL )
+	{
+		result = libwrc_resource_free(
+		          &resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "resource",
+		 resource );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libwrc_stream_get_resource_by_identifier(
+	          NULL,
+	          0x0000038eUL,
+	          &resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_get_resource_by_identifier(
+	          stream,
+	          0x0000038eUL,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+	/* Test libwrc_stream_get_resource_by_identifier with a missing resource table
+	 */
+	resource_table = ( (libwrc_internal_stream_t *) stream )->resource_table;
+
+	( (libwrc_internal_stream_t *) stream )->resource_table = NULL;
+
+	result = libwrc_stream_get_resource_by_identifier(
+	          stream,
+	          0x0000038eUL,
+	          &resource,
+	          &error );
+
+	( (libwrc_internal_stream_t *) stream )->resource_table = resource_table;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "resource",
+	 resource );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_stream_get_resource_by_type function
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_stream_set_ascii_codepage(
+int wrc_test_stream_get_resource_by_type(
      libwrc_stream_t *stream )
 {
-	int supported_codepages[ 15 ] = {
-		LIBWRC_CODEPAGE_ASCII,
-		LIBWRC_CODEPAGE_WINDOWS_874,
-		LIBWRC_CODEPAGE_WINDOWS_932,
-		LIBWRC_CODEPAGE_WINDOWS_936,
-		LIBWRC_CODEPAGE_WINDOWS_949,
-		LIBWRC_CODEPAGE_WINDOWS_950,
-		LIBWRC_CODEPAGE_WINDOWS_1250,
-		LIBWRC_CODEPAGE_WINDOWS_1251,
-		LIBWRC_CODEPAGE_WINDOWS_1252,
-		LIBWRC_CODEPAGE_WINDOWS_1253,
-		LIBWRC_CODEPAGE_WINDOWS_1254,
-		LIBWRC_CODEPAGE_WINDOWS_1255,
-		LIBWRC_CODEPAGE_WINDOWS_1256,
-		LIBWRC_CODEPAGE_WINDOWS_1257,
-		LIBWRC_CODEPAGE_WINDOWS_1258 };
+	libcerror_error_t *error    = NULL;
+	libwrc_resource_t *resource = NULL;
+	int result                  = 0;
 
-	int unsupported_codepages[ 17 ] = {
-		LIBWRC_CODEPAGE_ISO_8859_1,
-		LIBWRC_CODEPAGE_ISO_8859_2,
-		LIBWRC_CODEPAGE_ISO_8859_3,
-		LIBWRC_CODEPAGE_ISO_8859_4,
-		LIBWRC_CODEPAGE_ISO_8859_5,
-		LIBWRC_CODEPAGE_ISO_8859_6,
-		LIBWRC_CODEPAGE_ISO_8859_7,
-		LIBWRC_CODEPAGE_ISO_8859_8,
-		LIBWRC_CODEPAGE_ISO_8859_9,
-		LIBWRC_CODEPAGE_ISO_8859_10,
-		LIBWRC_CODEPAGE_ISO_8859_11,
-		LIBWRC_CODEPAGE_ISO_8859_13,
-		LIBWRC_CODEPAGE_ISO_8859_14,
-		LIBWRC_CODEPAGE_ISO_8859_15,
-		LIBWRC_CODEPAGE_ISO_8859_16,
-		LIBWRC_CODEPAGE_KOI8_R,
-		LIBWRC_CODEPAGE_KOI8_U };
+	/* Test regular cases
+	 */
+	result = libwrc_stream_get_resource_by_type(
+	          stream,
+	          0x0000038eUL,
+	          &resource,
+	          &error );
 
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
+	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* Test set ASCII codepage
+	if( result == 0 )
+	{
+		WRC_TEST_ASSERT_IS_NULL(
+		 "resource",
+		 resource );
+	}
+	else
+	{
+		WRC_TEST_ASSERT_IS_NOT_NULL(
+		 "resource",
+		 resource );
+	}
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( resource != NULL )
+	{
+		result = libwrc_resource_free(
+		          &resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "resource",
+		 resource );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
 	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
+	result = libwrc_stream_get_resource_by_type(
+	          NULL,
+	          0x0000038eUL,
+	          &resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_get_resource_by_type(
+	          stream,
+	          0x0000038eUL,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		codepage = supported_codepages[ index ];
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-		result = libwrc_stream_set_ascii_codepage(
+typedef struct wrc_test_stream_visit_items_values wrc_test_stream_visit_items_values_t;
+
+struct wrc_test_stream_visit_items_values
+{
+	/* The number of items visited
+	 */
+	int number_of_items;
+
+	/* The total size of the items visited
+	 */
+	uint64_t total_size;
+
+	/* The number of items after which the callback stops or 0 to not stop
+	 */
+	int stop_after;
+
+	/* The result of the callback when stopping
+	 */
+	int stop_result;
+};
+
+/* Callback function for the libwrc_stream_visit_items test
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int wrc_test_stream_visit_items_callback(
+     const libwrc_resource_item_view_t *item_view,
+     void *user_data )
+{
+	wrc_test_stream_visit_items_values_t *values = NULL;
+
+	if( ( item_view == NULL )
+	 || ( user_data == NULL ) )
+	{
+		return( -1 );
+	}
+	values = (wrc_test_stream_visit_items_values_t *) user_data;
+
+	values->number_of_items += 1;
+	values->total_size      += item_view->size;
+
+	if( ( values->stop_after > 0 )
+	 && ( values->number_of_items >= values->stop_after ) )
+	{
+		return( values->stop_result );
+	}
+	return( 1 );
+}
+
+/* Tests the libwrc_stream_visit_items function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_visit_items(
+     libwrc_stream_t *stream )
+{
+	wrc_test_stream_visit_items_values_t values;
+
+	libcerror_error_t *error               = NULL;
+	libwrc_resource_t *resource            = NULL;
+	libwrc_resource_item_t *resource_item  = NULL;
+	libwrc_resource_item_t *sub_item       = NULL;
+	uint64_t total_size                    = 0;
+	uint32_t size                          = 0;
+	int item_index                         = 0;
+	int number_of_items                    = 0;
+	int number_of_leaf_items               = 0;
+	int number_of_resources                = 0;
+	int number_of_sub_items                = 0;
+	int resource_index                     = 0;
+	int result                             = 0;
+	int sub_item_index                     = 0;
+
+	/* Determine the expected number of leaf items using the resource and resource item functions
+	 */
+	result = libwrc_stream_get_number_of_resources(
+	          stream,
+	          &number_of_resources,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( resource_index = 0;
+	     resource_index < number_of_resources;
+	     resource_index++ )
+	{
+		result = libwrc_stream_get_resource_by_index(
 		          stream,
-		          codepage,
+		          resource_index,
+		          &resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwrc_resource_get_number_of_items(
+		          resource,
+		          &number_of_items,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			result = libwrc_resource_get_item_by_index(
+			          resource,
+			          item_index,
+			          &resource_item,
+			          &error );
+
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libwrc_resource_item_get_number_of_sub_items(
+			          resource_item,
+			          &number_of_sub_items,
+			          &error );
+
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( sub_item_index = 0;
+			     sub_item_index < number_of_sub_items;
+			     sub_item_index++ )
+			{
+				result = libwrc_resource_item_get_sub_item_by_index(
+				          resource_item,
+				          sub_item_index,
+				          &sub_item,
+				          &error );
+
+				WRC_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				WRC_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libwrc_resource_item_get_size(
+				          sub_item,
+				          &size,
+				          &error );
+
+				WRC_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				WRC_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				number_of_leaf_items += 1;
+				total_size           += size;
+
+				result = libwrc_resource_item_free(
+				          &sub_item,
+				          &error );
+
+				WRC_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				WRC_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libwrc_resource_item_free(
+			          &resource_item,
+			          &error );
+
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libwrc_resource_free(
+		          &resource,
 		          &error );
 
 		WRC_TEST_ASSERT_EQUAL_INT(
@@ -1446,34 +3233,78 @@ int wrc_test_stream_set_ascii_codepage(
 		 "error",
 		 error );
 	}
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libwrc_stream_set_ascii_codepage(
-	          NULL,
-	          LIBWRC_CODEPAGE_ASCII,
+	values.number_of_items = 0;
+	values.total_size      = 0;
+	values.stop_after      = 0;
+	values.stop_result     = 1;
+
+	result = libwrc_stream_visit_items(
+	          stream,
+	          &wrc_test_stream_visit_items_callback,
+	          (void *) &values,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_items",
+	 values.number_of_items,
+	 number_of_leaf_items );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "values.total_size",
+	 values.total_size,
+	 total_size );
+
+	if( number_of_leaf_items > 0 )
 	{
-		codepage = unsupported_codepages[ index ];
+		/* Test stopping the visit from the callback
+		 */
+		values.number_of_items = 0;
+		values.total_size      = 0;
+		values.stop_after      = 1;
+		values.stop_result     = 0;
 
-		result = libwrc_stream_set_ascii_codepage(
+		result = libwrc_stream_visit_items(
 		          stream,
-		          codepage,
+		          &wrc_test_stream_visit_items_callback,
+		          (void *) &values,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "values.number_of_items",
+		 values.number_of_items,
+		 1 );
+
+		/* Test error returned by the callback
+		 */
+		values.number_of_items = 0;
+		values.total_size      = 0;
+		values.stop_after      = 1;
+		values.stop_result     = -1;
+
+		result = libwrc_stream_visit_items(
+		          stream,
+		          &wrc_test_stream_visit_items_callback,
+		          (void *) &values,
 		          &error );
 
 		WRC_TEST_ASSERT_EQUAL_INT(
@@ -1487,23 +3318,86 @@ int wrc_test_stream_set_ascii_codepage(
 
 		libcerror_error_free(
 		 &error );
+
+		/* Test visit after abort was signalled
+		 * The stream remains aborted until it is opened again
+		 */
+		result = libwrc_stream_signal_abort(
+		          stream,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		values.number_of_items = 0;
+		values.total_size      = 0;
+		values.stop_after      = 0;
+		values.stop_result     = 0;
+
+		result = libwrc_stream_visit_items(
+		          stream,
+		          &wrc_test_stream_visit_items_callback,
+		          (void *) &values,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "values.number_of_items",
+		 values.number_of_items,
+		 0 );
 	}
-	/* Clean up
+	/* Test error cases
 	 */
-	result = libwrc_stream_set_ascii_codepage(
+	result = libwrc_stream_visit_items(
+	          NULL,
+	          &wrc_test_stream_visit_items_callback,
+	          (void *) &values,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_visit_items(
 	          stream,
-	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          (void *) &values,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	WRC_TEST_ASSERT_IS_NULL(
+	WRC_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1512,40 +3406,259 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( sub_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &sub_item,
+		 NULL );
+	}
+	if( resource_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &resource_item,
+		 NULL );
+	}
+	if( resource != NULL )
+	{
+		libwrc_resource_free(
+		 &resource,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libwrc_stream_get_virtual_address function
+/* Tests the libwrc_stream_read_items function
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_stream_get_virtual_address(
+int wrc_test_stream_read_items(
      libwrc_stream_t *stream )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t virtual_address = 0;
-	int result               = 0;
+	uint8_t buffers[ 8 ][ 64 ];
+	uint8_t expected_buffer[ 64 ];
+	libwrc_resource_item_read_request_t requests[ 8 ];
+	libwrc_resource_item_t *resource_items[ 8 ];
+
+	libcerror_error_t *error              = NULL;
+	libwrc_resource_t *resource           = NULL;
+	libwrc_resource_item_t *resource_item = NULL;
+	ssize_t read_count                    = 0;
+	int number_of_requests                = 0;
+	int number_of_resources               = 0;
+	int request_index                     = 0;
+	int resource_index                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_stream_get_number_of_resources(
+	          stream,
+	          &number_of_resources,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
+	/* The items of the last resource are requested first
+	 * so that the requests are not in the order of their data
+	 */
+	for( resource_index = number_of_resources - 1;
+	     resource_index >= 0;
+	     resource_index-- )
+	{
+		if( number_of_requests >= 8 )
+		{
+			break;
+		}
+		result = libwrc_stream_get_resource_by_index(
+		          stream,
+		          resource_index,
+		          &resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwrc_resource_get_item_by_index(
+		          resource,
+		          0,
+		          &resource_item,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		resource_items[ number_of_requests ] = NULL;
+
+		result = libwrc_resource_item_get_sub_item_by_index(
+		          resource_item,
+		          0,
+		          &( resource_items[ number_of_requests ] ),
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		requests[ number_of_requests ].resource_item = resource_items[ number_of_requests ];
+		requests[ number_of_requests ].buffer        = buffers[ number_of_requests ];
+		requests[ number_of_requests ].buffer_size   = 64;
+		requests[ number_of_requests ].read_count    = 0;
+
+		number_of_requests++;
+
+		result = libwrc_resource_item_free(
+		          &resource_item,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwrc_resource_free(
+		          &resource,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Test regular cases
 	 */
-	result = libwrc_stream_get_virtual_address(
+	result = libwrc_stream_read_items(
 	          stream,
-	          &virtual_address,
+	          requests,
+	          number_of_requests,
 	          &error );
 
-	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		read_count = libwrc_resource_item_read_buffer_at_offset(
+		              resource_items[ request_index ],
+		              expected_buffer,
+		              64,
+		              0,
+		              &error );
+
+		WRC_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) requests[ request_index ].read_count );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffers[ request_index ],
+		          expected_buffer,
+		          (size_t) read_count );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libwrc_stream_read_items(
+	          stream,
+	          requests,
+	          0,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libwrc_stream_get_virtual_address(
-	          NULL,
-	          &virtual_address,
+	/* Test error cases
+	 */
+	result = libwrc_stream_read_items(
+	          NULL,
+	          requests,
+	          number_of_requests,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_read_items(
+	          stream,
+	          NULL,
+	          number_of_requests,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_stream_read_items(
+	          stream,
+	          requests,
+	          -1,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1560,11 +3673,16 @@ int wrc_test_stream_get_virtual_address(
 	libcerror_error_free(
 	 &error );
 
-	result = libwrc_stream_get_virtual_address(
+	requests[ 0 ].buffer = NULL;
+
+	result = libwrc_stream_read_items(
 	          stream,
-	          NULL,
+	          requests,
+	          number_of_requests,
 	          &error );
 
+	requests[ 0 ].buffer = buffers[ 0 ];
+
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1577,6 +3695,25 @@ int wrc_test_stream_get_virtual_address(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		result = libwrc_resource_item_free(
+		          &( resource_items[ request_index ] ),
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	return( 1 );
 
 on_error:
@@ -1585,40 +3722,81 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( resource_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &resource_item,
+		 NULL );
+	}
+	if( resource != NULL )
+	{
+		libwrc_resource_free(
+		 &resource,
+		 NULL );
+	}
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		if( resource_items[ request_index ] != NULL )
+		{
+			libwrc_resource_item_free(
+			 &( resource_items[ request_index ] ),
+			 NULL );
+		}
+	}
 	return( 0 );
 }
 
-/* Tests the libwrc_stream_get_number_of_resources function
+/* Tests the libwrc_stream_get_statistics function
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_stream_get_number_of_resources(
+int wrc_test_stream_get_statistics(
      libwrc_stream_t *stream )
 {
+	libwrc_statistics_t statistics;
+
 	libcerror_error_t *error = NULL;
-	int number_of_resources  = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libwrc_stream_get_number_of_resources(
+	result = libwrc_stream_get_statistics(
 	          stream,
-	          &number_of_resources,
+	          &statistics,
 	          &error );
 
-	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	/* At minimum the root node was read when the stream was opened
+	 */
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "statistics.number_of_nodes > 0",
+	 (int) ( statistics.number_of_nodes > 0 ),
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "statistics.number_of_node_entries >= statistics.number_of_data_descriptors",
+	 (int) ( statistics.number_of_node_entries >= statistics.number_of_data_descriptors ),
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "statistics.maximum_allocated_size > 0",
+	 (int) ( statistics.maximum_allocated_size > 0 ),
+	 1 );
+
 	/* Test error cases
 	 */
-	result = libwrc_stream_get_number_of_resources(
+	result = libwrc_stream_get_statistics(
 	          NULL,
-	          &number_of_resources,
+	          &statistics,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -1633,7 +3811,7 @@ int wrc_test_stream_get_number_of_resources(
 	libcerror_error_free(
 	 &error );
 
-	result = libwrc_stream_get_number_of_resources(
+	result = libwrc_stream_get_statistics(
 	          stream,
 	          NULL,
 	          &error );
@@ -1661,110 +3839,443 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libwrc_stream_get_resource_by_index function
- * Returns 1 if successful or 0 if not
- */
-int wrc_test_stream_get_resource_by_index(
-     libwrc_stream_t *stream )
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+
+typedef struct wrc_test_stream_read_thread_arguments wrc_test_stream_read_thread_arguments_t;
+
+struct wrc_test_stream_read_thread_arguments
 {
-	libcerror_error_t *error    = NULL;
-	libwrc_resource_t *resource = NULL;
-	int result                  = 0;
+	/* The stream shared by the threads
+	 */
+	libwrc_stream_t *stream;
 
-	/* Test regular cases
+	/* The checksum of the resource data read by the thread
 	 */
-	result = libwrc_stream_get_resource_by_index(
-	          stream,
-	          0,
-	          &resource,
-	          &error );
+	uint32_t checksum;
 
-	WRC_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	/* The result of the thread
+	 */
+	int result;
+};
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "resource",
-	 resource );
+/* Reads the data of a resource item and its sub items
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_stream_read_resource_item_data(
+     libwrc_resource_item_t *resource_item,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 256 ];
+
+	libwrc_resource_item_t *sub_resource_item = NULL;
+	static char *function                     = "wrc_test_stream_read_resource_item_data";
+	size_t buffer_index                       = 0;
+	ssize_t read_count                        = 0;
+	off64_t data_offset                       = 0;
+	uint32_t data_size                        = 0;
+	int number_of_sub_items                   = 0;
+	int sub_item_index                        = 0;
+
+	if( libwrc_resource_item_get_size(
+	     resource_item,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
 
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		goto on_error;
+	}
+	while( data_offset < (off64_t) data_size )
+	{
+		/* The positional read does not depend on the current offset
+		 * which is shared by all the threads using the resource item
+		 */
+		read_count = libwrc_resource_item_read_buffer_at_offset(
+		              resource_item,
+		              buffer,
+		              256,
+		              data_offset,
+		              error );
+
+		if( read_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 data_offset );
+
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < (size_t) read_count;
+		     buffer_index++ )
+		{
+			*checksum = ( *checksum * 31 ) + buffer[ buffer_index ];
+		}
+		data_offset += read_count;
+	}
+	if( libwrc_resource_item_get_number_of_sub_items(
+	     resource_item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
 
-	result = libwrc_resource_free(
-	          &resource,
-	          &error );
+		goto on_error;
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libwrc_resource_item_get_sub_item_by_index(
+		     resource_item,
+		     sub_item_index,
+		     &sub_resource_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( wrc_test_stream_read_resource_item_data(
+		     sub_resource_item,
+		     checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_item_free(
+		     &sub_resource_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
 
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+on_error:
+	if( sub_resource_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &sub_resource_item,
+		 NULL );
+	}
+	return( -1 );
+}
 
-	WRC_TEST_ASSERT_IS_NULL(
-	 "resource",
-	 resource );
+/* Reads the data of all the resources in a stream
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_stream_read_resources_data(
+     libwrc_stream_t *stream,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	libwrc_resource_t *resource           = NULL;
+	libwrc_resource_item_t *resource_item = NULL;
+	static char *function                 = "wrc_test_stream_read_resources_data";
+	int item_index                        = 0;
+	int number_of_items                   = 0;
+	int number_of_resources               = 0;
+	int resource_index                    = 0;
+
+	if( libwrc_stream_get_number_of_resources(
+	     stream,
+	     &number_of_resources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resources.",
+		 function );
 
-	WRC_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		goto on_error;
+	}
+	for( resource_index = 0;
+	     resource_index < number_of_resources;
+	     resource_index++ )
+	{
+		if( libwrc_stream_get_resource_by_index(
+		     stream,
+		     resource_index,
+		     &resource,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource: %d.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+		if( libwrc_resource_get_number_of_items(
+		     resource,
+		     &number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items.",
+			 function );
+
+			goto on_error;
+		}
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( libwrc_resource_get_item_by_index(
+			     resource,
+			     item_index,
+			     &resource_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item: %d.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			if( wrc_test_stream_read_resource_item_data(
+			     resource_item,
+			     checksum,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read item: %d.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			if( libwrc_resource_item_free(
+			     &resource_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free item: %d.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+		}
+		if( libwrc_resource_free(
+		     &resource,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free resource: %d.",
+			 function,
+			 resource_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
 
-	/* Test error cases
-	 */
-	result = libwrc_stream_get_resource_by_index(
-	          NULL,
-	          0,
-	          &resource,
-	          &error );
+on_error:
+	if( resource_item != NULL )
+	{
+		libwrc_resource_item_free(
+		 &resource_item,
+		 NULL );
+	}
+	if( resource != NULL )
+	{
+		libwrc_resource_free(
+		 &resource,
+		 NULL );
+	}
+	return( -1 );
+}
 
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+/* The read thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int wrc_test_stream_read_thread_callback_function(
+     void *arguments )
+{
+	wrc_test_stream_read_thread_arguments_t *thread_arguments = NULL;
+	int iteration                                             = 0;
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments = (wrc_test_stream_read_thread_arguments_t *) arguments;
 
-	libcerror_error_free(
-	 &error );
+	thread_arguments->result = 1;
 
-	result = libwrc_stream_get_resource_by_index(
-	          stream,
-	          -1,
-	          &resource,
-	          &error );
+	for( iteration = 0;
+	     iteration < WRC_TEST_STREAM_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		thread_arguments->checksum = 0;
 
-	WRC_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		if( wrc_test_stream_read_resources_data(
+		     thread_arguments->stream,
+		     &( thread_arguments->checksum ),
+		     NULL ) != 1 )
+		{
+			thread_arguments->result = -1;
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			break;
+		}
+	}
+	return( thread_arguments->result );
+}
 
-	libcerror_error_free(
-	 &error );
+/* Tests reading a stream from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_stream_read_multi_threaded(
+     libwrc_stream_t *stream )
+{
+	wrc_test_stream_read_thread_arguments_t thread_arguments[ WRC_TEST_STREAM_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ WRC_TEST_STREAM_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+	int thread_index         = 0;
+
+	for( thread_index = 0;
+	     thread_index < WRC_TEST_STREAM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+
+		thread_arguments[ thread_index ].stream   = stream;
+		thread_arguments[ thread_index ].checksum = 0;
+		thread_arguments[ thread_index ].result   = 0;
+	}
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < WRC_TEST_STREAM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &wrc_test_stream_read_thread_callback_function,
+		          (void *) &( thread_arguments[ thread_index ] ),
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < WRC_TEST_STREAM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libwrc_stream_get_resource_by_index(
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Determine the expected checksum from a single thread after the threads
+	 * have finished, so that the threads are the first to read the resources
+	 */
+	result = wrc_test_stream_read_resources_data(
 	          stream,
-	          0,
-	          NULL,
+	          &checksum,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	for( thread_index = 0;
+	     thread_index < WRC_TEST_STREAM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "thread_arguments[ thread_index ].result",
+		 thread_arguments[ thread_index ].result,
+		 1 );
 
+		WRC_TEST_ASSERT_EQUAL_UINT32(
+		 "thread_arguments[ thread_index ].checksum",
+		 thread_arguments[ thread_index ].checksum,
+		 checksum );
+	}
 	return( 1 );
 
 on_error:
@@ -1773,212 +4284,139 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	for( thread_index = 0;
+	     thread_index < WRC_TEST_STREAM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
 	return( 0 );
 }
 
-/* Tests the libwrc_stream_get_resource_by_identifier function
+/* Tests reading a stream opened with read on demand from multiple threads
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_stream_get_resource_by_identifier(
-     libwrc_stream_t *stream )
+int wrc_test_stream_read_multi_threaded_on_demand(
+     const system_character_t *source,
+     uint32_t virtual_address )
 {
-	libcerror_error_t *error    = NULL;
-	libwrc_resource_t *resource = NULL;
-	int result                  = 0;
+	char narrow_source[ 256 ];
 
-	/* Test regular cases
+	libcerror_error_t *error = NULL;
+	libwrc_stream_t *stream  = NULL;
+	int result               = 0;
+
+	/* Initialize test
 	 */
-	result = libwrc_stream_get_resource_by_identifier(
-	          stream,
-	          0x0000038eUL,
-	          &resource,
+	result = wrc_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
 	          &error );
 
-	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	if( result == 0 )
-	{
-		WRC_TEST_ASSERT_IS_NULL(
-		 "resource",
-		 resource );
-	}
-	else
-	{
-		WRC_TEST_ASSERT_IS_NOT_NULL(
-		 "resource",
-		 resource );
-	}
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( resource != NULL )
-	{
-		result = libwrc_resource_free(
-		          &resource,
-		          &error );
-
-		WRC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		WRC_TEST_ASSERT_IS_NULL(
-		 "resource",
-		 resource );
-
-		WRC_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
-	 */
-	result = libwrc_stream_get_resource_by_identifier(
-	          NULL,
-	          0x0000038eUL,
-	          &resource,
+	result = libwrc_stream_initialize(
+	          &stream,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libwrc_stream_get_resource_by_identifier(
+	result = libwrc_stream_set_virtual_address(
 	          stream,
-	          0x0000038eUL,
-	          NULL,
+	          virtual_address,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libwrc_stream_get_resource_by_type function
- * Returns 1 if successful or 0 if not
- */
-int wrc_test_stream_get_resource_by_type(
-     libwrc_stream_t *stream )
-{
-	libcerror_error_t *error    = NULL;
-	libwrc_resource_t *resource = NULL;
-	int result                  = 0;
-
-	/* Test regular cases
-	 */
-	result = libwrc_stream_get_resource_by_type(
+	result = libwrc_stream_open(
 	          stream,
-	          0x0000038eUL,
-	          &resource,
+	          narrow_source,
+	          LIBWRC_OPEN_READ_ON_DEMAND,
 	          &error );
 
-	WRC_TEST_ASSERT_NOT_EQUAL_INT(
+	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	if( result == 0 )
-	{
-		WRC_TEST_ASSERT_IS_NULL(
-		 "resource",
-		 resource );
-	}
-	else
-	{
-		WRC_TEST_ASSERT_IS_NOT_NULL(
-		 "resource",
-		 resource );
-	}
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( resource != NULL )
-	{
-		result = libwrc_resource_free(
-		          &resource,
-		          &error );
-
-		WRC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	/* Test regular cases
+	 * The threads read the sub nodes of the resources on demand
+	 */
+	result = wrc_test_stream_read_multi_threaded(
+	          stream );
 
-		WRC_TEST_ASSERT_IS_NULL(
-		 "resource",
-		 resource );
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		WRC_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
+	/* Clean up
 	 */
-	result = libwrc_stream_get_resource_by_type(
-	          NULL,
-	          0x0000038eUL,
-	          &resource,
+	result = libwrc_stream_close(
+	          stream,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libwrc_stream_get_resource_by_type(
-	          stream,
-	          0x0000038eUL,
-	          NULL,
+	result = libwrc_stream_free(
+	          &stream,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	WRC_TEST_ASSERT_IS_NOT_NULL(
+	WRC_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1987,9 +4425,17 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( stream != NULL )
+	{
+		libwrc_stream_free(
+		 &stream,
+		 NULL );
+	}
 	return( 0 );
 }
 
+#endif /* defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2074,6 +4520,10 @@ int main(
 	 "libwrc_stream_free",
 	 wrc_test_stream_free );
 
+	WRC_TEST_RUN(
+	 "libwrc_stream_open_shared_nodes",
+	 wrc_test_stream_open_shared_nodes );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2083,6 +4533,12 @@ int main(
 		 source,
 		 (uint32_t) virtual_address );
 
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_open_read_on_demand",
+		 wrc_test_stream_open_read_on_demand,
+		 source,
+		 (uint32_t) virtual_address );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 		WRC_TEST_RUN_WITH_ARGS(
@@ -2099,6 +4555,12 @@ int main(
 		 source,
 		 (uint32_t) virtual_address );
 
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_open_memory",
+		 wrc_test_stream_open_memory,
+		 source,
+		 (uint32_t) virtual_address );
+
 		WRC_TEST_RUN(
 		 "libwrc_stream_close",
 		 wrc_test_stream_close );
@@ -2172,11 +4634,6 @@ int main(
 		 "error",
 		 error );
 
-		WRC_TEST_RUN_WITH_ARGS(
-		 "libwrc_stream_signal_abort",
-		 wrc_test_stream_signal_abort,
-		 stream );
-
 #if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
 
 		/* TODO: add tests for libwrc_stream_open_read */
@@ -2220,6 +4677,43 @@ int main(
 		 wrc_test_stream_get_resource_by_type,
 		 stream );
 
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_read_items",
+		 wrc_test_stream_read_items,
+		 stream );
+
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_get_statistics",
+		 wrc_test_stream_get_statistics,
+		 stream );
+
+#if defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT )
+
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_read_multi_threaded",
+		 wrc_test_stream_read_multi_threaded,
+		 stream );
+
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_read_multi_threaded_on_demand",
+		 wrc_test_stream_read_multi_threaded_on_demand,
+		 source,
+		 (uint32_t) virtual_address );
+
+#endif /* defined( HAVE_LIBWRC_MULTI_THREAD_SUPPORT ) */
+
+		/* The stream remains aborted after these tests
+		 */
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_visit_items",
+		 wrc_test_stream_visit_items,
+		 stream );
+
+		WRC_TEST_RUN_WITH_ARGS(
+		 "libwrc_stream_signal_abort",
+		 wrc_test_stream_signal_abort,
+		 stream );
+
 		/* TODO: add tests for libwrc_stream_get_resource_by_utf8_name */
 
 		/* TODO: add tests for libwrc_stream_get_resource_by_utf16_name */
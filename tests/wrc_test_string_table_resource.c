@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -435,6 +436,336 @@ on_error:
 	return( 0 );
 }
 
+/* Tests that the libwrc_string_table_resource_read function retains the data of every read
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_string_table_resource_read_retains_data(
+     void )
+{
+	uint8_t data[ 50 ];
+	uint8_t utf8_string[ 32 ];
+
+	uint8_t expected_utf8_string[ 10 ] = {
+		'M', 'y', ' ', 's', 't', 'r', 'i', 'n', 'g', 0 };
+
+	libcerror_error_t *error                              = NULL;
+	libwrc_string_table_resource_t *string_table_resource = NULL;
+	size_t utf8_string_size                               = 0;
+	uint32_t base_identifier                              = 0;
+	int result                                            = 0;
+	int string_index                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_string_table_resource_initialize(
+	          &string_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "string_table_resource",
+	 string_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( base_identifier = 1;
+	     base_identifier <= 2;
+	     base_identifier++ )
+	{
+		result = (int) ( memory_copy(
+		                  data,
+		                  wrc_test_string_table_resource_data1,
+		                  50 ) != NULL );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libwrc_string_table_resource_read(
+		          string_table_resource,
+		          data,
+		          50,
+		          base_identifier,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 * The strings are read from the retained data
+	 */
+	result = (int) ( memory_set(
+	                  data,
+	                  0xff,
+	                  50 ) != NULL );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( string_index = 0;
+	     string_index < 2;
+	     string_index++ )
+	{
+		result = libwrc_string_table_resource_get_utf8_string_size(
+		          string_table_resource,
+		          string_index,
+		          &utf8_string_size,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) 10 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwrc_string_table_resource_get_utf8_string(
+		          string_table_resource,
+		          string_index,
+		          utf8_string,
+		          32,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          10 );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	result = libwrc_string_table_resource_free(
+	          &string_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "string_table_resource",
+	 string_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_table_resource != NULL )
+	{
+		libwrc_string_table_resource_free(
+		 &string_table_resource,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_string_table_resource_get_index_by_identifier function with multiple blocks
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_string_table_resource_get_index_by_identifier_multiple_blocks(
+     void )
+{
+	uint32_t base_identifiers[ 3 ]   = { 63, 1, 0x00001001UL };
+	uint32_t string_identifiers[ 3 ] = { 0x000003e8UL, 0x00000008UL, 0x00010008UL };
+
+	libcerror_error_t *error                              = NULL;
+	libwrc_string_table_resource_t *string_table_resource = NULL;
+	int block_index                                       = 0;
+	int string_index                                      = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_string_table_resource_initialize(
+	          &string_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "string_table_resource",
+	 string_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The last block is too far apart to be mapped to an identifier slot
+	 */
+	for( block_index = 0;
+	     block_index < 3;
+	     block_index++ )
+	{
+		result = libwrc_string_table_resource_read(
+		          string_table_resource,
+		          wrc_test_string_table_resource_data1,
+		          50,
+		          base_identifiers[ block_index ],
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_index = -1;
+
+		result = libwrc_string_table_resource_get_index_by_identifier(
+		          string_table_resource,
+		          string_identifiers[ block_index ],
+		          &string_index,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "string_index",
+		 string_index,
+		 block_index );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_index = -1;
+
+		result = libwrc_string_table_resource_get_index_by_identifier(
+		          string_table_resource,
+		          string_identifiers[ block_index ] + 1,
+		          &string_index,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "string_index",
+		 string_index,
+		 -1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( block_index = 0;
+	     block_index < 3;
+	     block_index++ )
+	{
+		string_index = -1;
+
+		result = libwrc_string_table_resource_get_index_by_identifier(
+		          string_table_resource,
+		          string_identifiers[ block_index ],
+		          &string_index,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "string_index",
+		 string_index,
+		 block_index );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libwrc_string_table_resource_free(
+	          &string_table_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "string_table_resource",
+	 string_table_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_table_resource != NULL )
+	{
+		libwrc_string_table_resource_free(
+		 &string_table_resource,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libwrc_string_table_resource_get_number_of_strings function
  * Returns 1 if successful or 0 if not
  */
@@ -1236,6 +1567,14 @@ int main(
 	 "libwrc_string_table_resource_read",
 	 wrc_test_string_table_resource_read );
 
+	WRC_TEST_RUN(
+	 "libwrc_string_table_resource_read_retains_data",
+	 wrc_test_string_table_resource_read_retains_data );
+
+	WRC_TEST_RUN(
+	 "libwrc_string_table_resource_get_index_by_identifier",
+	 wrc_test_string_table_resource_get_index_by_identifier_multiple_blocks );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize string_table_resource for tests
@@ -431,6 +431,191 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libwrc_table_entry_set_string_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_table_entry_set_string_reference(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libwrc_table_entry_t *table_entry = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_table_entry_initialize(
+	          &table_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "table_entry",
+	 table_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_table_entry_set_string_reference(
+	          table_entry,
+	          (uint8_t *) "test",
+	          5,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "table_entry->string_is_reference",
+	 (int) table_entry->string_is_reference,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libwrc_table_entry_set_string_reference(
+	          table_entry,
+	          (uint8_t *) "test",
+	          5,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_table_entry_set_string_reference(
+	          NULL,
+	          (uint8_t *) "test",
+	          5,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_table_entry_set_string_reference(
+	          table_entry,
+	          NULL,
+	          5,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_table_entry_set_string_reference(
+	          table_entry,
+	          (uint8_t *) "test",
+	          0,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_table_entry_set_string_reference(
+	          table_entry,
+	          (uint8_t *) "test",
+	          (size_t) SSIZE_MAX + 1,
+	          LIBWRC_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_table_entry_free(
+	          &table_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "table_entry",
+	 table_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_entry != NULL )
+	{
+		libwrc_table_entry_free(
+		 &table_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libwrc_table_entry_get_utf8_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -856,6 +1041,10 @@ int main(
 	 "libwrc_table_entry_set_string",
 	 wrc_test_table_entry_set_string );
 
+	WRC_TEST_RUN(
+	 "libwrc_table_entry_set_string_reference",
+	 wrc_test_table_entry_set_string_reference );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize table_entry for tests
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -474,21 +475,1553 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libwrc_version_information_resource_read_fixed_file_information function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_read_fixed_file_information(
+     void )
+{
+	libcerror_error_t *error                                            = NULL;
+	libwrc_version_information_resource_t *version_information_resource = NULL;
+	uint64_t file_version                                               = 0;
+	int number_of_string_tables                                         = 0;
+	int result                                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_version_information_resource_initialize(
+	          &version_information_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "version_information_resource",
+	 version_information_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_read_fixed_file_information(
+	          version_information_resource,
+	          wrc_test_version_information_resource_data1,
+	          LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_version_information_resource_get_file_version(
+	          version_information_resource,
+	          &file_version,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "file_version",
+	 file_version,
+	 (uint64_t) 0x1000000000000UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The string file information is not read
+	 */
+	result = libwrc_version_information_resource_get_number_of_string_tables(
+	          version_information_resource,
+	          &number_of_string_tables,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_string_tables",
+	 number_of_string_tables,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_read_fixed_file_information(
+	          NULL,
+	          wrc_test_version_information_resource_data1,
+	          LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_read_fixed_file_information(
+	          version_information_resource,
+	          NULL,
+	          LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_read_fixed_file_information(
+	          version_information_resource,
+	          wrc_test_version_information_resource_data1,
+	          0,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_read_fixed_file_information(
+	          version_information_resource,
+	          wrc_test_version_information_resource_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data too small to contain the fixed file information
+	 */
+	result = libwrc_version_information_resource_read_fixed_file_information(
+	          version_information_resource,
+	          wrc_test_version_information_resource_data1,
+	          LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE - 1,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data that does not start with the signature
+	 */
+	result = libwrc_version_information_resource_read_fixed_file_information(
+	          version_information_resource,
+	          &( wrc_test_version_information_resource_data1[ 4 ] ),
+	          LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_version_information_resource_free(
+	          &version_information_resource,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "version_information_resource",
+	 version_information_resource );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( version_information_resource != NULL )
+	{
+		libwrc_version_information_resource_free(
+		 &version_information_resource,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libwrc_version_information_resource_get_file_version function
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_version_information_resource_get_file_version(
+int wrc_test_version_information_resource_get_file_version(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t file_version    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_file_version(
+	          version_information_resource,
+	          &file_version,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "file_version",
+	 file_version,
+	 (uint64_t) 0x1000000000000UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_file_version(
+	          NULL,
+	          &file_version,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_file_version(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_product_version function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_product_version(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t product_version = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_product_version(
+	          version_information_resource,
+	          &product_version,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "product_version",
+	 product_version,
+	 (uint64_t) 0x1000000000000UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_product_version(
+	          NULL,
+	          &product_version,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_product_version(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_file_flags_bitmask function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_file_flags_bitmask(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error    = NULL;
+	uint32_t file_flags_bitmask = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_file_flags_bitmask(
+	          version_information_resource,
+	          &file_flags_bitmask,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "file_flags_bitmask",
+	 file_flags_bitmask,
+	 (uint32_t) 0x0000003fUL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_file_flags_bitmask(
+	          NULL,
+	          &file_flags_bitmask,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_file_flags_bitmask(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_file_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_file_flags(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t file_flags      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_file_flags(
+	          version_information_resource,
+	          &file_flags,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "file_flags",
+	 file_flags,
+	 (uint32_t) 0x00000000UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_file_flags(
+	          NULL,
+	          &file_flags,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_file_flags(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_file_operating_system function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_file_operating_system(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error       = NULL;
+	uint32_t file_operating_system = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_file_operating_system(
+	          version_information_resource,
+	          &file_operating_system,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "file_operating_system",
+	 file_operating_system,
+	 (uint32_t) 0x00000004UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_file_operating_system(
+	          NULL,
+	          &file_operating_system,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_file_operating_system(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_file_type function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_file_type(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t file_type       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_file_type(
+	          version_information_resource,
+	          &file_type,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "file_type",
+	 file_type,
+	 (uint32_t) 0x00000002UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_file_type(
+	          NULL,
+	          &file_type,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_file_type(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_file_sub_type function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_file_sub_type(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t file_sub_type   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_file_sub_type(
+	          version_information_resource,
+	          &file_sub_type,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "file_sub_type",
+	 file_sub_type,
+	 (uint32_t) 0x00000000UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_file_sub_type(
+	          NULL,
+	          &file_sub_type,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_file_sub_type(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_file_time function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_file_time(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t file_time       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_file_time(
+	          version_information_resource,
+	          &file_time,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT64(
+	 "file_time",
+	 file_time,
+	 (uint64_t) 0x0000000000000000UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_file_time(
+	          NULL,
+	          &file_time,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_file_time(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_number_of_string_tables function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_number_of_string_tables(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error    = NULL;
+	int number_of_string_tables = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_number_of_string_tables(
+	          version_information_resource,
+	          &number_of_string_tables,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_string_tables",
+	 number_of_string_tables,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_number_of_string_tables(
+	          NULL,
+	          &number_of_string_tables,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_number_of_string_tables(
+	          version_information_resource,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_string_table_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_string_table_identifier(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t identifier      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_string_table_identifier(
+	          version_information_resource,
+	          0,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 0x040904e4UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_string_table_identifier(
+	          NULL,
+	          0,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_string_table_identifier(
+	          version_information_resource,
+	          -1,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_string_table_identifier(
+	          version_information_resource,
+	          0,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_utf8_string_size_by_key and libwrc_version_information_resource_get_utf8_string_by_key functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_utf8_string_by_key(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	uint8_t utf8_string[ 64 ];
+	libcerror_error_t *error  = NULL;
+	size_t utf8_string_size   = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_utf8_string_size_by_key(
+	          version_information_resource,
+	          0,
+	          (uint8_t *) "ProductName",
+	          11,
+	          &utf8_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_version_information_resource_get_utf8_string_by_key(
+	          version_information_resource,
+	          0,
+	          (uint8_t *) "ProductName",
+	          11,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "wrc_test",
+	          9 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libwrc_version_information_resource_get_utf8_string_size_by_key(
+	          version_information_resource,
+	          0,
+	          (uint8_t *) "CompanyName",
+	          11,
+	          &utf8_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_version_information_resource_get_utf8_string_by_key(
+	          version_information_resource,
+	          0,
+	          (uint8_t *) "CompanyName",
+	          11,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_utf8_string_size_by_key(
+	          NULL,
+	          0,
+	          (uint8_t *) "ProductName",
+	          11,
+	          &utf8_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf8_string_size_by_key(
+	          version_information_resource,
+	          -1,
+	          (uint8_t *) "ProductName",
+	          11,
+	          &utf8_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf8_string_size_by_key(
+	          version_information_resource,
+	          0,
+	          (uint8_t *) "ProductName",
+	          11,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf8_string_by_key(
+	          NULL,
+	          0,
+	          (uint8_t *) "ProductName",
+	          11,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf8_string_by_key(
+	          version_information_resource,
+	          -1,
+	          (uint8_t *) "ProductName",
+	          11,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf8_string_by_key(
+	          version_information_resource,
+	          0,
+	          (uint8_t *) "ProductName",
+	          11,
+	          NULL,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf8_string_by_key(
+	          version_information_resource,
+	          0,
+	          (uint8_t *) "ProductName",
+	          11,
+	          utf8_string,
+	          4,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_utf16_string_size_by_key and libwrc_version_information_resource_get_utf16_string_by_key functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_utf16_string_by_key(
+     libwrc_version_information_resource_t *version_information_resource )
+{
+	uint16_t utf16_key[ 16 ]    = { 'F', 'i', 'l', 'e', 'D', 'e', 's', 'c', 'r', 'i', 'p', 't', 'i', 'o', 'n', 0 };
+	uint16_t utf16_string[ 64 ];
+	libcerror_error_t *error    = NULL;
+	size_t utf16_string_size    = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_information_resource_get_utf16_string_size_by_key(
+	          version_information_resource,
+	          0,
+	          utf16_key,
+	          15,
+	          &utf16_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 27 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_version_information_resource_get_utf16_string_by_key(
+	          version_information_resource,
+	          0,
+	          utf16_key,
+	          15,
+	          utf16_string,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 0 ]",
+	 utf16_string[ 0 ],
+	 (uint16_t) 'W' );
+
+	WRC_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 26 ]",
+	 utf16_string[ 26 ],
+	 (uint16_t) 0 );
+
+	result = libwrc_version_information_resource_get_utf16_string_size_by_key(
+	          version_information_resource,
+	          0,
+	          utf16_key,
+	          4,
+	          &utf16_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_information_resource_get_utf16_string_size_by_key(
+	          NULL,
+	          0,
+	          utf16_key,
+	          15,
+	          &utf16_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf16_string_size_by_key(
+	          version_information_resource,
+	          -1,
+	          utf16_key,
+	          15,
+	          &utf16_string_size,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf16_string_size_by_key(
+	          version_information_resource,
+	          0,
+	          utf16_key,
+	          15,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf16_string_by_key(
+	          NULL,
+	          0,
+	          utf16_key,
+	          15,
+	          utf16_string,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf16_string_by_key(
+	          version_information_resource,
+	          -1,
+	          utf16_key,
+	          15,
+	          utf16_string,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf16_string_by_key(
+	          version_information_resource,
+	          0,
+	          utf16_key,
+	          15,
+	          NULL,
+	          64,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_utf16_string_by_key(
+	          version_information_resource,
+	          0,
+	          utf16_key,
+	          15,
+	          utf16_string,
+	          4,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_information_resource_get_number_of_translations function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_information_resource_get_number_of_translations(
      libwrc_version_information_resource_t *version_information_resource )
 {
-	libcerror_error_t *error = NULL;
-	uint64_t file_version    = 0;
-	int result               = 0;
+	libcerror_error_t *error   = NULL;
+	int number_of_translations = 0;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libwrc_version_information_resource_get_file_version(
+	result = libwrc_version_information_resource_get_number_of_translations(
 	          version_information_resource,
-	          &file_version,
+	          &number_of_translations,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -496,10 +2029,10 @@ int wrc_test_version_information_resource_get_file_version(
 	 result,
 	 1 );
 
-	WRC_TEST_ASSERT_EQUAL_UINT64(
-	 "file_version",
-	 file_version,
-	 (uint64_t) 0x1000000000000UL );
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_translations",
+	 number_of_translations,
+	 1 );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -507,9 +2040,9 @@ int wrc_test_version_information_resource_get_file_version(
 
 	/* Test error cases
 	 */
-	result = libwrc_version_information_resource_get_file_version(
+	result = libwrc_version_information_resource_get_number_of_translations(
 	          NULL,
-	          &file_version,
+	          &number_of_translations,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -524,7 +2057,7 @@ int wrc_test_version_information_resource_get_file_version(
 	libcerror_error_free(
 	 &error );
 
-	result = libwrc_version_information_resource_get_file_version(
+	result = libwrc_version_information_resource_get_number_of_translations(
 	          version_information_resource,
 	          NULL,
 	          &error );
@@ -552,21 +2085,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libwrc_version_information_resource_get_product_version function
+/* Tests the libwrc_version_information_resource_get_translation function
  * Returns 1 if successful or 0 if not
  */
-int wrc_test_version_information_resource_get_product_version(
+int wrc_test_version_information_resource_get_translation(
      libwrc_version_information_resource_t *version_information_resource )
 {
-	libcerror_error_t *error = NULL;
-	uint64_t product_version = 0;
-	int result               = 0;
+	libcerror_error_t *error     = NULL;
+	uint16_t codepage            = 0;
+	uint16_t language_identifier = 0;
+	int result                   = 0;
 
 	/* Test regular cases
 	 */
-	result = libwrc_version_information_resource_get_product_version(
+	result = libwrc_version_information_resource_get_translation(
 	          version_information_resource,
-	          &product_version,
+	          0,
+	          &language_identifier,
+	          &codepage,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -574,10 +2110,15 @@ int wrc_test_version_information_resource_get_product_version(
 	 result,
 	 1 );
 
-	WRC_TEST_ASSERT_EQUAL_UINT64(
-	 "product_version",
-	 product_version,
-	 (uint64_t) 0x1000000000000UL );
+	WRC_TEST_ASSERT_EQUAL_UINT16(
+	 "language_identifier",
+	 language_identifier,
+	 (uint16_t) 0x0409 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT16(
+	 "codepage",
+	 codepage,
+	 (uint16_t) 0x04e4 );
 
 	WRC_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -585,9 +2126,11 @@ int wrc_test_version_information_resource_get_product_version(
 
 	/* Test error cases
 	 */
-	result = libwrc_version_information_resource_get_product_version(
+	result = libwrc_version_information_resource_get_translation(
 	          NULL,
-	          &product_version,
+	          0,
+	          &language_identifier,
+	          &codepage,
 	          &error );
 
 	WRC_TEST_ASSERT_EQUAL_INT(
@@ -602,8 +2145,67 @@ int wrc_test_version_information_resource_get_product_version(
 	libcerror_error_free(
 	 &error );
 
-	result = libwrc_version_information_resource_get_product_version(
+	result = libwrc_version_information_resource_get_translation(
+	          version_information_resource,
+	          -1,
+	          &language_identifier,
+	          &codepage,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_translation(
+	          version_information_resource,
+	          1,
+	          &language_identifier,
+	          &codepage,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_translation(
+	          version_information_resource,
+	          0,
+	          NULL,
+	          &codepage,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_information_resource_get_translation(
 	          version_information_resource,
+	          0,
+	          &language_identifier,
 	          NULL,
 	          &error );
 
@@ -661,6 +2263,10 @@ int main(
 	 "libwrc_version_information_resource_read",
 	 wrc_test_version_information_resource_read );
 
+	WRC_TEST_RUN(
+	 "libwrc_version_information_resource_read_fixed_file_information",
+	 wrc_test_version_information_resource_read_fixed_file_information );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize version_information_resource for tests
@@ -707,6 +2313,66 @@ int main(
 	 wrc_test_version_information_resource_get_product_version,
 	 version_information_resource );
 
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_file_flags_bitmask",
+	 wrc_test_version_information_resource_get_file_flags_bitmask,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_file_flags",
+	 wrc_test_version_information_resource_get_file_flags,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_file_operating_system",
+	 wrc_test_version_information_resource_get_file_operating_system,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_file_type",
+	 wrc_test_version_information_resource_get_file_type,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_file_sub_type",
+	 wrc_test_version_information_resource_get_file_sub_type,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_file_time",
+	 wrc_test_version_information_resource_get_file_time,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_number_of_string_tables",
+	 wrc_test_version_information_resource_get_number_of_string_tables,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_string_table_identifier",
+	 wrc_test_version_information_resource_get_string_table_identifier,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_utf8_string_by_key",
+	 wrc_test_version_information_resource_get_utf8_string_by_key,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_utf16_string_by_key",
+	 wrc_test_version_information_resource_get_utf16_string_by_key,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_number_of_translations",
+	 wrc_test_version_information_resource_get_number_of_translations,
+	 version_information_resource );
+
+	WRC_TEST_RUN_WITH_ARGS(
+	 "libwrc_version_information_resource_get_translation",
+	 wrc_test_version_information_resource_get_translation,
+	 version_information_resource );
+
 	/* Clean up
 	 */
 	result = libwrc_version_information_resource_free(
@@ -0,0 +1,1154 @@
+/*
+ * Library version_string_table type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wrc_test_libcerror.h"
+#include "wrc_test_libwrc.h"
+#include "wrc_test_macros.h"
+#include "wrc_test_memory.h"
+#include "wrc_test_unused.h"
+
+#include "../libwrc/libwrc_version_string_table.h"
+
+/* "040904b0" as an UTF-16 little-endian stream
+ */
+uint8_t wrc_test_version_string_table_key_data1[ 18 ] = {
+	0x30, 0x00, 0x34, 0x00, 0x30, 0x00, 0x39, 0x00, 0x30, 0x00, 0x34, 0x00, 0x62, 0x00, 0x30, 0x00,
+	0x00, 0x00 };
+
+/* "0409xyz0" as an UTF-16 little-endian stream
+ */
+uint8_t wrc_test_version_string_table_key_data2[ 18 ] = {
+	0x30, 0x00, 0x34, 0x00, 0x30, 0x00, 0x39, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7a, 0x00, 0x30, 0x00,
+	0x00, 0x00 };
+
+/* The number of test strings, which is sufficient to rebuild the key slots
+ */
+#define WRC_TEST_VERSION_STRING_TABLE_NUMBER_OF_STRINGS	40
+
+/* The test keys "Key00" to "Key39" as UTF-16 little-endian streams
+ */
+uint8_t wrc_test_version_string_table_keys[ WRC_TEST_VERSION_STRING_TABLE_NUMBER_OF_STRINGS ][ 12 ];
+
+/* "Value" as an UTF-16 little-endian stream
+ */
+uint8_t wrc_test_version_string_table_value_data1[ 12 ] = {
+	0x56, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x65, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+/* Sets the test keys
+ */
+void wrc_test_version_string_table_set_keys(
+      void )
+{
+	int key_index = 0;
+
+	for( key_index = 0;
+	     key_index < WRC_TEST_VERSION_STRING_TABLE_NUMBER_OF_STRINGS;
+	     key_index++ )
+	{
+		memory_set(
+		 wrc_test_version_string_table_keys[ key_index ],
+		 0,
+		 12 );
+
+		wrc_test_version_string_table_keys[ key_index ][ 0 ] = (uint8_t) 'K';
+		wrc_test_version_string_table_keys[ key_index ][ 2 ] = (uint8_t) 'e';
+		wrc_test_version_string_table_keys[ key_index ][ 4 ] = (uint8_t) 'y';
+		wrc_test_version_string_table_keys[ key_index ][ 6 ] = (uint8_t) ( '0' + ( key_index / 10 ) );
+		wrc_test_version_string_table_keys[ key_index ][ 8 ] = (uint8_t) ( '0' + ( key_index % 10 ) );
+	}
+}
+
+/* Tests the libwrc_version_string_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_string_table_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libwrc_version_string_table_t *string_table = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 1;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_string_table_initialize(
+	          &string_table,
+	          0x040904b0UL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "string_table",
+	 string_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "string_table->identifier",
+	 string_table->identifier,
+	 (uint32_t) 0x040904b0UL );
+
+	result = libwrc_version_string_table_free(
+	          &string_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "string_table",
+	 string_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_string_table_initialize(
+	          NULL,
+	          0x040904b0UL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_table = (libwrc_version_string_table_t *) 0x12345678UL;
+
+	result = libwrc_version_string_table_initialize(
+	          &string_table,
+	          0x040904b0UL,
+	          &error );
+
+	string_table = NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WRC_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_version_string_table_initialize with malloc failing
+		 */
+		wrc_test_malloc_attempts_before_fail = test_number;
+
+		result = libwrc_version_string_table_initialize(
+		          &string_table,
+		          0x040904b0UL,
+		          &error );
+
+		if( wrc_test_malloc_attempts_before_fail != -1 )
+		{
+			wrc_test_malloc_attempts_before_fail = -1;
+
+			if( string_table != NULL )
+			{
+				libwrc_version_string_table_free(
+				 &string_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "string_table",
+			 string_table );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwrc_version_string_table_initialize with memset failing
+		 */
+		wrc_test_memset_attempts_before_fail = test_number;
+
+		result = libwrc_version_string_table_initialize(
+		          &string_table,
+		          0x040904b0UL,
+		          &error );
+
+		if( wrc_test_memset_attempts_before_fail != -1 )
+		{
+			wrc_test_memset_attempts_before_fail = -1;
+
+			if( string_table != NULL )
+			{
+				libwrc_version_string_table_free(
+				 &string_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			WRC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WRC_TEST_ASSERT_IS_NULL(
+			 "string_table",
+			 string_table );
+
+			WRC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WRC_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_table != NULL )
+	{
+		libwrc_version_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_string_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_string_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwrc_version_string_table_free(
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_string_table_get_identifier_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_string_table_get_identifier_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t identifier      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwrc_version_string_table_get_identifier_from_utf16_stream(
+	          wrc_test_version_string_table_key_data1,
+	          18,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 0x040904b0UL );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_version_string_table_get_identifier_from_utf16_stream(
+	          wrc_test_version_string_table_key_data2,
+	          18,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_version_string_table_get_identifier_from_utf16_stream(
+	          wrc_test_version_string_table_key_data1,
+	          8,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_string_table_get_identifier_from_utf16_stream(
+	          NULL,
+	          18,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_identifier_from_utf16_stream(
+	          wrc_test_version_string_table_key_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &identifier,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_identifier_from_utf16_stream(
+	          wrc_test_version_string_table_key_data1,
+	          18,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_string_table_append_string, libwrc_version_string_table_get_number_of_strings
+ * and libwrc_version_string_table_get_string_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_string_table_append_string(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libwrc_version_string_t *string             = NULL;
+	libwrc_version_string_table_t *string_table = NULL;
+	int key_index                               = 0;
+	int number_of_strings                       = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_version_string_table_initialize(
+	          &string_table,
+	          0x040904b0UL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "string_table",
+	 string_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( key_index = 0;
+	     key_index < WRC_TEST_VERSION_STRING_TABLE_NUMBER_OF_STRINGS;
+	     key_index++ )
+	{
+		result = libwrc_version_string_table_append_string(
+		          string_table,
+		          wrc_test_version_string_table_keys[ key_index ],
+		          12,
+		          wrc_test_version_string_table_value_data1,
+		          12,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A string without a value
+	 */
+	result = libwrc_version_string_table_append_string(
+	          string_table,
+	          wrc_test_version_string_table_key_data1,
+	          18,
+	          NULL,
+	          0,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WRC_TEST_ASSERT_EQUAL_UINT32(
+	 "string_table->number_of_slots",
+	 string_table->number_of_slots,
+	 (uint32_t) 128 );
+
+	result = libwrc_version_string_table_get_number_of_strings(
+	          string_table,
+	          &number_of_strings,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 WRC_TEST_VERSION_STRING_TABLE_NUMBER_OF_STRINGS + 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_version_string_table_get_string_by_index(
+	          string_table,
+	          3,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( string->key == wrc_test_version_string_table_keys[ 3 ] );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_string_table_append_string(
+	          NULL,
+	          wrc_test_version_string_table_keys[ 0 ],
+	          12,
+	          wrc_test_version_string_table_value_data1,
+	          12,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_append_string(
+	          string_table,
+	          NULL,
+	          12,
+	          wrc_test_version_string_table_value_data1,
+	          12,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_append_string(
+	          string_table,
+	          wrc_test_version_string_table_keys[ 0 ],
+	          12,
+	          NULL,
+	          12,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_number_of_strings(
+	          NULL,
+	          &number_of_strings,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_number_of_strings(
+	          string_table,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_index(
+	          NULL,
+	          0,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_index(
+	          string_table,
+	          -1,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_index(
+	          string_table,
+	          WRC_TEST_VERSION_STRING_TABLE_NUMBER_OF_STRINGS + 1,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_index(
+	          string_table,
+	          0,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_version_string_table_free(
+	          &string_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "string_table",
+	 string_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_table != NULL )
+	{
+		libwrc_version_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwrc_version_string_table_get_string_by_utf8_key and libwrc_version_string_table_get_string_by_utf16_key functions
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_string_table_get_string_by_key(
+     void )
+{
+	uint16_t utf16_key[ 6 ]                     = { 'K', 'e', 'y', '2', '7', 0 };
+	libcerror_error_t *error                    = NULL;
+	libwrc_version_string_t *string             = NULL;
+	libwrc_version_string_table_t *string_table = NULL;
+	int key_index                               = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_version_string_table_initialize(
+	          &string_table,
+	          0x040904b0UL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "string_table",
+	 string_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test lookup in a string table without strings
+	 */
+	result = libwrc_version_string_table_get_string_by_utf8_key(
+	          string_table,
+	          (uint8_t *) "Key27",
+	          5,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( key_index = 0;
+	     key_index < WRC_TEST_VERSION_STRING_TABLE_NUMBER_OF_STRINGS;
+	     key_index++ )
+	{
+		result = libwrc_version_string_table_append_string(
+		          string_table,
+		          wrc_test_version_string_table_keys[ key_index ],
+		          12,
+		          wrc_test_version_string_table_value_data1,
+		          12,
+		          &error );
+
+		WRC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WRC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	string = NULL;
+
+	result = libwrc_version_string_table_get_string_by_utf8_key(
+	          string_table,
+	          (uint8_t *) "Key27",
+	          5,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( string == &( string_table->strings[ 27 ] ) );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	string = NULL;
+
+	result = libwrc_version_string_table_get_string_by_utf16_key(
+	          string_table,
+	          utf16_key,
+	          5,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( string == &( string_table->strings[ 27 ] ) );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwrc_version_string_table_get_string_by_utf8_key(
+	          string_table,
+	          (uint8_t *) "Key99",
+	          5,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_key[ 3 ] = (uint16_t) '9';
+
+	result = libwrc_version_string_table_get_string_by_utf16_key(
+	          string_table,
+	          utf16_key,
+	          5,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwrc_version_string_table_get_string_by_utf8_key(
+	          NULL,
+	          (uint8_t *) "Key27",
+	          5,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_utf8_key(
+	          string_table,
+	          (uint8_t *) "Key27",
+	          (size_t) SSIZE_MAX,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_utf8_key(
+	          string_table,
+	          (uint8_t *) "Key27",
+	          5,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_utf16_key(
+	          NULL,
+	          utf16_key,
+	          5,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_utf16_key(
+	          string_table,
+	          utf16_key,
+	          (size_t) SSIZE_MAX,
+	          &string,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_string_table_get_string_by_utf16_key(
+	          string_table,
+	          utf16_key,
+	          5,
+	          NULL,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_version_string_table_free(
+	          &string_table,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "string_table",
+	 string_table );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_table != NULL )
+	{
+		libwrc_version_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WRC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WRC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WRC_TEST_UNREFERENCED_PARAMETER( argc )
+	WRC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+	wrc_test_version_string_table_set_keys();
+
+	WRC_TEST_RUN(
+	 "libwrc_version_string_table_initialize",
+	 wrc_test_version_string_table_initialize );
+
+	WRC_TEST_RUN(
+	 "libwrc_version_string_table_free",
+	 wrc_test_version_string_table_free );
+
+	WRC_TEST_RUN(
+	 "libwrc_version_string_table_get_identifier_from_utf16_stream",
+	 wrc_test_version_string_table_get_identifier_from_utf16_stream );
+
+	WRC_TEST_RUN(
+	 "libwrc_version_string_table_append_string",
+	 wrc_test_version_string_table_append_string );
+
+	WRC_TEST_RUN(
+	 "libwrc_version_string_table_get_string_by_key",
+	 wrc_test_version_string_table_get_string_by_key );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT ) */
+}
+
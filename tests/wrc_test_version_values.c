@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,8 +34,14 @@
 #include "wrc_test_memory.h"
 #include "wrc_test_unused.h"
 
+#include "../libwrc/libwrc_data_descriptor.h"
+#include "../libwrc/libwrc_io_handle.h"
+#include "../libwrc/libwrc_language_entry.h"
 #include "../libwrc/libwrc_version_values.h"
 
+uint8_t wrc_test_version_values_identifier[ 32 ] = {
+	'V', 0, 'S', 0, '_', 0, 'V', 0, 'E', 0, 'R', 0, 'S', 0, 'I', 0, 'O', 0, 'N', 0, '_', 0, 'I', 0, 'N', 0, 'F', 0, 'O', 0, 0, 0 };
+
 #if defined( __GNUC__ ) && !defined( LIBWRC_DLL_IMPORT )
 
 /* Tests the libwrc_version_values_initialize function
@@ -270,6 +277,288 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libwrc_version_values_read function
+ * Returns 1 if successful or 0 if not
+ */
+int wrc_test_version_values_read(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libwrc_data_descriptor_t data_descriptor;
+
+	libcerror_error_t *error                = NULL;
+	libwrc_io_handle_t *io_handle           = NULL;
+	libwrc_language_entry_t *language_entry = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libwrc_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwrc_language_entry_initialize(
+	          &language_entry,
+	          0x00000409UL,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libwrc_version_values_free,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "language_entry",
+	 language_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          data,
+	          0,
+	          64 ) != NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_copy(
+	          &( data[ 6 ] ),
+	          wrc_test_version_values_identifier,
+	          32 ) != NULL;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Value data size of the fixed file information
+	 */
+	data[ 2 ] = 0x34;
+
+	io_handle->virtual_address = 0x00001000UL;
+	io_handle->stream_data     = data;
+	io_handle->stream_size     = 64;
+
+	data_descriptor.virtual_address = 0x00001000UL;
+
+	/* Test error cases
+	 */
+	data_descriptor.size = 64;
+
+	result = libwrc_version_values_read(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwrc_version_values_read(
+	          language_entry,
+	          NULL,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where resource data is too small to contain the value header
+	 */
+	data_descriptor.size = 4;
+
+	result = libwrc_version_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where resource data is too small to contain the value identifier
+	 */
+	data_descriptor.size = 20;
+
+	result = libwrc_version_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where resource data is too small to contain the fixed file information
+	 */
+	data_descriptor.size = 64;
+
+	result = libwrc_version_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the value data size is too small to contain the fixed file information
+	 */
+	data[ 2 ] = 0x04;
+
+	result = libwrc_version_values_read(
+	          language_entry,
+	          io_handle,
+	          NULL,
+	          &data_descriptor,
+	          &error );
+
+	data[ 2 ] = 0x34;
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WRC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwrc_language_entry_free(
+	          &language_entry,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "language_entry",
+	 language_entry );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->stream_data = NULL;
+
+	result = libwrc_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WRC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WRC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( language_entry != NULL )
+	{
+		libwrc_language_entry_free(
+		 &language_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		io_handle->stream_data = NULL;
+
+		libwrc_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libwrc_version_values_get_file_version function
  * Returns 1 if successful or 0 if not
  */
@@ -543,7 +832,9 @@ int main(
 	 "libwrc_version_values_free",
 	 wrc_test_version_values_free );
 
-	/* TODO: add tests for libwrc_version_values_read */
+	WRC_TEST_RUN(
+	 "libwrc_version_values_read",
+	 wrc_test_version_values_read );
 
 	/* TODO: add tests for libwrc_version_values_read_string_file_information */
 
@@ -2972,9 +2972,11 @@ int info_handle_version_information_resource_item_fprint(
      libwrc_resource_item_t *resource_item,
      libcerror_error_t **error )
 {
+	uint8_t resource_data[ LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE ];
+
 	libwrc_version_information_resource_t *version_information_resource = NULL;
-	uint8_t *resource_data                                              = NULL;
 	static char *function                                               = "info_handle_version_information_resource_item_fprint";
+	size_t read_size                                                    = 0;
 	ssize_t read_count                                                  = 0;
 	uint64_t value_64bit                                                = 0;
 	uint32_t language_identifier                                        = 0;
@@ -3027,8 +3029,7 @@ int info_handle_version_information_resource_item_fprint(
 
 		goto on_error;
 	}
-	if( ( resource_data_size == 0 )
-	 || ( resource_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( resource_data_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -3039,27 +3040,22 @@ int info_handle_version_information_resource_item_fprint(
 
 		goto on_error;
 	}
-	resource_data = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * resource_data_size );
+	/* Only the fixed file information is printed, which is stored
+	 * at the start of the resource data
+	 */
+	read_size = LIBWRC_VERSION_INFORMATION_FIXED_FILE_INFORMATION_DATA_SIZE;
 
-	if( resource_data == NULL )
+	if( read_size > (size_t) resource_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create resource data.",
-		 function );
-
-		goto on_error;
+		read_size = (size_t) resource_data_size;
 	}
 	read_count = libwrc_resource_item_read_buffer(
 	              resource_item,
 	              resource_data,
-	              (size_t) resource_data_size,
+	              read_size,
 	              error );
 
-	if( read_count != (ssize_t) resource_data_size )
+	if( read_count != (ssize_t) read_size )
 	{
 		libcerror_error_set(
 		 error,
@@ -3083,10 +3079,10 @@ int info_handle_version_information_resource_item_fprint(
 
 		goto on_error;
 	}
-	if( libwrc_version_information_resource_read(
+	if( libwrc_version_information_resource_read_fixed_file_information(
 	     version_information_resource,
 	     resource_data,
-	     (size_t) resource_data_size,
+	     read_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3098,11 +3094,6 @@ int info_handle_version_information_resource_item_fprint(
 
 		goto on_error;
 	}
-	memory_free(
-	 resource_data );
-
-	resource_data = NULL;
-
 	if( libwrc_version_information_resource_get_file_version(
 	     version_information_resource,
 	     &value_64bit,
@@ -3175,11 +3166,6 @@ on_error:
 		 &version_information_resource,
 		 NULL );
 	}
-	if( resource_data != NULL )
-	{
-		memory_free(
-		 resource_data );
-	}
 	return( -1 );
 }
 
@@ -4394,3 +4380,114 @@ on_error:
 	return( -1 );
 }
 
+/* Prints the statistics of the resource stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libwrc_statistics_t statistics;
+
+	static char *function = "info_handle_statistics_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_stream_get_statistics(
+	     info_handle->input_resource_stream,
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Statistics:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tnumber of reads\t\t\t: %" PRIu64 "\n",
+	 statistics.number_of_reads );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tnumber of bytes read\t\t: %" PRIu64 " bytes\n",
+	 statistics.read_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tnumber of allocations\t\t: %" PRIu64 "\n",
+	 statistics.number_of_allocations );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tmaximum allocated size\t\t: %" PRIu64 " bytes\n",
+	 statistics.maximum_allocated_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tnumber of nodes\t\t\t: %" PRIu64 "\n",
+	 statistics.number_of_nodes );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tnumber of node entries\t\t: %" PRIu64 "\n",
+	 statistics.number_of_node_entries );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tnumber of data descriptors\t: %" PRIu64 "\n",
+	 statistics.number_of_data_descriptors );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tnode tree read time\t\t: %" PRIu64 " ns\n",
+	 statistics.node_tree_read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tstring values read time\t\t: %" PRIu64 " ns\n",
+	 statistics.string_values_read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tmessage table values read time\t: %" PRIu64 " ns\n",
+	 statistics.message_table_values_read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tmanifest values read time\t: %" PRIu64 " ns\n",
+	 statistics.manifest_values_read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tMUI values read time\t\t: %" PRIu64 " ns\n",
+	 statistics.mui_values_read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tversion values read time\t: %" PRIu64 " ns\n",
+	 statistics.version_values_read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
@@ -118,6 +118,7 @@ int main( int argc, char * const argv[] )
 		{ 'c', "codepage", "codepage of ASCII strings, options: ascii, windows-874, windows-932, windows-936, windows-949, windows-950, windows-1250, windows-1251, windows-1252 (default), windows-1253, windows-1254, windows-1255, windows-1256, windows-1257 or windows-1258" },
 		{ 'h', NULL, "shows this help" },
 		{ 'H', NULL, "shows the resource hierarchy" },
+		{ 'S', NULL, "shows the read statistics, such as the number of reads and allocations" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source file" },
@@ -131,6 +132,7 @@ int main( int argc, char * const argv[] )
 	system_integer_t option             = 0;
 	int number_of_options               = (int) ( sizeof( options ) / sizeof( wrctools_option_t ) );
 	int option_mode                     = WRCINFO_MODE_OVERVIEW;
+	int print_statistics                = 0;
 	int result                          = 0;
 	int verbose                         = 0;
 
@@ -219,6 +221,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'S':
+				print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -339,6 +346,19 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     wrcinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close_input(
 	     wrcinfo_info_handle,
 	     &error ) != 0 )